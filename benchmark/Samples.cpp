@@ -0,0 +1,91 @@
+/**
+ * \file
+ * \brief Samples class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "Samples.hpp"
+
+#include "toNanoseconds.hpp"
+
+#include <algorithm>
+
+#include <cassert>
+#include <cinttypes>
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts number of cycles to integer number of nanoseconds suitable for printing.
+ *
+ * \param [in] cycles is the number of cycles that will be converted
+ *
+ * \return \a cycles converted to nanoseconds
+ */
+
+int_least64_t toPrintable(const uint64_t cycles)
+{
+	return static_cast<int_least64_t>(toNanoseconds(cycles).count());
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+Samples::Samples(const size_t capacity) :
+		samples_{}
+{
+	samples_.reserve(capacity);
+}
+
+void Samples::add(const uint64_t cycles)
+{
+	assert(samples_.size() < samples_.capacity() && "Capacity of samples exceeded!");
+	samples_.emplace_back(cycles);
+}
+
+void Samples::print(const char* const name, const char* const variant)
+{
+	assert(samples_.empty() == false && "No samples to print!");
+
+	uint64_t total {};
+	for (const auto sample : samples_)
+		total += sample;
+
+	std::sort(samples_.begin(), samples_.end());
+	const auto size = samples_.size();
+	printf("%s %s %zu %" PRIdLEAST64 " %" PRIdLEAST64 " %" PRIdLEAST64 " %" PRIdLEAST64 " %" PRIdLEAST64 " %"
+			PRIdLEAST64 "\n", name, variant, size, toPrintable(samples_.front()), toPrintable(total / size),
+			toPrintable(samples_[size * 50 / 100]), toPrintable(samples_[size * 90 / 100]),
+			toPrintable(samples_[size * 99 / 100]), toPrintable(samples_.back()));
+
+	samples_.clear();
+}
+
+void Samples::printHeader()
+{
+	printf("name variant samples min avg p50 p90 p99 max\n");
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
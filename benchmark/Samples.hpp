@@ -0,0 +1,87 @@
+/**
+ * \file
+ * \brief Samples class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_SAMPLES_HPP_
+#define BENCHMARK_SAMPLES_HPP_
+
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Samples class is a collection of measured durations of one operation.
+ *
+ * Storage for all samples is reserved in the constructor, so adding samples during measurement does not use dynamic
+ * memory allocation.
+ */
+
+class Samples
+{
+public:
+
+	/**
+	 * \brief Samples's constructor
+	 *
+	 * \param [in] capacity is the max number of samples that will be added
+	 */
+
+	explicit Samples(size_t capacity);
+
+	/**
+	 * \brief Adds one sample.
+	 *
+	 * \pre Number of samples is less than capacity.
+	 *
+	 * \param [in] cycles is the measured duration, difference of timestamps returned by getTimestamp()
+	 */
+
+	void add(uint64_t cycles);
+
+	/**
+	 * \brief Prints statistics of samples to standard output and removes all samples.
+	 *
+	 * Statistics are printed in one line, in the following format: "<name> <variant> <number of samples> <minimum>
+	 * <average> <50th percentile> <90th percentile> <99th percentile> <maximum>", all durations are in nanoseconds.
+	 * Neither \a name nor \a variant may contain spaces. On the host maximum is dominated by preemption of the whole
+	 * process, so the percentiles should be used to track jitter.
+	 *
+	 * \pre At least one sample was added.
+	 *
+	 * \param [in] name is the name of benchmark
+	 * \param [in] variant is the name of measured variant
+	 */
+
+	void print(const char* name, const char* variant);
+
+	/**
+	 * \brief Prints header with names of columns printed by print() to standard output.
+	 */
+
+	static void printHeader();
+
+private:
+
+	/// measured durations
+	std::vector<uint64_t> samples_;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SAMPLES_HPP_
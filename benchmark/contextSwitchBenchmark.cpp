@@ -0,0 +1,89 @@
+/**
+ * \file
+ * \brief contextSwitchBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "contextSwitchBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of threads, bytes
+constexpr size_t stackSize {1024};
+
+/// number of yields done by each thread
+constexpr size_t iterations {1000};
+
+/// priority of threads, lower than priority of main thread
+constexpr uint8_t threadPriority {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by both threads.
+ *
+ * \param [in,out] samples is a reference to Samples object to which measured durations are added
+ * \param [in,out] timestamp is a reference to variable with timestamp taken by the other thread just before it yielded
+ */
+
+void yieldFunction(Samples& samples, uint64_t& timestamp)
+{
+	for (size_t i {}; i < iterations; ++i)
+	{
+		timestamp = getTimestamp();
+		ThisThread::yield();
+		samples.add(getTimestamp() - timestamp);
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void contextSwitchBenchmark()
+{
+	Samples samples {2 * iterations};
+	uint64_t timestamp {};
+
+	// FIFO scheduling policy prevents preemption of threads between yields
+	auto thread1 = makeAndStartDynamicThread({stackSize, threadPriority, SchedulingPolicy::fifo}, yieldFunction,
+			std::ref(samples), std::ref(timestamp));
+	auto thread2 = makeAndStartDynamicThread({stackSize, threadPriority, SchedulingPolicy::fifo}, yieldFunction,
+			std::ref(samples), std::ref(timestamp));
+
+	// main thread has higher priority, so threads are executed only when it is blocked here
+	thread1.join();
+	thread2.join();
+
+	samples.print("contextSwitch", "yield");
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief contextSwitchBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_CONTEXTSWITCHBENCHMARK_HPP_
+#define BENCHMARK_CONTEXTSWITCHBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of context switch caused by ThisThread::yield().
+ *
+ * Two threads with equal priority and FIFO scheduling policy repeatedly yield to each other. Each sample is the time
+ * from the moment just before one thread calls ThisThread::yield() to the moment when the other thread returns from its
+ * call to this function.
+ *
+ * Results are printed to standard output with Samples::print(), with "contextSwitch" as the name of benchmark and
+ * "yield" as the name of variant.
+ */
+
+void contextSwitchBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_CONTEXTSWITCHBENCHMARK_HPP_
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief getTimestamp() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "getTimestamp.hpp"
+
+#include "distortos/architecture/getCycleCount.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t getTimestamp()
+{
+	// on the target, extension of the counter to 64 bits is not safe against concurrent calls from interrupts
+	const InterruptMaskingLock interruptMaskingLock;
+	return architecture::getCycleCount();
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
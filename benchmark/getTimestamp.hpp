@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief getTimestamp() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_GETTIMESTAMP_HPP_
+#define BENCHMARK_GETTIMESTAMP_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Gets current value of architecture's cycle counter.
+ *
+ * On the target this is the cycle counter of the core, on the host - monotonic clock with nanosecond resolution.
+ * Differences of timestamps can be converted to nanoseconds with toNanoseconds().
+ *
+ * \note This function can be used from thread and interrupt context.
+ *
+ * \return current value of architecture's cycle counter
+ */
+
+uint64_t getTimestamp();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_GETTIMESTAMP_HPP_
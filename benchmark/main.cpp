@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief Main code block.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "contextSwitchBenchmark.hpp"
+#include "mutexBenchmark.hpp"
+#include "priorityInheritanceBenchmark.hpp"
+#include "queueBenchmark.hpp"
+#include "runnableListBenchmark.hpp"
+#include "Samples.hpp"
+#include "semaphoreBenchmark.hpp"
+#include "signalsBenchmark.hpp"
+#include "softwareTimerBenchmark.hpp"
+#include "threadCreationBenchmark.hpp"
+#include "timedWaitBenchmark.hpp"
+
+#include "distortos/ThisThread.hpp"
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Main code block of benchmark application
+ *
+ * Raises priority of main thread above priority of all threads used in benchmarks (except the ones which must preempt
+ * main thread) and runs all benchmarks. Each benchmark prints its results with Samples::print(), so the output is a
+ * table with one header line.
+ */
+
+int main()
+{
+	distortos::ThisThread::setPriority(UINT8_MAX - 1);
+
+	distortos::benchmark::Samples::printHeader();
+
+	distortos::benchmark::runnableListBenchmark();
+	distortos::benchmark::softwareTimerBenchmark();
+	distortos::benchmark::timedWaitBenchmark();
+	distortos::benchmark::priorityInheritanceBenchmark();
+	distortos::benchmark::threadCreationBenchmark();
+	distortos::benchmark::contextSwitchBenchmark();
+	distortos::benchmark::semaphoreBenchmark();
+	distortos::benchmark::mutexBenchmark();
+	distortos::benchmark::queueBenchmark();
+#if CONFIG_SIGNALS_ENABLE == 1
+	distortos::benchmark::signalsBenchmark();
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+
+	return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * \file
+ * \brief mutexBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "mutexBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of thread which owns the mutex in "contended" variant, bytes
+constexpr size_t stackSize {1024};
+
+/// number of samples for each variant
+constexpr size_t iterations {1000};
+
+/// priority of thread which owns the mutex in "contended" variant, lower than priority of main thread
+constexpr uint8_t ownerPriority {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by thread which owns the mutex in "contended" variant.
+ *
+ * \param [in] mutex is a reference to mutex which is locked
+ * \param [in] locked is a reference to semaphore posted after \a mutex is locked
+ * \param [in] release is a reference to semaphore for which the thread waits before unlocking \a mutex
+ */
+
+void ownerFunction(Mutex& mutex, Semaphore& locked, Semaphore& release)
+{
+	for (size_t i {}; i < iterations; ++i)
+	{
+		mutex.lock();
+		locked.post();
+		release.wait();
+		mutex.unlock();
+	}
+}
+
+/**
+ * \brief Measures and prints "contended" variant.
+ *
+ * \param [in] protocol is the protocol of mutex
+ * \param [in] variant is the name of variant
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+void measureContended(const Mutex::Protocol protocol, const char* const variant, Samples& samples)
+{
+	Mutex mutex {protocol};
+	Semaphore locked {0};
+	Semaphore release {0};
+	auto thread = makeAndStartDynamicThread({stackSize, ownerPriority}, ownerFunction, std::ref(mutex),
+			std::ref(locked), std::ref(release));
+	for (size_t i {}; i < iterations; ++i)
+	{
+		// owner has lower priority, so it locks the mutex only when main thread is blocked here
+		locked.wait();
+
+		const auto start = getTimestamp();
+		release.post();
+		mutex.lock();
+		samples.add(getTimestamp() - start);
+		mutex.unlock();
+	}
+	thread.join();
+	samples.print("mutex", variant);
+}
+
+/**
+ * \brief Measures and prints "uncontended" variant.
+ *
+ * \param [in] type is the type of mutex
+ * \param [in] protocol is the protocol of mutex
+ * \param [in] variant is the name of variant
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+void measureUncontended(const Mutex::Type type, const Mutex::Protocol protocol, const char* const variant,
+		Samples& samples)
+{
+	Mutex mutex {type, protocol, ThisThread::getPriority()};
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		mutex.lock();
+		mutex.unlock();
+		samples.add(getTimestamp() - start);
+	}
+	samples.print("mutex", variant);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void mutexBenchmark()
+{
+	Samples samples {iterations};
+	measureUncontended(Mutex::Type::normal, Mutex::Protocol::none, "uncontended,none", samples);
+	measureUncontended(Mutex::Type::normal, Mutex::Protocol::priorityInheritance, "uncontended,priorityInheritance",
+			samples);
+	measureUncontended(Mutex::Type::normal, Mutex::Protocol::priorityProtect, "uncontended,priorityProtect", samples);
+	measureUncontended(Mutex::Type::errorChecking, Mutex::Protocol::none, "uncontended,none,errorChecking", samples);
+	measureUncontended(Mutex::Type::recursive, Mutex::Protocol::none, "uncontended,none,recursive", samples);
+	measureContended(Mutex::Protocol::none, "contended,none", samples);
+	measureContended(Mutex::Protocol::priorityInheritance, "contended,priorityInheritance", samples);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
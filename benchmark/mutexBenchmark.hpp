@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief mutexBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_MUTEXBENCHMARK_HPP_
+#define BENCHMARK_MUTEXBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of locking and unlocking of Mutex objects versus protocol of mutex.
+ *
+ * Following variants are measured:
+ * - "uncontended,<protocol>" - each sample is the duration of Mutex::lock() + Mutex::unlock() pair done by main thread
+ * on a normal mutex which is not locked by any other thread, measured for all protocols;
+ * - "uncontended,none,<type>" - same as above, measured for "errorChecking" and "recursive" mutexes with "none"
+ * protocol;
+ * - "contended,<protocol>" - mutex is locked by a thread with lower priority, which unlocks it only after main thread
+ * blocks on Mutex::lock(); each sample is the duration of main thread's call to Mutex::lock(), which includes two
+ * context switches and transfer of ownership, measured for "none" and "priorityInheritance" protocols;
+ *
+ * Results are printed to standard output with Samples::print(), with "mutex" as the name of benchmark.
+ */
+
+void mutexBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_MUTEXBENCHMARK_HPP_
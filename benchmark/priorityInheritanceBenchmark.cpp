@@ -0,0 +1,162 @@
+/**
+ * \file
+ * \brief priorityInheritanceBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "priorityInheritanceBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of threads used in benchmark, bytes
+constexpr size_t stackSize {1024};
+
+/// number of samples of priority change for each tested combination
+constexpr size_t iterations {10000};
+
+/// tested depths of inheritance chain
+constexpr size_t chainDepths[] {1, 8, 32};
+
+/// tested numbers of mutexes owned by each thread in the chain
+constexpr size_t mutexCounts[] {1, 8, 32};
+
+/// priority of threads in the chain
+constexpr uint8_t chainPriority {1};
+
+/// priority to which last thread in the chain is raised
+constexpr uint8_t raisedPriority {100};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by threads in the chain.
+ *
+ * Locks all owned mutexes, then blocks - on the mutex owned by previous thread in the chain or on the semaphore (first
+ * thread in the chain). After that all locked mutexes are unlocked.
+ *
+ * \param [in] ownedMutexes is a pointer to array with mutexes owned by this thread
+ * \param [in] mutexCount is the number of elements in \a ownedMutexes array
+ * \param [in] blockingMutex is a pointer to mutex owned by previous thread in the chain, nullptr for first thread
+ * \param [in] semaphore is a reference to semaphore which releases first thread in the chain
+ */
+
+void chainFunction(Mutex* const ownedMutexes, const size_t mutexCount, Mutex* const blockingMutex,
+		Semaphore& semaphore)
+{
+	for (size_t i {}; i < mutexCount; ++i)
+		ownedMutexes[i].lock();
+
+	if (blockingMutex != nullptr)
+	{
+		blockingMutex->lock();
+		blockingMutex->unlock();
+	}
+	else
+		semaphore.wait();
+
+	for (size_t i {}; i < mutexCount; ++i)
+		ownedMutexes[mutexCount - 1 - i].unlock();
+}
+
+/**
+ * \brief Measures and prints cost of propagation of priority inheritance.
+ *
+ * \param [in] chainDepth is the depth of inheritance chain
+ * \param [in] mutexCount is the number of mutexes owned by each thread in the chain
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+void measure(const size_t chainDepth, const size_t mutexCount, Samples& samples)
+{
+	// locked mutexes must not be moved, so the vector must not be reallocated
+	std::vector<Mutex> mutexes;
+	mutexes.reserve(chainDepth * mutexCount);
+	for (size_t i {}; i < chainDepth * mutexCount; ++i)
+		mutexes.emplace_back(Mutex::Protocol::priorityInheritance);
+
+	Semaphore semaphore {0};
+
+	// started thread must not be moved, so threads are allocated individually
+	std::vector<std::unique_ptr<DynamicThread>> threads;
+	threads.reserve(chainDepth);
+	for (size_t i {}; i < chainDepth; ++i)
+	{
+		// thread blocks on the mutex which was locked as the last one by previous thread, so it is at the end of the
+		// list of mutexes owned by previous thread
+		const auto blockingMutex = i != 0 ? &mutexes[i * mutexCount - 1] : nullptr;
+		threads.emplace_back(new DynamicThread{{stackSize, chainPriority}, chainFunction, &mutexes[i * mutexCount],
+				mutexCount, blockingMutex, std::ref(semaphore)});
+		threads.back()->start();
+	}
+
+	// main thread has higher priority, so it must sleep to let the chain be built
+	ThisThread::sleepFor(std::chrono::milliseconds{2});
+
+	auto& lastThread = *threads.back();
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		lastThread.setPriority(i % 2 == 0 ? raisedPriority : chainPriority);
+		samples.add(getTimestamp() - start);
+	}
+	lastThread.setPriority(chainPriority);
+
+	// main thread is blocked here, so the chain will be released and all threads will terminate
+	semaphore.post();
+	for (auto& thread : threads)
+		thread->join();
+
+	char variant[24];
+	snprintf(variant, sizeof(variant), "%zu,%zu", chainDepth, mutexCount);
+	samples.print("priorityInheritance", variant);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void priorityInheritanceBenchmark()
+{
+	Samples samples {iterations};
+	for (const auto chainDepth : chainDepths)
+		for (const auto mutexCount : mutexCounts)
+			measure(chainDepth, mutexCount, samples);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
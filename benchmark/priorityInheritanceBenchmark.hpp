@@ -0,0 +1,40 @@
+/**
+ * \file
+ * \brief priorityInheritanceBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_PRIORITYINHERITANCEBENCHMARK_HPP_
+#define BENCHMARK_PRIORITYINHERITANCEBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of propagation of priority inheritance versus depth of inheritance chain and number of owned
+ * mutexes.
+ *
+ * A chain of threads is built - each thread owns a number of mutexes with priorityInheritance protocol and (except the
+ * first one) is blocked on one of the mutexes owned by the previous thread in the chain. Priority of the last thread in
+ * the chain is then repeatedly raised and restored, so each change propagates through the whole chain. Each change is
+ * done in a single section with masked interrupts, so its duration is the interrupt latency caused by the operation.
+ *
+ * Results are printed with Samples::print(), one line per tested combination, with "priorityInheritance" as the name of
+ * benchmark and "<depth of chain>,<mutexes per thread>" as the name of variant.
+ */
+
+void priorityInheritanceBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_PRIORITYINHERITANCEBENCHMARK_HPP_
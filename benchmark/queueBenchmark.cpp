@@ -0,0 +1,186 @@
+/**
+ * \file
+ * \brief queueBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "queueBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicRawMessageQueue.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+
+#include <array>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of samples for each variant
+constexpr size_t iterations {1000};
+
+/// capacity of tested queues
+constexpr size_t queueSize {8};
+
+/// priority of elements pushed to message queues
+constexpr uint8_t elementPriority {1};
+
+/// tested numbers of elements in message queue during measurement of push
+constexpr size_t depths[] {0, 16, 64, 255};
+
+/// number of different priorities of elements in message queue during measurement of push
+constexpr size_t depthPriorities {64};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures one operation and prints the results.
+ *
+ * \tparam Function is the type of function which executes measured operation
+ *
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ * \param [in] type is the name of type of queue
+ * \param [in] elementSize is the size of element, bytes
+ * \param [in] function is the function which executes measured operation
+ */
+
+/**
+ * \brief Measures push to RawMessageQueue with given number of elements already in the queue and prints the results.
+ *
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ * \param [in] depth is the number of elements in the queue
+ */
+
+void measureDepth(Samples& samples, const size_t depth)
+{
+	DynamicRawMessageQueue queue {sizeof(uint32_t), depth + 1};
+	uint32_t element {};
+	for (size_t i {}; i < depth; ++i)
+		queue.tryPush(1 + i % depthPriorities, element);
+
+	uint8_t priority;
+	for (size_t i {}; i < iterations; ++i)
+	{
+		// element with the lowest priority is placed after all other elements
+		const auto start = getTimestamp();
+		queue.tryPush(0, element);
+		samples.add(getTimestamp() - start);
+		queue.tryPop(priority, element);
+	}
+
+	char variant[16];
+	snprintf(variant, sizeof(variant), "%zu", depth);
+	samples.print("messageQueuePush", variant);
+}
+
+template<typename Function>
+void measure(Samples& samples, const char* const type, const size_t elementSize, Function function)
+{
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		function();
+		samples.add(getTimestamp() - start);
+	}
+
+	char variant[32];
+	snprintf(variant, sizeof(variant), "%s,%zu", type, elementSize);
+	samples.print("queue", variant);
+}
+
+/**
+ * \brief Measures all types of queues with given size of element.
+ *
+ * \tparam ElementSize is the size of element, bytes
+ *
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+template<size_t ElementSize>
+void measureElementSize(Samples& samples)
+{
+	using Element = std::array<uint8_t, ElementSize>;
+	Element element {};
+	uint8_t priority;
+
+	{
+		StaticFifoQueue<Element, queueSize> queue;
+		measure(samples, "fifoQueue", ElementSize,
+				[&queue, &element]()
+				{
+					queue.tryPush(element);
+					queue.tryPop(element);
+				});
+	}
+	{
+		StaticMessageQueue<Element, queueSize> queue;
+		measure(samples, "messageQueue", ElementSize,
+				[&queue, &element, &priority]()
+				{
+					queue.tryPush(elementPriority, element);
+					queue.tryPop(priority, element);
+				});
+	}
+	{
+		StaticRawFifoQueue<ElementSize, queueSize> queue;
+		measure(samples, "rawFifoQueue", ElementSize,
+				[&queue, &element]()
+				{
+					queue.tryPush(element.data(), element.size());
+					queue.tryPop(element.data(), element.size());
+				});
+	}
+	{
+		StaticRawMessageQueue<ElementSize, queueSize> queue;
+		measure(samples, "rawMessageQueue", ElementSize,
+				[&queue, &element, &priority]()
+				{
+					queue.tryPush(elementPriority, element.data(), element.size());
+					queue.tryPop(priority, element.data(), element.size());
+				});
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void queueBenchmark()
+{
+	Samples samples {iterations};
+	measureElementSize<4>(samples);
+	measureElementSize<16>(samples);
+	measureElementSize<64>(samples);
+
+	for (const auto depth : depths)
+		measureDepth(samples, depth);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief queueBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_QUEUEBENCHMARK_HPP_
+#define BENCHMARK_QUEUEBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of push + pop pair of FifoQueue, MessageQueue, RawFifoQueue and RawMessageQueue versus size of
+ * element.
+ *
+ * Each sample is the duration of tryPush() + tryPop() pair done by main thread on an empty queue, so no thread is ever
+ * blocked or unblocked.
+ *
+ * Results are printed to standard output with Samples::print(), with "queue" as the name of benchmark and
+ * "<fifoQueue|messageQueue|rawFifoQueue|rawMessageQueue>,<size of element>" as the name of variant.
+ *
+ * Additionally measures cost of push to RawMessageQueue versus number of elements already in the queue. Each sample is
+ * the duration of tryPush() of an element with the lowest priority to a queue which contains elements with equal or
+ * higher priorities - this is the worst case for the sorted list of elements. Results are printed with
+ * "messageQueuePush" as the name of benchmark and "<number of elements in queue>" as the name of variant.
+ */
+
+void queueBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_QUEUEBENCHMARK_HPP_
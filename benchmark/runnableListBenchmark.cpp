@@ -0,0 +1,140 @@
+/**
+ * \file
+ * \brief runnableListBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "runnableListBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <memory>
+#include <vector>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of threads used in benchmark, bytes
+constexpr size_t stackSize {1024};
+
+/// number of samples of block + unblock pair for each tested number of threads
+constexpr size_t iterations {10000};
+
+/// tested numbers of runnable threads
+constexpr size_t threadCounts[] {1, 8, 32, 128, 512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// pointer to ThreadControlBlock of thread which is blocked and unblocked during measurement
+internal::ThreadControlBlock* measuredThreadControlBlock;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by threads which just occupy the "runnable" list.
+ */
+
+void emptyFunction()
+{
+
+}
+
+/**
+ * \brief Function executed by thread which is blocked and unblocked during measurement.
+ *
+ * Saves pointer to its own ThreadControlBlock and lowers its own priority below priority of all other threads, so it
+ * will not be executed until the end of measurement.
+ */
+
+void measuredFunction()
+{
+	measuredThreadControlBlock = &internal::getScheduler().getCurrentThreadControlBlock();
+	ThisThread::setPriority(1);
+}
+
+/**
+ * \brief Measures and prints cost of blocking and unblocking of a thread with given number of other runnable threads.
+ *
+ * \param [in] threadCount is the number of other runnable threads
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+void measure(const size_t threadCount, Samples& samples)
+{
+	// started thread must not be moved, so threads are allocated individually
+	std::vector<std::unique_ptr<DynamicThread>> threads;
+	threads.reserve(threadCount);
+	for (size_t i {}; i < threadCount; ++i)
+	{
+		threads.emplace_back(new DynamicThread{{stackSize, static_cast<uint8_t>(2 + i % 200)}, emptyFunction});
+		threads.back()->start();
+	}
+
+	// this thread has higher priority than main thread, so it is executed immediately
+	auto measuredThread = makeAndStartDynamicThread({stackSize, UINT8_MAX}, measuredFunction);
+
+	auto& scheduler = internal::getScheduler();
+	const internal::ThreadList::iterator iterator {*measuredThreadControlBlock};
+
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		scheduler.suspend(iterator);
+		scheduler.resume(iterator);
+		samples.add(getTimestamp() - start);
+	}
+
+	// main thread is blocked here, so all other threads will be executed and will terminate
+	measuredThread.join();
+	for (auto& thread : threads)
+		thread->join();
+
+	char variant[24];
+	snprintf(variant, sizeof(variant), "%zu", threadCount);
+	samples.print("runnableList", variant);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void runnableListBenchmark()
+{
+	Samples samples {iterations};
+	for (const auto threadCount : threadCounts)
+		measure(threadCount, samples);
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
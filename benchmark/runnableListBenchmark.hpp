@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief runnableListBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_RUNNABLELISTBENCHMARK_HPP_
+#define BENCHMARK_RUNNABLELISTBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of blocking and unblocking of a thread versus number of runnable threads.
+ *
+ * For each tested number of threads, that many threads with various priorities are started, together with one thread
+ * with priority lower than all of them. Main thread has the highest priority, so none of these threads is executed
+ * during measurement. The lowest-priority thread is then repeatedly suspended and resumed - this is the worst case for
+ * a "runnable" list that is sorted by priority, as each resume has to skip over all other runnable threads.
+ *
+ * Duration of each block + unblock pair is one sample. Results are printed with Samples::print(), one line per tested
+ * number of threads, with "runnableList" as the name of benchmark and the number of threads as the name of variant.
+ */
+
+void runnableListBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_RUNNABLELISTBENCHMARK_HPP_
@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \brief semaphoreBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "semaphoreBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of threads, bytes
+constexpr size_t stackSize {1024};
+
+/// number of samples for each variant
+constexpr size_t iterations {1000};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by second thread in "roundTrip" variant.
+ *
+ * \param [in] ping is a reference to semaphore posted by main thread
+ * \param [in] pong is a reference to semaphore posted in reply
+ */
+
+void pongFunction(Semaphore& ping, Semaphore& pong)
+{
+	for (size_t i {}; i < iterations; ++i)
+	{
+		ping.wait();
+		pong.post();
+	}
+}
+
+/**
+ * \brief Function executed by second thread in "wakeUp" variant.
+ *
+ * \param [in] semaphore is a reference to semaphore posted by main thread
+ * \param [in,out] samples is a reference to Samples object to which measured durations are added
+ * \param [in] timestamp is a reference to variable with timestamp taken by main thread just before it posted
+ * \a semaphore
+ */
+
+void wakeUpFunction(Semaphore& semaphore, Samples& samples, const uint64_t& timestamp)
+{
+	for (size_t i {}; i < iterations; ++i)
+	{
+		semaphore.wait();
+		samples.add(getTimestamp() - timestamp);
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void semaphoreBenchmark()
+{
+	Samples samples {iterations};
+
+	{
+		Semaphore semaphore {0};
+		for (size_t i {}; i < iterations; ++i)
+		{
+			const auto start = getTimestamp();
+			semaphore.post();
+			semaphore.tryWait();
+			samples.add(getTimestamp() - start);
+		}
+		samples.print("semaphore", "uncontended");
+	}
+	{
+		Semaphore ping {0};
+		Semaphore pong {0};
+		auto thread = makeAndStartDynamicThread({stackSize, ThisThread::getPriority()}, pongFunction, std::ref(ping),
+				std::ref(pong));
+		for (size_t i {}; i < iterations; ++i)
+		{
+			const auto start = getTimestamp();
+			ping.post();
+			pong.wait();
+			samples.add(getTimestamp() - start);
+		}
+		thread.join();
+		samples.print("semaphore", "roundTrip");
+	}
+	{
+		Semaphore semaphore {0};
+		uint64_t timestamp {};
+		auto thread = makeAndStartDynamicThread({stackSize, UINT8_MAX}, wakeUpFunction, std::ref(semaphore),
+				std::ref(samples), std::cref(timestamp));
+		for (size_t i {}; i < iterations; ++i)
+		{
+			timestamp = getTimestamp();
+			semaphore.post();
+		}
+		thread.join();
+		samples.print("semaphore", "wakeUp");
+	}
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief semaphoreBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_SEMAPHOREBENCHMARK_HPP_
+#define BENCHMARK_SEMAPHOREBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of synchronization of two threads with Semaphore objects.
+ *
+ * Following variants are measured:
+ * - "uncontended" - main thread posts semaphore and immediately locks it with Semaphore::tryWait(), no other thread is
+ * involved; each sample is the duration of one such pair of calls;
+ * - "roundTrip" - main thread posts one semaphore and waits for the other one, which is posted by the second thread
+ * with equal priority after it waits for the first semaphore; each sample is the duration of whole round trip, which
+ * includes two context switches;
+ * - "wakeUp" - main thread posts semaphore for which the second thread with higher priority waits; each sample is the
+ * time from the moment just before the call to Semaphore::post() to the moment when the second thread returns from
+ * Semaphore::wait();
+ *
+ * Results are printed to standard output with Samples::print(), with "semaphore" as the name of benchmark.
+ */
+
+void semaphoreBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SEMAPHOREBENCHMARK_HPP_
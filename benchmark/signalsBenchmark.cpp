@@ -0,0 +1,115 @@
+/**
+ * \file
+ * \brief signalsBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "signalsBenchmark.hpp"
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread-Signals.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of thread which receives signals, bytes
+constexpr size_t stackSize {2048};
+
+/// number of samples for each variant
+constexpr size_t iterations {1000};
+
+/// signal number used in the benchmark
+constexpr uint8_t signalNumber {5};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by thread which receives signals.
+ *
+ * Measures and prints "generate,self" and "queue,self" variants, then waits for signals generated by main thread in
+ * "generate,wakeUp" variant.
+ *
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ * \param [in] timestamp is a reference to variable with timestamp taken by main thread just before it generated the
+ * signal
+ */
+
+void receiverFunction(Samples& samples, const uint64_t& timestamp)
+{
+	const SignalSet signalSet {1u << signalNumber};
+
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		ThisThread::Signals::generateSignal(signalNumber);
+		ThisThread::Signals::tryWait(signalSet);
+		samples.add(getTimestamp() - start);
+	}
+	samples.print("signals", "generate,self");
+
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		ThisThread::Signals::queueSignal(signalNumber, sigval{});
+		ThisThread::Signals::tryWait(signalSet);
+		samples.add(getTimestamp() - start);
+	}
+	samples.print("signals", "queue,self");
+
+	for (size_t i {}; i < iterations; ++i)
+	{
+		ThisThread::Signals::wait(signalSet);
+		samples.add(getTimestamp() - timestamp);
+	}
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void signalsBenchmark()
+{
+	Samples samples {iterations};
+	uint64_t timestamp {};
+
+	// receiver has higher priority, so it runs immediately and blocks only when it waits for signals from main thread
+	auto thread = makeAndStartDynamicThread({stackSize, true, 1, 0, UINT8_MAX}, receiverFunction, std::ref(samples),
+			std::cref(timestamp));
+	for (size_t i {}; i < iterations; ++i)
+	{
+		timestamp = getTimestamp();
+		thread.generateSignal(signalNumber);
+	}
+	thread.join();
+	samples.print("signals", "generate,wakeUp");
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief signalsBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_SIGNALSBENCHMARK_HPP_
+#define BENCHMARK_SIGNALSBENCHMARK_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of generation and acceptance of signals.
+ *
+ * Following variants are measured:
+ * - "generate,self" - each sample is the duration of ThisThread::Signals::generateSignal() +
+ * ThisThread::Signals::tryWait() pair done by a thread which can receive signals;
+ * - "queue,self" - each sample is the duration of ThisThread::Signals::queueSignal() + ThisThread::Signals::tryWait()
+ * pair done by a thread which can receive signals;
+ * - "generate,wakeUp" - main thread generates signal for which a thread with higher priority waits; each sample is the
+ * time from the moment just before the call to Thread::generateSignal() to the moment when the waiting thread returns
+ * from ThisThread::Signals::wait();
+ *
+ * Results are printed to standard output with Samples::print(), with "signals" as the name of benchmark.
+ */
+
+void signalsBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+
+#endif	// BENCHMARK_SIGNALSBENCHMARK_HPP_
@@ -0,0 +1,211 @@
+/**
+ * \file
+ * \brief softwareTimerBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "softwareTimerBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
+
+#include "distortos/DynamicSoftwareTimer.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of samples of start + stop pair for each tested number of timers
+constexpr size_t iterations {10000};
+
+/// number of samples of start + stop pair of software timer driven by system tick
+constexpr size_t samplesCount {1000};
+
+/// tested numbers of active software timers
+constexpr size_t timerCounts[] {10, 100, 1000};
+
+/// range of pseudo-random time points used in measurement of start + stop pairs, ticks
+constexpr uint32_t startRange {100000};
+
+/// range of pseudo-random time points used in measurement of tick interrupt handler, ticks per timer
+constexpr uint32_t tickRangePerTimer {8};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by software timers.
+ */
+
+void emptyFunction()
+{
+
+}
+
+/**
+ * \brief Runner for software timer's function which does nothing.
+ */
+
+void emptyRunner(SoftwareTimer&)
+{
+
+}
+
+/**
+ * \brief Generates pseudo-random time point.
+ *
+ * \param [in,out] state is a reference to state of xorshift generator
+ * \param [in] range is the range of generated time points, ticks
+ *
+ * \return pseudo-random time point in [1; \a range] range
+ */
+
+TickClock::time_point getRandomTimePoint(uint32_t& state, const uint32_t range)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return TickClock::time_point{TickClock::duration{state % range + 1}};
+}
+
+/**
+ * \brief Measures and prints cost of starting and stopping of a software timer with given number of other active
+ * timers.
+ *
+ * \param [in] timerCount is the number of other active software timers
+ * \param [in] variant is the name of variant
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+void measureStart(const size_t timerCount, const char* const variant, Samples& samples)
+{
+	DynamicSoftwareTimer owner {emptyFunction};
+	internal::SoftwareTimerSupervisor supervisor;
+	uint32_t state {0x12345678};
+
+	// started timer must not be moved, so the vector must not be reallocated
+	std::vector<internal::SoftwareTimerControlBlock> timers;
+	timers.reserve(timerCount);
+	for (size_t i {}; i < timerCount; ++i)
+	{
+		timers.emplace_back(emptyRunner, owner);
+		timers.back().start(supervisor, getRandomTimePoint(state, startRange), {});
+	}
+
+	internal::SoftwareTimerControlBlock measuredTimer {emptyRunner, owner};
+
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto timePoint = getRandomTimePoint(state, startRange);
+		const auto start = getTimestamp();
+		measuredTimer.start(supervisor, timePoint, {});
+		measuredTimer.stop();
+		samples.add(getTimestamp() - start);
+	}
+
+	for (auto& timer : timers)
+		timer.stop();
+
+	samples.print("softwareTimer", variant);
+}
+
+/**
+ * \brief Measures and prints cost of tick interrupt handler while given number of active timers expire.
+ *
+ * One sample is the duration of one call to SoftwareTimerSupervisor::tickInterruptHandler().
+ *
+ * \param [in] timerCount is the number of active software timers
+ * \param [in] variant is the name of variant
+ */
+
+void measureTick(const size_t timerCount, const char* const variant)
+{
+	DynamicSoftwareTimer owner {emptyFunction};
+	internal::SoftwareTimerSupervisor supervisor;
+	uint32_t state {0x87654321};
+	const uint32_t range = timerCount * tickRangePerTimer;
+
+	std::vector<internal::SoftwareTimerControlBlock> timers;
+	timers.reserve(timerCount);
+	for (size_t i {}; i < timerCount; ++i)
+	{
+		timers.emplace_back(emptyRunner, owner);
+		timers.back().start(supervisor, getRandomTimePoint(state, range), {});
+	}
+
+	Samples samples {range};
+	for (uint32_t tick {1}; tick <= range; ++tick)
+	{
+		const auto start = getTimestamp();
+		supervisor.tickInterruptHandler(TickClock::time_point{TickClock::duration{tick}});
+		samples.add(getTimestamp() - start);
+	}
+
+	samples.print("softwareTimer", variant);
+}
+
+/**
+ * \brief Measures latency of start + stop pair of software timer driven by system tick and prints the results.
+ */
+
+void measureStartStop()
+{
+	Samples samples {samplesCount};
+	DynamicSoftwareTimer timer {emptyFunction};
+	for (size_t i {}; i < samplesCount; ++i)
+	{
+		const auto start = getTimestamp();
+		timer.start(std::chrono::seconds{1});
+		timer.stop();
+		samples.add(getTimestamp() - start);
+	}
+	samples.print("softwareTimer", "startStop");
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void softwareTimerBenchmark()
+{
+	Samples samples {iterations};
+	for (const auto timerCount : timerCounts)
+	{
+		char variant[24];
+		snprintf(variant, sizeof(variant), "start,%zu", timerCount);
+		measureStart(timerCount, variant, samples);
+		snprintf(variant, sizeof(variant), "tick,%zu", timerCount);
+		measureTick(timerCount, variant);
+	}
+
+	measureStartStop();
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
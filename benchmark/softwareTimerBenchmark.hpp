@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \brief softwareTimerBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_SOFTWARETIMERBENCHMARK_HPP_
+#define BENCHMARK_SOFTWARETIMERBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of operations on active software timers versus number of active software timers.
+ *
+ * Measurements are done on a private SoftwareTimerSupervisor, which is driven with "virtual" time points, so they are
+ * not affected by system tick and by other software timers. For each tested number of timers two values are measured:
+ * - cost of starting and stopping one additional software timer while all other timers are active, with pseudo-random
+ * time points spread over 100000 ticks - variant "start,<number of timers>";
+ * - cost of SoftwareTimerSupervisor::tickInterruptHandler() while time advances tick by tick and all timers expire,
+ * with pseudo-random time points spread over 8 ticks per timer - variant "tick,<number of timers>";
+ *
+ * Results are printed with Samples::print(), with "softwareTimer" as the name of benchmark.
+ *
+ * Additionally latency of SoftwareTimer::start() + SoftwareTimer::stop() pair of a software timer driven by system tick
+ * is measured and printed with Samples::print(), with "softwareTimer" as the name of benchmark and "startStop" as the
+ * name of variant.
+ */
+
+void softwareTimerBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_SOFTWARETIMERBENCHMARK_HPP_
@@ -0,0 +1,145 @@
+/**
+ * \file
+ * \brief threadCreationBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "threadCreationBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticStackPool.hpp"
+
+#include <vector>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of threads created and destroyed for each tested combination
+constexpr size_t iterations {1000};
+
+/// small tested size of stack, bytes
+constexpr size_t smallStackSize {512};
+
+/// large tested size of stack, bytes
+constexpr size_t largeStackSize {8192};
+
+/// priority of created threads
+constexpr uint8_t threadPriority {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// stack pool for threads with small stack
+StaticStackPool<smallStackSize, 1> smallStackPool;
+
+/// stack pool for threads with large stack
+StaticStackPool<largeStackSize, 1> largeStackPool;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Empty function executed by created threads.
+ */
+
+void emptyFunction()
+{
+
+}
+
+/**
+ * \brief Prints statistics of samples of one operation.
+ *
+ * \param [in,out] samples is a reference to Samples object with samples of the operation
+ * \param [in] operation is the name of measured operation
+ * \param [in] source is the name of source of storage of threads
+ * \param [in] stackSize is the size of stack of threads, bytes
+ */
+
+void print(Samples& samples, const char* const operation, const char* const source, const size_t stackSize)
+{
+	char variant[32];
+	snprintf(variant, sizeof(variant), "%s,%s,%zu", operation, source, stackSize);
+	samples.print("threadCreation", variant);
+}
+
+/**
+ * \brief Measures latency of creation, start + join and destruction of threads and prints the results.
+ *
+ * \param [in] source is the name of source of storage of threads
+ * \param [in] parameters is a DynamicThreadParameters struct with parameters of created threads
+ */
+
+void measureAndPrint(const char* const source, const DynamicThreadParameters parameters)
+{
+	Samples creationSamples {iterations};
+	Samples startJoinSamples {iterations};
+	Samples destructionSamples {iterations};
+
+	// started thread must not be moved, so the vector must not be reallocated
+	std::vector<DynamicThread> threads;
+	threads.reserve(1);
+	for (size_t i {}; i < iterations; ++i)
+	{
+		{
+			const auto start = getTimestamp();
+			threads.emplace_back(parameters, emptyFunction);
+			creationSamples.add(getTimestamp() - start);
+		}
+		{
+			const auto start = getTimestamp();
+			threads.back().start();
+			threads.back().join();
+			startJoinSamples.add(getTimestamp() - start);
+		}
+		{
+			const auto start = getTimestamp();
+			threads.pop_back();
+			destructionSamples.add(getTimestamp() - start);
+		}
+	}
+
+	print(creationSamples, "create", source, parameters.stackSize);
+	print(startJoinSamples, "startJoin", source, parameters.stackSize);
+	print(destructionSamples, "destroy", source, parameters.stackSize);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void threadCreationBenchmark()
+{
+	measureAndPrint("heap", {smallStackSize, threadPriority});
+	measureAndPrint("pool", {smallStackPool, threadPriority});
+	measureAndPrint("heap", {largeStackSize, threadPriority});
+	measureAndPrint("pool", {largeStackPool, threadPriority});
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
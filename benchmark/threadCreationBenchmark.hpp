@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief threadCreationBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_THREADCREATIONBENCHMARK_HPP_
+#define BENCHMARK_THREADCREATIONBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures latency of creation, start + join and destruction of DynamicThread objects versus source of their
+ * storage and size of stack.
+ *
+ * Threads are repeatedly created, started, joined and destroyed. Creation (construction of the object), start + join
+ * pair (which includes execution of empty thread's function and two context switches) and destruction are measured
+ * separately. Storage of threads is allocated either from the heap or from StaticStackPool.
+ *
+ * Results are printed to standard output with Samples::print(), with "threadCreation" as the name of benchmark and
+ * "<create|startJoin|destroy>,<heap|pool>,<size of stack>" as the name of variant.
+ */
+
+void threadCreationBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_THREADCREATIONBENCHMARK_HPP_
@@ -0,0 +1,140 @@
+/**
+ * \file
+ * \brief timedWaitBenchmark() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "timedWaitBenchmark.hpp"
+
+#include "getTimestamp.hpp"
+#include "Samples.hpp"
+
+#include "distortos/DynamicSoftwareTimer.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include <cstdio>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of posting thread, bytes
+constexpr size_t stackSize {1024};
+
+/// number of samples of round trip for each tested number of timers
+constexpr size_t iterations {10000};
+
+/// tested numbers of active software timers
+constexpr size_t timerCounts[] {0, 100, 1000};
+
+/// timeout used for timed waits, never reached
+constexpr auto timeout = std::chrono::hours{1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by software timers.
+ */
+
+void emptyFunction()
+{
+
+}
+
+/**
+ * \brief Function executed by posting thread.
+ *
+ * Posts the semaphore until stop is requested. As this thread has lower priority than main thread, each post unblocks
+ * main thread, which preempts this thread immediately.
+ *
+ * \param [in] semaphore is a reference to semaphore which will be posted
+ * \param [in] stopRequested is a reference to variable which requests this thread to stop
+ */
+
+void postingFunction(Semaphore& semaphore, const volatile bool& stopRequested)
+{
+	while (stopRequested == false)
+		semaphore.post();
+}
+
+/**
+ * \brief Measures and prints cost of round trips of waits.
+ *
+ * \param [in] timed selects whether timed (true) or untimed (false) waits will be measured
+ * \param [in] timerCount is the number of active software timers
+ * \param [in,out] samples is a reference to Samples object used for measurement
+ */
+
+void measureRoundTrip(const bool timed, const size_t timerCount, Samples& samples)
+{
+	Semaphore semaphore {0};
+	volatile bool stopRequested {};
+	auto postingThread = makeAndStartDynamicThread({stackSize, 1}, postingFunction, std::ref(semaphore),
+			std::cref(stopRequested));
+
+	for (size_t i {}; i < iterations; ++i)
+	{
+		const auto start = getTimestamp();
+		if (timed == true)
+			semaphore.tryWaitFor(timeout);
+		else
+			semaphore.wait();
+		samples.add(getTimestamp() - start);
+	}
+
+	stopRequested = true;
+	postingThread.join();
+
+	char variant[24];
+	snprintf(variant, sizeof(variant), "%s,%zu", timed == true ? "timed" : "untimed", timerCount);
+	samples.print("waitRoundTrip", variant);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void timedWaitBenchmark()
+{
+	Samples samples {iterations};
+	for (const auto timerCount : timerCounts)
+	{
+		// started timer must not be moved, so the vector must not be reallocated
+		std::vector<DynamicSoftwareTimer> timers;
+		timers.reserve(timerCount);
+		for (size_t i {}; i < timerCount; ++i)
+		{
+			timers.emplace_back(emptyFunction);
+			timers.back().start(timeout / 2 + i * std::chrono::milliseconds{1});
+		}
+
+		measureRoundTrip(false, timerCount, samples);
+		measureRoundTrip(true, timerCount, samples);
+	}
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
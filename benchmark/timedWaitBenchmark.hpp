@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief timedWaitBenchmark() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_TIMEDWAITBENCHMARK_HPP_
+#define BENCHMARK_TIMEDWAITBENCHMARK_HPP_
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Measures cost of round trips of waits with and without timeout versus number of active software timers.
+ *
+ * Main thread waits on a semaphore, which is posted by a lower-priority thread, so each round trip consists of
+ * blocking of main thread, switch to posting thread, unblocking of main thread and switch back to main thread. Timed
+ * waits use Semaphore::tryWaitFor() with a timeout which is never reached, so the timeout is always cancelled. For each
+ * tested number of active software timers (which expire before the timeout, but still far in the future) two values
+ * are measured:
+ * - duration of a round trip with Semaphore::wait() - variant "untimed,<number of timers>";
+ * - duration of a round trip with Semaphore::tryWaitFor() - variant "timed,<number of timers>";
+ *
+ * Results are printed with Samples::print(), with "waitRoundTrip" as the name of benchmark.
+ */
+
+void timedWaitBenchmark();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_TIMEDWAITBENCHMARK_HPP_
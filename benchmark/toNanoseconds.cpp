@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief toNanoseconds() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "toNanoseconds.hpp"
+
+#include "distortos/architecture/getCycleCountFrequency.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::chrono::nanoseconds toNanoseconds(const uint64_t cycles)
+{
+	// integer and fractional parts of seconds are converted separately to prevent overflow
+	const auto frequency = architecture::getCycleCountFrequency();
+	return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(cycles / frequency * 1000000000 +
+			cycles % frequency * 1000000000 / frequency)};
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief toNanoseconds() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_TONANOSECONDS_HPP_
+#define BENCHMARK_TONANOSECONDS_HPP_
+
+#include <chrono>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/**
+ * \brief Converts difference of timestamps returned by getTimestamp() to nanoseconds.
+ *
+ * \param [in] cycles is the difference of timestamps that will be converted
+ *
+ * \return \a cycles converted to nanoseconds
+ */
+
+std::chrono::nanoseconds toNanoseconds(uint64_t cycles);
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_TONANOSECONDS_HPP_
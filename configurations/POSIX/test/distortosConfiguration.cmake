@@ -0,0 +1,324 @@
+#
+# \file
+# \brief distortos configuration
+#
+# \warning
+# Automatically generated file - do not edit!
+#
+
+if(DEFINED ENV{DISTORTOS_PATH})
+	set(DISTORTOS_PATH "$ENV{DISTORTOS_PATH}")
+else()
+	set(DISTORTOS_PATH "../")
+endif()
+
+set("CMAKE_BUILD_TYPE"
+		"RelWithDebInfo"
+		CACHE
+		"STRING"
+		"Choose the type of build, options are: None Debug Release RelWithDebInfo MinSizeRel ...")
+set("CMAKE_CXX_FLAGS"
+		"-fno-rtti -fno-exceptions -fno-threadsafe-statics -ffunction-sections -fdata-sections -Wall -Wextra -Wshadow"
+		CACHE
+		"STRING"
+		"Flags used by the CXX compiler during all build types.")
+set("CMAKE_CXX_FLAGS_DEBUG"
+		"-Og -g -ggdb3"
+		CACHE
+		"STRING"
+		"Flags used by the CXX compiler during DEBUG builds.")
+set("CMAKE_CXX_FLAGS_MINSIZEREL"
+		"-Os -DNDEBUG"
+		CACHE
+		"STRING"
+		"Flags used by the CXX compiler during MINSIZEREL builds.")
+set("CMAKE_CXX_FLAGS_RELEASE"
+		"-O2 -DNDEBUG"
+		CACHE
+		"STRING"
+		"Flags used by the CXX compiler during RELEASE builds.")
+set("CMAKE_CXX_FLAGS_RELWITHDEBINFO"
+		"-O2 -g -ggdb3 -DNDEBUG"
+		CACHE
+		"STRING"
+		"Flags used by the CXX compiler during RELWITHDEBINFO builds.")
+set("CMAKE_C_FLAGS"
+		"-ffunction-sections -fdata-sections -Wall -Wextra -Wshadow"
+		CACHE
+		"STRING"
+		"Flags used by the C compiler during all build types.")
+set("CMAKE_C_FLAGS_DEBUG"
+		"-Og -g -ggdb3"
+		CACHE
+		"STRING"
+		"Flags used by the C compiler during DEBUG builds.")
+set("CMAKE_C_FLAGS_MINSIZEREL"
+		"-Os -DNDEBUG"
+		CACHE
+		"STRING"
+		"Flags used by the C compiler during MINSIZEREL builds.")
+set("CMAKE_C_FLAGS_RELEASE"
+		"-O2 -DNDEBUG"
+		CACHE
+		"STRING"
+		"Flags used by the C compiler during RELEASE builds.")
+set("CMAKE_C_FLAGS_RELWITHDEBINFO"
+		"-O2 -g -ggdb3 -DNDEBUG"
+		CACHE
+		"STRING"
+		"Flags used by the C compiler during RELWITHDEBINFO builds.")
+set("CMAKE_EXE_LINKER_FLAGS"
+		"-Wl,--gc-sections -Wl,-z,now"
+		CACHE
+		"STRING"
+		"Flags used by the linker during all build types.")
+set("CMAKE_EXE_LINKER_FLAGS_DEBUG"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during DEBUG builds.")
+set("CMAKE_EXE_LINKER_FLAGS_MINSIZEREL"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during MINSIZEREL builds.")
+set("CMAKE_EXE_LINKER_FLAGS_RELEASE"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during RELEASE builds.")
+set("CMAKE_EXE_LINKER_FLAGS_RELWITHDEBINFO"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during RELWITHDEBINFO builds.")
+set("CMAKE_EXPORT_COMPILE_COMMANDS"
+		"ON"
+		CACHE
+		"UNINITIALIZED"
+		"No help, variable specified on the command line.")
+set("CMAKE_MODULE_LINKER_FLAGS"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of modules during all build types.")
+set("CMAKE_MODULE_LINKER_FLAGS_DEBUG"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of modules during DEBUG builds.")
+set("CMAKE_MODULE_LINKER_FLAGS_MINSIZEREL"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of modules during MINSIZEREL builds.")
+set("CMAKE_MODULE_LINKER_FLAGS_RELEASE"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of modules during RELEASE builds.")
+set("CMAKE_MODULE_LINKER_FLAGS_RELWITHDEBINFO"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of modules during RELWITHDEBINFO builds.")
+set("CMAKE_SHARED_LINKER_FLAGS"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of shared libraries during all build types.")
+set("CMAKE_SHARED_LINKER_FLAGS_DEBUG"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of shared libraries during DEBUG builds.")
+set("CMAKE_SHARED_LINKER_FLAGS_MINSIZEREL"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of shared libraries during MINSIZEREL builds.")
+set("CMAKE_SHARED_LINKER_FLAGS_RELEASE"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of shared libraries during RELEASE builds.")
+set("CMAKE_SHARED_LINKER_FLAGS_RELWITHDEBINFO"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of shared libraries during RELWITHDEBINFO builds.")
+set("CMAKE_STATIC_LINKER_FLAGS"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of static libraries during all build types.")
+set("CMAKE_STATIC_LINKER_FLAGS_DEBUG"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of static libraries during DEBUG builds.")
+set("CMAKE_STATIC_LINKER_FLAGS_MINSIZEREL"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of static libraries during MINSIZEREL builds.")
+set("CMAKE_STATIC_LINKER_FLAGS_RELEASE"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of static libraries during RELEASE builds.")
+set("CMAKE_STATIC_LINKER_FLAGS_RELWITHDEBINFO"
+		""
+		CACHE
+		"STRING"
+		"Flags used by the linker during the creation of static libraries during RELWITHDEBINFO builds.")
+set("CMAKE_TOOLCHAIN_FILE"
+		"${DISTORTOS_PATH}/source/board/POSIX/Toolchain-POSIX.cmake"
+		CACHE
+		"FILEPATH"
+		"The CMake toolchain file")
+set("CMAKE_VERBOSE_MAKEFILE"
+		"FALSE"
+		CACHE
+		"BOOL"
+		"If this value is on, makefiles will be generated without the .SILENT directive, and all commands will be echoed to the console during the make.  This is useful for debugging only. With Visual Studio IDE projects all commands are done without /nologo.")
+set("CONFIG_ARCHITECTURE_ASCENDING_STACK"
+		"OFF"
+		CACHE
+		"INTERNAL"
+		"")
+set("CONFIG_ARCHITECTURE_EMPTY_STACK"
+		"OFF"
+		CACHE
+		"INTERNAL"
+		"")
+set("CONFIG_ARCHITECTURE_POSIX"
+		"ON"
+		CACHE
+		"INTERNAL"
+		"")
+set("CONFIG_ARCHITECTURE_STACK_ALIGNMENT"
+		"16"
+		CACHE
+		"INTERNAL"
+		"")
+set("CONFIG_BOARD"
+		"POSIX"
+		CACHE
+		"INTERNAL"
+		"")
+set("distortos_Architecture_00_Stack_overhead"
+		"16384"
+		CACHE
+		"STRING"
+		"Size (in bytes) added to stack of each thread.\n\nCode compiled for the host uses much more stack than code compiled for a microcontroller. Context of each thread\n(ucontext_t), stack frames of signal handlers and stack frames of C library functions are also stored on the\nthread's stack. This value is added to stack size of each thread (including main thread), so that stack sizes\nselected for microcontrollers can be used without changes.\n\nAllowed range: [-2147483648; 2147483647]")
+set("distortos_Build_00_Static_destructors"
+		"OFF"
+		CACHE
+		"BOOL"
+		"Enable static destructors.\n\nEnable destructors for objects with static storage duration. As embedded applications almost never \"exit\",\nthese destructors are usually never executed, wasting ROM.")
+set("distortos_Checks_00_Context_of_functions"
+		"ON"
+		CACHE
+		"BOOL"
+		"Check context of functions.\n\nSome functions may only be used from thread context, as using them from interrupt context results in undefined\nbehaviour. There are several groups of functions to which this restriction applies (some functions fall into\nseveral categories at once):\n1. all blocking functions, like callOnce(), FifoQueue::push(), Semaphore::wait(), ..., as an attempt to block\ncurrent thread of execution (not to be confused with current thread) is not possible in interrupt context;\n2. all mutex functions, as the concept of ownership by a thread - core feature of mutex - cannot be fulfilled in\ninterrupt context;\n3. all functions from ThisThread namespace (including ThisThread::Signals namespace), as in interrupt context\nthey would access a random thread that happened to be executing at that particular moment;\n\nUsing such functions from interrupt context is a common bug in applications which can be easily introduced and\nvery hard to find, as the symptoms may appear only under certain circumstances.\n\nSelecting this option enables context checks in all functions with such requirements. If any of them is used\nfrom interrupt context, FATAL_ERROR() will be called.")
+set("distortos_Checks_01_Stack_pointer_range_during_context_switch"
+		"ON"
+		CACHE
+		"BOOL"
+		"Check stack pointer range during context switch.\n\nSimple range checking of preempted thread's stack pointer can be performed during context switches. It is\nrelatively fast, but cannot detect all stack overflows. The check is done before the software stack frame is\npushed on thread's stack, but the size of this pending stack frame is accounted for - the intent is to detect a\nstack overflow which is about to happen, before it can cause (further) data corrution. FATAL_ERROR() will be\ncalled if the stack pointer is outside valid range.")
+set("distortos_Checks_02_Stack_pointer_range_during_system_tick"
+		"ON"
+		CACHE
+		"BOOL"
+		"Check stack pointer range during system tick.\n\nSimilar to \"distortos_Checks_01_Stack_pointer_range_during_context_switch\", but executed during every system\ntick.")
+set("distortos_Checks_03_Stack_guard_contents_during_context_switch"
+		"ON"
+		CACHE
+		"BOOL"
+		"Check stack guard contents during context switch.\n\nSelecting this option extends stacks for all threads (including main() thread) with a \"stack guard\" at the\noverflow end. This \"stack guard\" - just as the whole stack - is filled with a sentinel value 0xed419f25 during\nthread initialization. The contents of \"stack guard\" of preempted thread are checked during each context\nswitch and if any byte has changed, FATAL_ERROR() will be called.\n\nThis method is slower than simple stack pointer range checking, but is able to detect stack overflows much more\nreliably. It is still sufficiently fast, assuming that the size of \"stack guard\" is reasonable.\n\nBe advised that uninitialized variables on stack which are larger than size of \"stack guard\" can create\n\"holes\" in the stack, thus circumventing this detection mechanism. This especially applies to arrays used as\nbuffers.")
+set("distortos_Checks_04_Stack_guard_contents_during_system_tick"
+		"ON"
+		CACHE
+		"BOOL"
+		"Check stack guard contents during system tick.\n\nSimilar to \"distortos_Checks_03_Stack_guard_contents_during_context_switch\", but executed during every system\ntick.")
+set("distortos_Checks_05_Stack_guard_size"
+		"8192"
+		CACHE
+		"STRING"
+		"Size (in bytes) of \"stack guard\".\n\nAny value which is not a multiple of stack alignment required by architecture, will be rounded up.\n\nWhen \"distortos_Checks_06_Stack_guard_protection\" is selected, see its description for minimal value.\n\nAllowed range: [1; 2147483647]")
+set("distortos_Checks_06_Stack_guard_protection"
+		"ON"
+		CACHE
+		"BOOL"
+		"Protect stack guard with hardware.\n\nSelecting this option extends stacks for all threads (including main() thread) with a \"stack guard\" at the\noverflow end, just like \"distortos_Checks_03_Stack_guard_contents_during_context_switch\". During each\ncontext switch a part of \"stack guard\" of the thread which is about to be executed is made read-only with\nhardware - MPU on ARMv6-M and ARMv7-M, memory pages protected with mprotect() on POSIX. Any write to this area\ncauses a fault immediately, so the overflow is detected before it can corrupt any other data. This check has\nconstant cost, which does not depend on the size of \"stack guard\", so checks of stack guard contents may\nbe disabled when this option is selected.\n\nProtected part of \"stack guard\" must be aligned to its size, which must be a power of two not smaller than\nthe granularity of hardware protection - 32 bytes for ARMv7-M MPU, 256 bytes for ARMv6-M MPU and 4096 bytes\n(size of memory page) for POSIX. \"stack guard\" must be large enough to contain such part regardless of its\nown alignment, so its size must be at least twice the granularity minus stack alignment required by\narchitecture - for example 64 bytes for ARMv7-M and 8192 bytes for POSIX. The largest part which fits is\nprotected. Depending on the alignment of stack, a small unprotected part of \"stack guard\" may remain between\nthe protected part and the stack - it is still covered by checks of stack guard contents, if these are enabled.\n\nBe advised that uninitialized variables on stack which are larger than the protected part can still create\n\"holes\" in the stack, thus circumventing this detection mechanism.")
+set("distortos_Checks_07_Poisoning_of_memory_pool_blocks"
+		"ON"
+		CACHE
+		"BOOL"
+		"Poison blocks of memory pools.\n\nSelecting this option fills contents of each block of MemoryPool with a pattern (0xdd) when the block is\ndeallocated. When the block is allocated again, the pattern is verified - any difference means that the block\nwas written after it was deallocated, which is reported with FATAL_ERROR(). Allocated blocks are filled with\nanother pattern (0xcd), which makes use of uninitialized memory easier to spot. Cost of this check is\nproportional to the size of block.")
+set("distortos_Scheduler_00_Tick_frequency"
+		"1000"
+		CACHE
+		"STRING"
+		"System's tick frequency, Hz.\n\nAllowed range: [1; 2147483647]")
+set("distortos_Scheduler_01_Round_robin_frequency"
+		"10"
+		CACHE
+		"STRING"
+		"Round-robin frequency, Hz.\n\nAllowed range: [1; 1000]")
+set("distortos_Scheduler_02_Support_for_signals"
+		"ON"
+		CACHE
+		"BOOL"
+		"Enable support for signals.\n\nEnable namespaces, functions and classes related to signals:\n- ThisThread::Signals namespace;\n- Thread::generateSignal();\n- Thread::getPendingSignalSet();\n- Thread::queueSignal();\n- DynamicSignalsReceiver class;\n- SignalInformationQueueWrapper class;\n- SignalsCatcher class;\n- SignalsReceiver class;\n- StaticSignalsReceiver class;\n\nWhen this options is not selected, these namespaces, functions and classes are not available at all.")
+set("distortos_Scheduler_03_Support_for_thread_detachment"
+		"ON"
+		CACHE
+		"BOOL"
+		"Enable support for thread detachment.\n\nEnable functions that \"detach\" dynamic threads:\n- ThisThread::detach();\n- Thread::detach();\n\nWhen this options is not selected, these functions are not available at all.\n\nWhen dynamic and detached thread terminates, it will be added to the global list of threads pending for deferred\ndeletion. The thread will actually be deleted in idle thread, but only when two mutexes are successfully locked:\n- mutex that protects dynamic memory allocator;\n- mutex that synchronizes access to the list of threads pending for deferred deletion;")
+set("distortos_Scheduler_04_Main_thread_stack_size"
+		"262144"
+		CACHE
+		"STRING"
+		"Size (in bytes) of stack used by thread with main() function.\n\nAllowed range: [1; 2147483647]")
+set("distortos_Scheduler_05_Main_thread_priority"
+		"127"
+		CACHE
+		"STRING"
+		"Initial priority of main thread.\n\nAllowed range: [1; 255]")
+set("distortos_Scheduler_06_Reception_of_signals_by_main_thread"
+		"ON"
+		CACHE
+		"BOOL"
+		"Enable reception of signals for main thread.")
+set("distortos_Scheduler_07_Queued_signals_for_main_thread"
+		"8"
+		CACHE
+		"STRING"
+		"Maximal number of queued signals for main thread. 0 disables queuing of signals for main thread.\n\nAllowed range: [-2147483648; 2147483647]")
+set("distortos_Scheduler_08_SignalAction_objects_for_main_thread"
+		"8"
+		CACHE
+		"STRING"
+		"Maximal number of different SignalAction objects for main thread. 0 disables catching of signals for main thread.\n\nAllowed range: [-2147483648; 32]")
+set("distortos_Scheduler_13_Trace"
+		"ON"
+		CACHE
+		"BOOL"
+		"Enable scheduler event trace.\n\nCompact timestamped records of scheduler events (context switches, blocking and unblocking of threads, mutex\nlock operations, queue operations, expiration of software timers and interrupts) are stored in a ring buffer in\nRAM. Contents of the buffer can be dumped with trace::dump() and converted to a timeline with\nscripts/decodeTrace.py. When disabled, all trace points are compiled out.")
+set("distortos_Scheduler_14_Trace_buffer_size"
+		"1024"
+		CACHE
+		"STRING"
+		"Number of records in trace ring buffer.\n\nEach record uses 16 bytes of RAM. When the buffer is full, oldest records are overwritten.\n\nAllowed range: [1; 2147483647]")
+set("distortos_Scheduler_15_Budgets_of_thread_groups"
+		"ON"
+		CACHE
+		"BOOL"
+		"Enable budgets of thread groups.\n\nThreads can be moved to ThreadGroup objects, each of which may limit CPU time used by its threads to given\nnumber of ticks per replenishment period. Budget is consumed by system ticks in which threads of the group were\nrunning. When the budget is exhausted, all threads of the group are demoted to priority 0 until the budget is\nreplenished, which isolates groups of threads from each other.")
+set("distortos_Scheduler_16_Priority_buckets_of_message_queues"
+		"ON"
+		CACHE
+		"BOOL"
+		"Use priority buckets for elements of message queues.\n\nAvailable elements of each message queue are kept in FIFO buckets - one for each of 256 priorities - and\nnon-empty buckets are tracked with a bitmap, so pushing an element is done in constant time, regardless of the\nnumber and priorities of elements already in the queue. Each message queue uses additional 1 kB of RAM (on\n32-bit architectures) for that purpose. When this option is disabled, available elements are kept on a single\nsorted list, so the cost of pushing an element is proportional to the number of elements with equal or higher\npriority.")
@@ -45,6 +45,9 @@ struct distortos_ConditionVariable
 {
 	/** ThreadControlBlock objects blocked on this condition variable */
 	struct estd_IntrusiveList blockedList;
+
+	/** pointer to mutex used by threads blocked on this condition variable */
+	void* mutex;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -59,7 +62,7 @@ struct distortos_ConditionVariable
  * \param [in] self is an equivalent of `this` hidden argument
  */
 
-#define DISTORTOS_CONDITIONVARIABLE_INITIALIZER(self)	{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList)}
+#define DISTORTOS_CONDITIONVARIABLE_INITIALIZER(self)	{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), NULL}
 
 /**
  * \brief C-API equivalent of distortos::ConditionVariable's constructor
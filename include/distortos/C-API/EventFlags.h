@@ -0,0 +1,297 @@
+/**
+ * \file
+ * \brief Header of C-API for distortos::EventFlags
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_C_API_EVENTFLAGS_H_
+#define INCLUDE_DISTORTOS_C_API_EVENTFLAGS_H_
+
+#include "estd/C-API/IntrusiveList.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif	/* def __cplusplus */
+
+/**
+ * \addtogroup eventFlagsCApi
+ * \{
+ */
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags
+ *
+ * \sa distortos::EventFlags
+ */
+
+struct distortos_EventFlags
+{
+	/** list of threads waiting for flags */
+	struct estd_IntrusiveList waiterList;
+
+	/** observers attached to the event flags */
+	struct estd_IntrusiveList observerList;
+
+	/** current value of flags */
+	uint32_t value;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+enum
+{
+	/** wait is satisfied when any of flags selected by bitmask is set */
+	distortos_EventFlags_WaitMode_any,
+	/** wait is satisfied when all flags selected by bitmask are set */
+	distortos_EventFlags_WaitMode_all,
+	/** same as distortos_EventFlags_WaitMode_any, flags selected by bitmask are cleared when the wait is satisfied */
+	distortos_EventFlags_WaitMode_anyClear,
+	/** same as distortos_EventFlags_WaitMode_all, flags selected by bitmask are cleared when the wait is satisfied */
+	distortos_EventFlags_WaitMode_allClear
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global defines
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Initializer for distortos_EventFlags
+ *
+ * \sa distortos::EventFlags::EventFlags()
+ *
+ * \param [in] self is an equivalent of `this` hidden argument
+ * \param [in] value is the initial value of flags
+ */
+
+#define DISTORTOS_EVENTFLAGS_INITIALIZER(self, value) \
+		{ESTD_INTRUSIVELIST_INITIALIZER((self).waiterList), ESTD_INTRUSIVELIST_INITIALIZER((self).observerList), \
+				(value)}
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags's constructor
+ *
+ * \sa distortos::EventFlags::EventFlags()
+ *
+ * \param [in] name is the name of the object that will be instantiated
+ * \param [in] value is the initial value of flags
+ */
+
+#define DISTORTOS_EVENTFLAGS_CONSTRUCT_1(name, value) \
+		struct distortos_EventFlags name = DISTORTOS_EVENTFLAGS_INITIALIZER(name, value)
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags's constructor, value == 0
+ *
+ * \sa distortos::EventFlags::EventFlags()
+ *
+ * \param [in] name is the name of the object that will be instantiated
+ */
+
+#define DISTORTOS_EVENTFLAGS_CONSTRUCT(name)	DISTORTOS_EVENTFLAGS_CONSTRUCT_1(name, 0)
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags's constructor
+ *
+ * \sa distortos::EventFlags::EventFlags()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] value is the initial value of flags
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a eventFlags is invalid;
+ */
+
+int distortos_EventFlags_construct_1(struct distortos_EventFlags* eventFlags, uint32_t value);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags's constructor, value == 0
+ *
+ * \sa distortos::EventFlags::EventFlags()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a eventFlags is invalid;
+ */
+
+static inline int distortos_EventFlags_construct(struct distortos_EventFlags* const eventFlags)
+{
+	return distortos_EventFlags_construct_1(eventFlags, 0);
+}
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags's destructor
+ *
+ * \sa distortos::EventFlags::~EventFlags()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a eventFlags is invalid;
+ */
+
+int distortos_EventFlags_destruct(struct distortos_EventFlags* eventFlags);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::clear()
+ *
+ * \sa distortos::EventFlags::clear()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] bitmask is the bitmask with flags that will be cleared
+ * \param [out] previousValue is a pointer to variable into which value of flags before they were cleared will be
+ * written, may be NULL
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a eventFlags is invalid;
+ */
+
+int distortos_EventFlags_clear(struct distortos_EventFlags* eventFlags, uint32_t bitmask, uint32_t* previousValue);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::get()
+ *
+ * \sa distortos::EventFlags::get()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [out] value is a pointer to variable into which current value of flags will be written
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a eventFlags and/or \a value are invalid;
+ */
+
+int distortos_EventFlags_get(const struct distortos_EventFlags* eventFlags, uint32_t* value);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::set()
+ *
+ * \sa distortos::EventFlags::set()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] bitmask is the bitmask with flags that will be set
+ * \param [out] previousValue is a pointer to variable into which value of flags before they were set will be written,
+ * may be NULL
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a eventFlags is invalid;
+ */
+
+int distortos_EventFlags_set(struct distortos_EventFlags* eventFlags, uint32_t bitmask, uint32_t* previousValue);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::tryWait()
+ *
+ * \sa distortos::EventFlags::tryWait()
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] bitmask is the bitmask with flags that will be waited for
+ * \param [in] waitMode is the mode of wait, {distortos_EventFlags_WaitMode_any, distortos_EventFlags_WaitMode_all,
+ * distortos_EventFlags_WaitMode_anyClear, distortos_EventFlags_WaitMode_allClear}
+ * \param [out] value is a pointer to variable into which value of flags will be written - the one which satisfied the
+ * wait (before optional clearing) on success, current one otherwise, may be NULL
+ *
+ * \return 0 on success, error code otherwise:
+ * - EAGAIN - wait is not satisfied by current value of flags;
+ * - EINVAL - \a eventFlags and/or \a bitmask and/or \a waitMode are invalid;
+ */
+
+int distortos_EventFlags_tryWait(struct distortos_EventFlags* eventFlags, uint32_t bitmask, uint8_t waitMode,
+		uint32_t* value);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::tryWaitFor()
+ *
+ * \sa distortos::EventFlags::tryWaitFor()
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] duration is the duration in system ticks after which the wait will be terminated without success
+ * \param [in] bitmask is the bitmask with flags that will be waited for
+ * \param [in] waitMode is the mode of wait, {distortos_EventFlags_WaitMode_any, distortos_EventFlags_WaitMode_all,
+ * distortos_EventFlags_WaitMode_anyClear, distortos_EventFlags_WaitMode_allClear}
+ * \param [out] value is a pointer to variable into which value of flags will be written - the one which satisfied the
+ * wait (before optional clearing) on success, current one otherwise, may be NULL
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a eventFlags and/or \a bitmask and/or \a waitMode are invalid;
+ * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+ */
+
+int distortos_EventFlags_tryWaitFor(struct distortos_EventFlags* eventFlags, int64_t duration, uint32_t bitmask,
+		uint8_t waitMode, uint32_t* value);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::tryWaitUntil()
+ *
+ * \sa distortos::EventFlags::tryWaitUntil()
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] timePoint is the time point in system ticks at which the wait will be terminated without success
+ * \param [in] bitmask is the bitmask with flags that will be waited for
+ * \param [in] waitMode is the mode of wait, {distortos_EventFlags_WaitMode_any, distortos_EventFlags_WaitMode_all,
+ * distortos_EventFlags_WaitMode_anyClear, distortos_EventFlags_WaitMode_allClear}
+ * \param [out] value is a pointer to variable into which value of flags will be written - the one which satisfied the
+ * wait (before optional clearing) on success, current one otherwise, may be NULL
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a eventFlags and/or \a bitmask and/or \a waitMode are invalid;
+ * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+ */
+
+int distortos_EventFlags_tryWaitUntil(struct distortos_EventFlags* eventFlags, int64_t timePoint, uint32_t bitmask,
+		uint8_t waitMode, uint32_t* value);
+
+/**
+ * \brief C-API equivalent of distortos::EventFlags::wait()
+ *
+ * \sa distortos::EventFlags::wait()
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] eventFlags is a pointer to distortos_EventFlags object
+ * \param [in] bitmask is the bitmask with flags that will be waited for
+ * \param [in] waitMode is the mode of wait, {distortos_EventFlags_WaitMode_any, distortos_EventFlags_WaitMode_all,
+ * distortos_EventFlags_WaitMode_anyClear, distortos_EventFlags_WaitMode_allClear}
+ * \param [out] value is a pointer to variable into which value of flags will be written - the one which satisfied the
+ * wait (before optional clearing) on success, current one otherwise, may be NULL
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a eventFlags and/or \a bitmask and/or \a waitMode are invalid;
+ */
+
+int distortos_EventFlags_wait(struct distortos_EventFlags* eventFlags, uint32_t bitmask, uint8_t waitMode,
+		uint32_t* value);
+
+/**
+ * \}
+ */
+
+#ifdef __cplusplus
+}	/* extern "C" */
+#endif	/* def __cplusplus */
+
+#endif	/* INCLUDE_DISTORTOS_C_API_EVENTFLAGS_H_ */
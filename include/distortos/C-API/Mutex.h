@@ -48,7 +48,7 @@ struct distortos_Mutex
 	/** ThreadControlBlock objects blocked on mutex */
 	struct estd_IntrusiveList blockedList;
 
-	/** owner of the mutex */
+	/** owner of the mutex combined with "contended" flag */
 	void* owner;
 
 	/** number of recursive locks, used when mutex type is recursive */
@@ -57,6 +57,9 @@ struct distortos_Mutex
 	/** priority ceiling of mutex, valid only when protocol_ == Protocol::priorityProtect */
 	uint8_t priorityCeiling;
 
+	/** cached "boosted priority" of the mutex, priority ceiling when protocol_ == Protocol::priorityProtect */
+	uint8_t boostedPriority;
+
 	/** type of mutex and its protocol */
 	uint8_t typeProtocol;
 };
@@ -117,7 +120,7 @@ enum
 
 #define DISTORTOS_MUTEX_INITIALIZER(self, type, protocol, priorityCeiling) \
 		{ESTD_INTRUSIVELISTNODE_INITIALIZER((self).node), ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), \
-		NULL, 0, (priorityCeiling), \
+		NULL, 0, (priorityCeiling), (protocol) == distortos_Mutex_Protocol_priorityProtect ? (priorityCeiling) : 0, \
 		(uint8_t)(((type) == distortos_Mutex_Type_normal || (type) == distortos_Mutex_Type_errorChecking || \
 				(type) == distortos_Mutex_Type_recursive ? \
 				(uint8_t)(type) : (uint8_t)distortos_Mutex_Type_normal) << distortos_Mutex_typeShift | \
@@ -44,11 +44,17 @@ struct distortos_Semaphore
 	/** ThreadControlBlock objects blocked on this semaphore */
 	struct estd_IntrusiveList blockedList;
 
+	/** observers attached to this semaphore */
+	struct estd_IntrusiveList observerList;
+
 	/** internal value of the semaphore */
 	unsigned int value;
 
 	/** max value of the semaphore */
 	unsigned int maxValue;
+
+	/** true if any thread may be blocked on the semaphore or any observer may be attached to it */
+	uint8_t waiting;
 };
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -67,7 +73,8 @@ struct distortos_Semaphore
  */
 
 #define DISTORTOS_SEMAPHORE_INITIALIZER(self, value, maxValue) \
-		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), (value) < (maxValue) ? (value) : (maxValue), (maxValue)}
+		{ESTD_INTRUSIVELIST_INITIALIZER((self).blockedList), ESTD_INTRUSIVELIST_INITIALIZER((self).observerList), \
+				(value) < (maxValue) ? (value) : (maxValue), (maxValue), 0}
 
 /**
  * \brief C-API equivalent of distortos::Semaphore's constructor
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,11 @@ class Mutex;
  * Similar to std::condition_variable - http://en.cppreference.com/w/cpp/thread/condition_variable
  * Similar to POSIX pthread_cond_t
  *
+ * Condition variable remembers the mutex used by waiting threads. If this mutex uses MutexProtocol::none, notifyAll()
+ * and notifyOne() perform "wait morphing" - waiting threads are moved directly to the list of threads blocked on the
+ * mutex (or the first one gets the lock if the mutex is unlocked), so they don't wake up only to block on the mutex
+ * again.
+ *
  * \ingroup synchronization
  */
 
@@ -45,7 +50,8 @@ public:
 	 */
 
 	constexpr ConditionVariable() :
-			blockedList_{}
+			blockedList_{},
+			mutex_{}
 	{
 
 	}
@@ -302,8 +308,22 @@ public:
 
 private:
 
+	/**
+	 * \brief Notifies first waiting thread.
+	 *
+	 * The thread is taken over by the mutex used by waiting threads or - if this is not possible - unblocked.
+	 *
+	 * \attention must be called with interrupts masked and with at least one waiting thread
+	 */
+
+	void notifyFirst();
+
 	/// ThreadControlBlock objects blocked on this condition variable
 	internal::ThreadList blockedList_;
+
+	/// pointer to mutex used by threads blocked on this condition variable, nullptr if it is not known or if waiting
+	/// threads use different mutexes
+	Mutex* mutex_;
 };
 
 template<typename Predicate>
@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \brief DynamicMemoryPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICMEMORYPOOL_HPP_
+
+#include "distortos/MemoryPool.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicMemoryPool class is a variant of MemoryPool that has dynamic storage for blocks.
+ *
+ * Storage for all blocks is allocated from the heap only once - in the constructor.
+ *
+ * \ingroup synchronization
+ */
+
+class DynamicMemoryPool : public MemoryPool
+{
+public:
+
+	/**
+	 * \brief DynamicMemoryPool's constructor
+	 *
+	 * \param [in] blockSize is the size of single block, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 */
+
+	DynamicMemoryPool(size_t blockSize, size_t blocks);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICMEMORYPOOL_HPP_
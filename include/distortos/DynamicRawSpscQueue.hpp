@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \brief DynamicRawSpscQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICRAWSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICRAWSPSCQUEUE_HPP_
+
+#include "RawSpscQueue.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicRawSpscQueue class is a variant of RawSpscQueue that has dynamic storage for queue's contents.
+ *
+ * \ingroup queues
+ */
+
+class DynamicRawSpscQueue : public RawSpscQueue
+{
+public:
+
+	/**
+	 * \brief DynamicRawSpscQueue's constructor
+	 *
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 * \param [in] wakeThreshold is the number of elements which must be available to wake consumer waiting for empty
+	 * queue, default - 1
+	 */
+
+	DynamicRawSpscQueue(size_t elementSize, size_t queueSize, size_t wakeThreshold = 1);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICRAWSPSCQUEUE_HPP_
@@ -0,0 +1,44 @@
+/**
+ * \file
+ * \brief DynamicStackPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICSTACKPOOL_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICSTACKPOOL_HPP_
+
+#include "distortos/StackPool.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicStackPool class is a variant of StackPool that has dynamic storage for blocks.
+ *
+ * Storage for all blocks is allocated from the heap only once - in the constructor.
+ *
+ * \ingroup threads
+ */
+
+class DynamicStackPool : public StackPool
+{
+public:
+
+	/**
+	 * \brief DynamicStackPool's constructor
+	 *
+	 * \param [in] stackSize is the size of stack of threads using blocks of the pool, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 */
+
+	DynamicStackPool(size_t stackSize, size_t blocks);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICSTACKPOOL_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThread class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -53,8 +53,14 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThread(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args);
+	DynamicThread(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
+			const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+			Function&& function, Args&&... args) :
+			DynamicThread{DynamicThreadParameters{stackSize, canReceiveSignals, queuedSignals, signalActions, priority,
+					schedulingPolicy}, std::forward<Function>(function), std::forward<Args>(args)...}
+	{
+
+	}
 
 	/**
 	 * \brief DynamicThread's constructor
@@ -68,13 +74,7 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThread(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
-			DynamicThread{parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
-					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
-					std::forward<Function>(function), std::forward<Args>(args)...}
-	{
-
-	}
+	DynamicThread(const DynamicThreadParameters parameters, Function&& function, Args&&... args);
 
 	/**
 	 * \brief DynamicThread's destructor
@@ -123,6 +123,12 @@ public:
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+	/**
+	 * \return number of deadline misses of thread
+	 */
+
+	uint32_t getDeadlineMissCount() const override;
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -160,6 +166,16 @@ public:
 
 	uint8_t getPriority() const override;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return total run time of thread, excluding time spent in tick interrupt handler
+	 */
+
+	std::chrono::nanoseconds getRunTime() const override;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -253,7 +269,7 @@ public:
 	 * This operation can be performed on threads in "created" state only.
 	 *
 	 * \return 0 on success, error code otherwise:
-	 * - EINVAL - internal thread object was detached;
+	 * - EINVAL - internal thread object was detached or could not be allocated from stack pool;
 	 * - error codes returned by internal::DynamicThreadBase::start();
 	 */
 
@@ -394,11 +410,9 @@ DynamicThread makeAndStartDynamicThread(const DynamicThreadParameters parameters
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 template<typename Function, typename... Args>
-DynamicThread::DynamicThread(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
-		Function&& function, Args&&... args) :
-		detachableThread_{new internal::DynamicThreadBase{stackSize, canReceiveSignals, queuedSignals, signalActions,
-				priority, schedulingPolicy, *this, std::forward<Function>(function), std::forward<Args>(args)...}}
+DynamicThread::DynamicThread(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
+		detachableThread_{new (parameters.stackPool) internal::DynamicThreadBase{parameters, *this,
+				std::forward<Function>(function), std::forward<Args>(args)...}}
 {
 
 }
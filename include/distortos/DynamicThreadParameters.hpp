@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadParameters class header
  *
- * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_DYNAMICTHREADPARAMETERS_HPP_
 
 #include "distortos/SchedulingPolicy.hpp"
+#include "distortos/StackPool.hpp"
 
 #include <cstddef>
 
@@ -51,6 +52,7 @@ struct DynamicThreadParameters
 					queuedSignals{queuedSignalss},
 					signalActions{signalActionss},
 					stackSize{stackSizee},
+					stackPool{},
 					canReceiveSignals{canReceiveSignalss},
 					priority{priorityy},
 					schedulingPolicy{schedulingPolicyy}
@@ -73,6 +75,55 @@ struct DynamicThreadParameters
 
 	}
 
+	/**
+	 * \brief DynamicThreadParameters's constructor
+	 *
+	 * Size of stack is equal to the size of stack of threads using blocks of \a stackPooll.
+	 *
+	 * \param [in] stackPooll is a reference to StackPool object from which the stack (and - if thread detachment is
+	 * enabled - internal thread object) will be allocated
+	 * \param [in] canReceiveSignalss selects whether reception of signals is enabled (true) or disabled (false) for
+	 * this thread
+	 * \param [in] queuedSignalss is the max number of queued signals for this thread, relevant only if
+	 * \a canReceiveSignals == true, 0 to disable queuing of signals for this thread
+	 * \param [in] signalActionss is the max number of different SignalAction objects for this thread, relevant only if
+	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
+	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 */
+
+	DynamicThreadParameters(StackPool& stackPooll, const bool canReceiveSignalss, const size_t queuedSignalss,
+			const size_t signalActionss, const uint8_t priorityy,
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
+					queuedSignals{queuedSignalss},
+					signalActions{signalActionss},
+					stackSize{stackPooll.getStackSize()},
+					stackPool{&stackPooll},
+					canReceiveSignals{canReceiveSignalss},
+					priority{priorityy},
+					schedulingPolicy{schedulingPolicyy}
+	{
+
+	}
+
+	/**
+	 * \brief DynamicThreadParameters's constructor
+	 *
+	 * Size of stack is equal to the size of stack of threads using blocks of \a stackPooll.
+	 *
+	 * \param [in] stackPooll is a reference to StackPool object from which the stack (and - if thread detachment is
+	 * enabled - internal thread object) will be allocated
+	 * \param [in] priorityy is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicyy is the scheduling policy of the thread, default - SchedulingPolicy::roundRobin
+	 */
+
+	DynamicThreadParameters(StackPool& stackPooll, const uint8_t priorityy,
+			const SchedulingPolicy schedulingPolicyy = SchedulingPolicy::roundRobin) :
+					DynamicThreadParameters{stackPooll, false, 0, 0, priorityy, schedulingPolicyy}
+	{
+
+	}
+
 	/// max number of queued signals for this thread, relevant only if \a canReceiveSignals == true, 0 to disable
 	/// queuing of signals for this thread
 	size_t queuedSignals;
@@ -84,6 +135,13 @@ struct DynamicThreadParameters
 	/// size of stack, bytes
 	size_t stackSize;
 
+	/// pointer to StackPool object from which the stack (and - if thread detachment is enabled - internal thread object)
+	/// will be allocated, nullptr to allocate them from the heap; if blocks of the pool are too small for \a stackSize,
+	/// then DynamicThread::start() fails with ENOSPC; if the pool has no free blocks, then DynamicThread::start() fails
+	/// with EINVAL if thread detachment is enabled (internal thread object could not be created) or with ENOSPC
+	/// otherwise
+	StackPool* stackPool;
+
 	/// selects whether reception of signals is enabled (true) or disabled (false) for this thread
 	bool canReceiveSignals;
 
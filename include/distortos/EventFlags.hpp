@@ -0,0 +1,341 @@
+/**
+ * \file
+ * \brief EventFlags class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+#define INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+
+#include "distortos/internal/synchronization/SemaphoreObserver.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+}	// namespace internal
+
+/**
+ * \brief EventFlags is a synchronization primitive with a set of binary flags, which threads may wait for.
+ *
+ * Flags can be set and cleared from thread and interrupt context. Threads can wait until any or all flags selected by
+ * a bitmask are set, optionally clearing these flags when the wait is satisfied. Single set() which satisfies several
+ * waiting threads unblocks all of them in one pass over the list of waiting threads, with interrupts masked only once.
+ * All waiting threads which are satisfied by given set() get the same value of flags - flags cleared on exit by any of
+ * them are cleared after all waiting threads were checked.
+ *
+ * \ingroup synchronization
+ */
+
+class EventFlags
+{
+public:
+
+	/// type used for value of flags
+	using Value = uint32_t;
+
+	/// mode of wait
+	enum class WaitMode : uint8_t
+	{
+		/// wait is satisfied when any of flags selected by bitmask is set
+		any,
+		/// wait is satisfied when all flags selected by bitmask are set
+		all,
+		/// same as WaitMode::any, flags selected by bitmask are cleared when the wait is satisfied
+		anyClear,
+		/// same as WaitMode::all, flags selected by bitmask are cleared when the wait is satisfied
+		allClear,
+	};
+
+	/**
+	 * \brief EventFlags's constructor
+	 *
+	 * \param [in] value is the initial value of flags, default - all flags cleared
+	 */
+
+	constexpr explicit EventFlags(const Value value = {}) :
+			waiterList_{},
+			observerList_{},
+			value_{value}
+	{
+
+	}
+
+	/**
+	 * \brief EventFlags's destructor
+	 *
+	 * It is safe to destroy event flags upon which no threads are currently waiting. The effect of destroying event
+	 * flags upon which other threads are currently waiting is system error.
+	 */
+
+	~EventFlags() = default;
+
+	/**
+	 * \brief Attaches observer to the event flags.
+	 *
+	 * The observer is notified - and detached - by the first set(). Notification only means that the value of flags
+	 * could have changed, so the observer must check the value of flags and attach itself again if needed. If the
+	 * observer is already attached to any object, it is detached from it first.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] observer is a reference to observer which will be attached
+	 */
+
+	void attach(internal::SemaphoreObserver& observer);
+
+	/**
+	 * \brief Clears flags.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask with flags that will be cleared
+	 *
+	 * \return value of flags before they were cleared
+	 */
+
+	Value clear(Value bitmask);
+
+	/**
+	 * \return current value of flags
+	 */
+
+	Value get() const
+	{
+		return value_;
+	}
+
+	/**
+	 * \brief Sets flags.
+	 *
+	 * All threads which wait for flags and whose wait is satisfied by new value of flags are unblocked. Flags which are
+	 * cleared on exit by these threads are cleared after all waiting threads were checked. Afterwards all observers
+	 * attached to the event flags are notified and detached.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask with flags that will be set
+	 *
+	 * \return value of flags before they were set
+	 */
+
+	Value set(Value bitmask);
+
+	/**
+	 * \brief Tries to wait for flags.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EAGAIN - wait is not satisfied by current value of flags;
+	 * - EINVAL - \a bitmask is zero;
+	 */
+
+	std::pair<int, Value> tryWait(Value bitmask, WaitMode waitMode);
+
+	/**
+	 * \brief Tries to wait for flags for given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without success
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitFor(TickClock::duration duration, Value bitmask, WaitMode waitMode);
+
+	/**
+	 * \brief Tries to wait for flags for given duration of time.
+	 *
+	 * Template variant of tryWaitFor(TickClock::duration duration, Value bitmask, WaitMode waitMode).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without success
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Value> tryWaitFor(const std::chrono::duration<Rep, Period> duration, const Value bitmask,
+			const WaitMode waitMode)
+	{
+		return tryWaitFor(std::chrono::duration_cast<TickClock::duration>(duration), bitmask, waitMode);
+	}
+
+	/**
+	 * \brief Tries to wait for flags until given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without success
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitUntil(TickClock::time_point timePoint, Value bitmask, WaitMode waitMode);
+
+	/**
+	 * \brief Tries to wait for flags until given time point.
+	 *
+	 * Template variant of tryWaitUntil(TickClock::time_point timePoint, Value bitmask, WaitMode waitMode).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without success
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - the wait was not satisfied before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Value> tryWaitUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Value bitmask, const WaitMode waitMode)
+	{
+		return tryWaitUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), bitmask, waitMode);
+	}
+
+	/**
+	 * \brief Waits for flags.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 */
+
+	std::pair<int, Value> wait(Value bitmask, WaitMode waitMode);
+
+	EventFlags(const EventFlags&) = delete;
+	EventFlags(EventFlags&&) = delete;
+	const EventFlags& operator=(const EventFlags&) = delete;
+	EventFlags& operator=(EventFlags&&) = delete;
+
+private:
+
+	/// Waiter struct holds parameters and result of wait of one thread
+	struct Waiter
+	{
+		/**
+		 * \brief Waiter's constructor
+		 *
+		 * \param [in] threadControlBlockk is a reference to ThreadControlBlock of waiting thread
+		 * \param [in] bitmaskk is the bitmask with flags that are waited for
+		 * \param [in] waitModee is the mode of wait
+		 */
+
+		constexpr Waiter(internal::ThreadControlBlock& threadControlBlockk, const Value bitmaskk,
+				const WaitMode waitModee) :
+				node{},
+				threadControlBlock{threadControlBlockk},
+				bitmask{bitmaskk},
+				value{},
+				waitMode{waitModee}
+		{
+
+		}
+
+		/// node for intrusive list
+		estd::IntrusiveListNode node;
+
+		/// reference to ThreadControlBlock of waiting thread
+		internal::ThreadControlBlock& threadControlBlock;
+
+		/// bitmask with flags that are waited for
+		const Value bitmask;
+
+		/// value of flags which satisfied the wait
+		Value value;
+
+		/// mode of wait
+		const WaitMode waitMode;
+	};
+
+	/// type of list of waiters
+	using WaiterList = estd::IntrusiveList<Waiter, &Waiter::node>;
+
+	/**
+	 * \brief Implementation of wait(), tryWait(), tryWaitFor() and tryWaitUntil().
+	 *
+	 * \param [in] bitmask is the bitmask with flags that will be waited for
+	 * \param [in] waitMode is the mode of wait
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode
+	 * is selected, nullptr to block without timeout
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags - the one which satisfied
+	 * the wait (before optional clearing) on success, current one otherwise; error codes:
+	 * - EAGAIN - wait is not satisfied by current value of flags and non-blocking mode was selected;
+	 * - EINVAL - \a bitmask is zero;
+	 * - error codes returned by internal::Scheduler::block() (for blocking mode without timeout) /
+	 * internal::Scheduler::blockUntil() (for blocking mode with timeout);
+	 */
+
+	std::pair<int, Value> waitImplementation(Value bitmask, WaitMode waitMode, bool nonBlocking,
+			const TickClock::time_point* timePoint);
+
+	/// list of threads waiting for flags
+	WaiterList waiterList_;
+
+	/// observers attached to the event flags
+	internal::SemaphoreObserverList observerList_;
+
+	/// current value of flags
+	Value value_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
@@ -0,0 +1,164 @@
+/**
+ * \file
+ * \brief Executor class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EXECUTOR_HPP_
+#define INCLUDE_DISTORTOS_EXECUTOR_HPP_
+
+#include "distortos/ExecutorTask.hpp"
+
+#include "estd/SortedIntrusiveList.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief Executor class runs many ExecutorTask objects cooperatively in single thread.
+ *
+ * Tasks which are ready are resumed one after another, in the order in which they became ready. When no task is ready,
+ * the thread which runs the executor blocks on a semaphore until a task is notified by the semaphore or the queue which
+ * it waits for, or until the earliest time point at which a sleeping task should be resumed. All tasks share the stack
+ * of this thread and switching between them requires no context switch of the kernel.
+ *
+ * This class provides only the "run" function - the thread which executes it is provided by the user, for example:
+ *
+ *     Executor executor;
+ *     // ... add tasks ...
+ *     auto thread = makeAndStartStaticThread<1024>(1, &Executor::run, &executor);
+ *
+ * \ingroup executors
+ */
+
+class Executor
+{
+	friend class ExecutorTask;
+
+public:
+
+	/**
+	 * \brief Executor's constructor
+	 */
+
+	constexpr Executor() :
+			readyList_{},
+			sleepingList_{},
+			semaphore_{0, 1},
+			activeTasks_{}
+	{
+
+	}
+
+	/**
+	 * \brief Executor's destructor
+	 *
+	 * \warning All tasks added to the executor must be finished before the executor is destroyed.
+	 */
+
+	~Executor();
+
+	/**
+	 * \brief Adds task to the executor.
+	 *
+	 * The task is started from the beginning of its ExecutorTask::run() function.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] task is a reference to added task
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - task is already active;
+	 */
+
+	int add(ExecutorTask& task);
+
+	/**
+	 * \brief "Run" function of the thread which runs the executor.
+	 *
+	 * Resumes tasks added to the executor until all of them are finished.
+	 *
+	 * \warning This function must be called by only one thread at a time.
+	 */
+
+	void run();
+
+	Executor(const Executor&) = delete;
+	Executor(Executor&&) = delete;
+	const Executor& operator=(const Executor&) = delete;
+	Executor& operator=(Executor&&) = delete;
+
+private:
+
+	/// functor which gives ascending wake up time point order of elements on the list
+	struct AscendingWakeUpTimePoint
+	{
+		/**
+		 * \brief AscendingWakeUpTimePoint's constructor
+		 */
+
+		constexpr AscendingWakeUpTimePoint()
+		{
+
+		}
+
+		/**
+		 * \brief AscendingWakeUpTimePoint's function call operator
+		 *
+		 * \param [in] left is the object on the left side of comparison
+		 * \param [in] right is the object on the right side of comparison
+		 *
+		 * \return true if left's wake up time point is greater than right's wake up time point
+		 */
+
+		bool operator()(const ExecutorTask& left, const ExecutorTask& right) const
+		{
+			return left.wakeUpTimePoint_ > right.wakeUpTimePoint_;
+		}
+	};
+
+	/// intrusive list of tasks which are ready
+	using ReadyList = estd::IntrusiveList<ExecutorTask, &ExecutorTask::node_>;
+
+	/// sorted intrusive list of tasks which are sleeping
+	using SleepingList = estd::SortedIntrusiveList<AscendingWakeUpTimePoint, ExecutorTask, &ExecutorTask::node_>;
+
+	/**
+	 * \brief Makes the task ready - internal version, with no interrupt masking.
+	 *
+	 * If the task is already ready, this function does nothing. If the task is sleeping, it is woken up.
+	 *
+	 * \param [in] task is a reference to task which will be made ready
+	 */
+
+	void makeReadyInternal(ExecutorTask& task);
+
+	/**
+	 * \brief Resumes one task.
+	 *
+	 * \param [in] task is a reference to resumed task
+	 */
+
+	void resume(ExecutorTask& task);
+
+	/// list of tasks which are ready
+	ReadyList readyList_;
+
+	/// list of tasks which are sleeping, sorted by their wake up time points
+	SleepingList sleepingList_;
+
+	/// semaphore posted when a task becomes ready
+	Semaphore semaphore_;
+
+	/// number of tasks which were added to the executor and did not finish yet
+	size_t activeTasks_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EXECUTOR_HPP_
@@ -0,0 +1,560 @@
+/**
+ * \file
+ * \brief ExecutorTask class header and EXECUTOR_TASK_*() macros
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EXECUTORTASK_HPP_
+#define INCLUDE_DISTORTOS_EXECUTORTASK_HPP_
+
+#include "distortos/CONCATENATE.h"
+#include "distortos/FifoQueue.hpp"
+#include "distortos/MessageQueue.hpp"
+#include "distortos/RawFifoQueue.hpp"
+#include "distortos/RawMessageQueue.hpp"
+
+#include <cerrno>
+
+/**
+ * \brief Starts the body of ExecutorTask::run().
+ *
+ * Resumes execution of the task at the point where it was suspended. Must be the first statement of
+ * ExecutorTask::run().
+ *
+ * \ingroup executors
+ */
+
+#define EXECUTOR_TASK_BEGIN()	do { if (getResumePoint() != nullptr) goto *getResumePoint(); } while (0)
+
+/**
+ * \brief Implementation of EXECUTOR_TASK_AWAIT()
+ *
+ * \param [in] condition is the awaited condition
+ * \param [in] label is the unique label of resume point
+ */
+
+#define EXECUTOR_TASK_AWAIT_IMPLEMENTATION(condition, label)	\
+		do { setResumePoint(&&label); label: if ((condition) == false) return false; finishAwait(); } while (0)
+
+/**
+ * \brief Suspends execution of the task until \a condition is satisfied.
+ *
+ * \a condition is evaluated when the task reaches this point and each time it is resumed by the executor. It is usually
+ * one of awaitable functions of ExecutorTask, which register the task for resumption when the awaited event happens -
+ * these may be combined with `||` (for example to wait for semaphore with a timeout), but in single condition at most
+ * one awaitable may use a semaphore or a queue. Condition which registers nothing is evaluated again after all other
+ * ready tasks are resumed, like in EXECUTOR_TASK_YIELD(), so the executor never blocks while such task is suspended.
+ *
+ * \warning Values of local variables of ExecutorTask::run() are not preserved when the task is suspended - all the
+ * state that must survive suspension should be kept in members of the task. Only one EXECUTOR_TASK_AWAIT(),
+ * EXECUTOR_TASK_SLEEP_FOR(), EXECUTOR_TASK_SLEEP_UNTIL() or EXECUTOR_TASK_YIELD() may be placed in single line of
+ * source code.
+ *
+ * \param [in] condition is the awaited condition
+ *
+ * \ingroup executors
+ */
+
+#define EXECUTOR_TASK_AWAIT(condition)	\
+		EXECUTOR_TASK_AWAIT_IMPLEMENTATION(condition, CONCATENATE2(executorTaskResumePoint, __LINE__))
+
+/**
+ * \brief Ends the body of ExecutorTask::run() - the task is finished.
+ *
+ * \ingroup executors
+ */
+
+#define EXECUTOR_TASK_END()	return true
+
+/**
+ * \brief Suspends execution of the task for given duration of time.
+ *
+ * Overwrites the deadline of the task.
+ *
+ * \param [in] duration is the duration after which the task will be resumed
+ *
+ * \ingroup executors
+ */
+
+#define EXECUTOR_TASK_SLEEP_FOR(duration)	\
+		do { setDeadlineAfter(duration); EXECUTOR_TASK_AWAIT(deadlineReached()); } while (0)
+
+/**
+ * \brief Suspends execution of the task until given time point.
+ *
+ * Overwrites the deadline of the task.
+ *
+ * \param [in] timePoint is the time point at which the task will be resumed
+ *
+ * \ingroup executors
+ */
+
+#define EXECUTOR_TASK_SLEEP_UNTIL(timePoint)	\
+		do { setDeadline(timePoint); EXECUTOR_TASK_AWAIT(deadlineReached()); } while (0)
+
+/**
+ * \brief Implementation of EXECUTOR_TASK_YIELD()
+ *
+ * \param [in] label is the unique label of resume point
+ */
+
+#define EXECUTOR_TASK_YIELD_IMPLEMENTATION(label)	do { setResumePoint(&&label); return false; label: ; } while (0)
+
+/**
+ * \brief Suspends execution of the task, letting the executor run other tasks which are ready.
+ *
+ * \ingroup executors
+ */
+
+#define EXECUTOR_TASK_YIELD()	EXECUTOR_TASK_YIELD_IMPLEMENTATION(CONCATENATE2(executorTaskResumePoint, __LINE__))
+
+namespace distortos
+{
+
+namespace devices
+{
+
+class SerialPort;
+
+}	// namespace devices
+
+class Executor;
+
+/**
+ * \brief ExecutorTask class is a lightweight task which is run cooperatively by Executor.
+ *
+ * The task is a stackless coroutine - run() is written as a protothread with EXECUTOR_TASK_BEGIN(),
+ * EXECUTOR_TASK_AWAIT(), EXECUTOR_TASK_SLEEP_FOR(), EXECUTOR_TASK_SLEEP_UNTIL(), EXECUTOR_TASK_YIELD() and
+ * EXECUTOR_TASK_END() macros. When the task is suspended, run() returns and the task keeps only its resume point, so
+ * any number of tasks may share the stack of the single thread which runs the executor. The task which waits for a
+ * semaphore or a queue is attached to its semaphore as an observer and is resumed by the executor only after the
+ * semaphore is posted, so waiting tasks consume no CPU time.
+ *
+ * Example of a task which forwards elements from one queue to another:
+ *
+ *     class Forwarder : public ExecutorTask
+ *     {
+ *     public:
+ *         Forwarder(FifoQueue<int>& input, FifoQueue<int>& output) : ExecutorTask{}, input_{input}, output_{output},
+ *                 value_{} {}
+ *     protected:
+ *         bool run() override
+ *         {
+ *             EXECUTOR_TASK_BEGIN();
+ *             while (1)
+ *             {
+ *                 EXECUTOR_TASK_AWAIT(pop(input_, value_));
+ *                 EXECUTOR_TASK_AWAIT(push(output_, value_));
+ *             }
+ *             EXECUTOR_TASK_END();
+ *         }
+ *     private:
+ *         FifoQueue<int>& input_;
+ *         FifoQueue<int>& output_;
+ *         int value_;
+ *     };
+ *
+ * \note Macros use "labels as values" extension of GCC.
+ *
+ * \ingroup executors
+ */
+
+class ExecutorTask : private internal::SemaphoreObserver
+{
+	friend class Executor;
+
+public:
+
+	/**
+	 * \brief ExecutorTask's constructor
+	 */
+
+	constexpr ExecutorTask() :
+			internal::SemaphoreObserver{},
+			node_{},
+			deadline_{},
+			wakeUpTimePoint_{},
+			resumePoint_{},
+			executor_{},
+			sleeping_{}
+	{
+
+	}
+
+	/**
+	 * \brief ExecutorTask's destructor
+	 *
+	 * \warning The task must not be destroyed while it is active.
+	 */
+
+	virtual ~ExecutorTask();
+
+	/**
+	 * \return true if the task was added to the executor and did not finish yet, false otherwise
+	 */
+
+	bool isActive() const;
+
+	ExecutorTask(const ExecutorTask&) = delete;
+	ExecutorTask(ExecutorTask&&) = delete;
+	const ExecutorTask& operator=(const ExecutorTask&) = delete;
+	ExecutorTask& operator=(ExecutorTask&&) = delete;
+
+protected:
+
+	/**
+	 * \brief Awaitable which checks whether the deadline of the task was reached.
+	 *
+	 * If the deadline was not reached yet, the task will be resumed when it is reached.
+	 *
+	 * \return true if the deadline was reached, false otherwise
+	 */
+
+	bool deadlineReached();
+
+	/**
+	 * \brief Completes EXECUTOR_TASK_AWAIT() - cancels all registrations made by awaitables of the condition.
+	 */
+
+	void finishAwait();
+
+	/**
+	 * \return deadline of the task
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return deadline_;
+	}
+
+	/**
+	 * \return resume point of the task, nullptr if the task should be started from the beginning
+	 */
+
+	void* getResumePoint() const
+	{
+		return reinterpret_cast<void*>(resumePoint_);
+	}
+
+	/**
+	 * \brief Awaitable which pops the oldest element from FifoQueue.
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] fifoQueue is a reference to FifoQueue from which the element will be popped
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return true if the element was popped, false otherwise
+	 */
+
+	template<typename T>
+	bool pop(FifoQueue<T>& fifoQueue, T& value)
+	{
+		return tryOperation(fifoQueue.fifoQueueBase_.getPopSemaphore(),
+				[&fifoQueue, &value]()
+				{
+					return fifoQueue.tryPop(value);
+				});
+	}
+
+	/**
+	 * \brief Awaitable which pops oldest element with highest priority from MessageQueue.
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] messageQueue is a reference to MessageQueue from which the element will be popped
+	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
+	 * \param [out] value is a reference to object that will be used to return popped value
+	 *
+	 * \return true if the element was popped, false otherwise
+	 */
+
+	template<typename T>
+	bool pop(MessageQueue<T>& messageQueue, uint8_t& priority, T& value)
+	{
+		return tryOperation(messageQueue.messageQueueBase_.getPopSemaphore(),
+				[&messageQueue, &priority, &value]()
+				{
+					return messageQueue.tryPop(priority, value);
+				});
+	}
+
+	/**
+	 * \brief Awaitable which pops the oldest element from RawFifoQueue.
+	 *
+	 * \param [in] rawFifoQueue is a reference to RawFifoQueue from which the element will be popped
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of the queue
+	 * \param [out] ret is a reference to variable that will be used to return result of the operation:
+	 * - error codes returned by RawFifoQueue::tryPop() other than EAGAIN;
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	bool pop(RawFifoQueue& rawFifoQueue, void* buffer, size_t size, int& ret);
+
+	/**
+	 * \brief Awaitable which pops oldest element with highest priority from RawMessageQueue.
+	 *
+	 * \param [in] rawMessageQueue is a reference to RawMessageQueue from which the element will be popped
+	 * \param [out] priority is a reference to variable that will be used to return priority of popped value
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of the queue
+	 * \param [out] ret is a reference to variable that will be used to return result of the operation:
+	 * - error codes returned by RawMessageQueue::tryPop() other than EAGAIN;
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	bool pop(RawMessageQueue& rawMessageQueue, uint8_t& priority, void* buffer, size_t size, int& ret);
+
+	/**
+	 * \brief Awaitable which pushes the element to FifoQueue.
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] fifoQueue is a reference to FifoQueue to which the element will be pushed
+	 * \param [in] value is a reference to object that will be pushed
+	 *
+	 * \return true if the element was pushed, false otherwise
+	 */
+
+	template<typename T>
+	bool push(FifoQueue<T>& fifoQueue, const T& value)
+	{
+		return tryOperation(fifoQueue.fifoQueueBase_.getPushSemaphore(),
+				[&fifoQueue, &value]()
+				{
+					return fifoQueue.tryPush(value);
+				});
+	}
+
+	/**
+	 * \brief Awaitable which pushes the element to MessageQueue.
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] messageQueue is a reference to MessageQueue to which the element will be pushed
+	 * \param [in] priority is the priority of new element
+	 * \param [in] value is a reference to object that will be pushed
+	 *
+	 * \return true if the element was pushed, false otherwise
+	 */
+
+	template<typename T>
+	bool push(MessageQueue<T>& messageQueue, const uint8_t priority, const T& value)
+	{
+		return tryOperation(messageQueue.messageQueueBase_.getPushSemaphore(),
+				[&messageQueue, priority, &value]()
+				{
+					return messageQueue.tryPush(priority, value);
+				});
+	}
+
+	/**
+	 * \brief Awaitable which pushes the element to RawFifoQueue.
+	 *
+	 * \param [in] rawFifoQueue is a reference to RawFifoQueue to which the element will be pushed
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of the queue
+	 * \param [out] ret is a reference to variable that will be used to return result of the operation:
+	 * - error codes returned by RawFifoQueue::tryPush() other than EAGAIN;
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	bool push(RawFifoQueue& rawFifoQueue, const void* data, size_t size, int& ret);
+
+	/**
+	 * \brief Awaitable which pushes the element to RawMessageQueue.
+	 *
+	 * \param [in] rawMessageQueue is a reference to RawMessageQueue to which the element will be pushed
+	 * \param [in] priority is the priority of new element
+	 * \param [in] data is a pointer to data that will be pushed to RawMessageQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of the queue
+	 * \param [out] ret is a reference to variable that will be used to return result of the operation:
+	 * - error codes returned by RawMessageQueue::tryPush() other than EAGAIN;
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	bool push(RawMessageQueue& rawMessageQueue, uint8_t priority, const void* data, size_t size, int& ret);
+
+	/**
+	 * \brief Awaitable which reads data from SerialPort.
+	 *
+	 * The operation is completed when at least one byte (or at least one character, if character length is greater
+	 * than 8 bits) is read or when the read fails. As serial port has no notification for reads which do not block, the
+	 * task waiting for data is resumed by the executor in each tick of TickClock to check for it.
+	 *
+	 * \param [in] serialPort is a reference to SerialPort from which the data will be read
+	 * \param [out] buffer is the buffer to which the data will be written
+	 * \param [in] size is the size of \a buffer, bytes, must be even if selected character length is greater than 8
+	 * bits
+	 * \param [out] result is a reference to variable that will be used to return result of the operation - pair with
+	 * return code (0 on success, error code otherwise) and number of read bytes, as returned by SerialPort::read()
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	bool read(devices::SerialPort& serialPort, void* buffer, size_t size, std::pair<int, size_t>& result);
+
+	/**
+	 * \brief Body of the task
+	 *
+	 * Must start with EXECUTOR_TASK_BEGIN() and end with EXECUTOR_TASK_END().
+	 *
+	 * \return true if the task is finished, false if it was suspended
+	 */
+
+	virtual bool run() = 0;
+
+	/**
+	 * \brief Sets deadline of the task.
+	 *
+	 * \param [in] deadline is the new deadline of the task
+	 */
+
+	void setDeadline(const TickClock::time_point deadline)
+	{
+		deadline_ = deadline;
+	}
+
+	/**
+	 * \brief Sets deadline of the task after given duration of time from now.
+	 *
+	 * \param [in] duration is the duration after which the deadline will be reached
+	 */
+
+	void setDeadlineAfter(TickClock::duration duration);
+
+	/**
+	 * \brief Sets deadline of the task after given duration of time from now.
+	 *
+	 * Template variant of setDeadlineAfter(TickClock::duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the deadline will be reached
+	 */
+
+	template<typename Rep, typename Period>
+	void setDeadlineAfter(const std::chrono::duration<Rep, Period> duration)
+	{
+		setDeadlineAfter(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Sets resume point of the task.
+	 *
+	 * \param [in] resumePoint is the new resume point of the task, nullptr if the task should be started from the
+	 * beginning
+	 */
+
+	void setResumePoint(void* const resumePoint)
+	{
+		resumePoint_ = reinterpret_cast<uintptr_t>(resumePoint);
+	}
+
+	/**
+	 * \brief Awaitable which locks the semaphore.
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be locked
+	 *
+	 * \return true if the semaphore was locked, false otherwise
+	 */
+
+	bool wait(Semaphore& semaphore);
+
+private:
+
+	/**
+	 * \brief Notifies the task that the semaphore which it waits for was posted.
+	 *
+	 * The task is made ready to be resumed by its executor.
+	 */
+
+	void notify() override;
+
+	/**
+	 * \brief Schedules resumption of the task at given time point.
+	 *
+	 * If the task is already scheduled to be resumed earlier, this function does nothing.
+	 *
+	 * \param [in] timePoint is the time point at which the task will be resumed
+	 */
+
+	void scheduleWakeUp(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to perform operation which is guarded by the semaphore.
+	 *
+	 * The task is attached to the semaphore before the operation is tried, so the post() which happens after failed
+	 * attempt will resume the task.
+	 *
+	 * \tparam Function is the type of function which tries to perform the operation
+	 *
+	 * \param [in] semaphore is a reference to semaphore which guards the operation
+	 * \param [in] function is the function which tries to perform the operation, it should return EAGAIN if the
+	 * operation could not be performed now
+	 * \param [out] ret is a reference to variable that will be used to return value returned by \a function
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	template<typename Function>
+	bool tryOperation(Semaphore& semaphore, const Function& function, int& ret)
+	{
+		semaphore.attach(*this);
+		ret = function();
+		return ret != EAGAIN;
+	}
+
+	/**
+	 * \brief Tries to perform operation which is guarded by the semaphore and which may fail only with EAGAIN.
+	 *
+	 * \tparam Function is the type of function which tries to perform the operation
+	 *
+	 * \param [in] semaphore is a reference to semaphore which guards the operation
+	 * \param [in] function is the function which tries to perform the operation, it should return EAGAIN if the
+	 * operation could not be performed now
+	 *
+	 * \return true if the operation was completed, false otherwise
+	 */
+
+	template<typename Function>
+	bool tryOperation(Semaphore& semaphore, const Function& function)
+	{
+		int ret;
+		return tryOperation(semaphore, function, ret);
+	}
+
+	/// node for intrusive list of tasks which are ready or sleeping
+	estd::IntrusiveListNode node_;
+
+	/// deadline of the task
+	TickClock::time_point deadline_;
+
+	/// time point at which the sleeping task will be resumed
+	TickClock::time_point wakeUpTimePoint_;
+
+	/// resume point of the task, 0 if the task should be started from the beginning - kept as an integer, as otherwise
+	/// the compiler considers address of label in run() to be a dangling pointer to local object
+	uintptr_t resumePoint_;
+
+	/// pointer to executor to which the task was added, nullptr if the task is not active
+	Executor* executor_;
+
+	/// true if the task is linked in the list of sleeping tasks, false otherwise
+	bool sleeping_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EXECUTORTASK_HPP_
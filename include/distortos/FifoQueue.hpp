@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueue class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
+#include "distortos/internal/synchronization/BoundBulkQueueFunctor.hpp"
 #include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
 #include "distortos/internal/synchronization/CopyConstructQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MoveConstructQueueFunctor.hpp"
@@ -43,6 +44,9 @@ namespace distortos
 template<typename T>
 class FifoQueue
 {
+	friend class ExecutorTask;
+	friend class PollEntry;
+
 public:
 
 	/// type of uninitialized storage for data
@@ -116,6 +120,30 @@ public:
 		return popInternal(semaphoreWaitFunctor, value);
 	}
 
+	/**
+	 * \brief Pops many oldest (first) elements from the queue.
+	 *
+	 * Waits until at least one element is available, then pops as many available elements as fit in \a values in a
+	 * single operation. Threads waiting for free slots are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popMany(T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popManyInternal(semaphoreWaitFunctor, values, count);
+	}
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -153,6 +181,30 @@ public:
 		return pushInternal(semaphoreWaitFunctor, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes many elements to the queue.
+	 *
+	 * Waits until at least one slot is free, then pushes as many elements from \a values as there are free slots in a
+	 * single operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushMany(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushManyInternal(semaphoreWaitFunctor, values, count);
+	}
+
 	/**
 	 * \brief Tries to emplace the element in the queue.
 	 *
@@ -338,6 +390,133 @@ public:
 		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
 	}
 
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue.
+	 *
+	 * If at least one element is available, pops as many available elements as fit in \a values in a single operation.
+	 * Threads waiting for free slots are woken once per call.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopMany(T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popManyInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Waits (with timeout) until at least one element is available, then pops as many available elements as fit in \a
+	 * values in a single operation. Threads waiting for free slots are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopManyFor(const TickClock::duration duration, T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return popManyInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopManyFor(TickClock::duration, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopManyFor(const std::chrono::duration<Rep, Period> duration, T* const values,
+			const size_t count)
+	{
+		return tryPopManyFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue until a given time point.
+	 *
+	 * Waits (with timeout) until at least one element is available, then pops as many available elements as fit in \a
+	 * values in a single operation. Threads waiting for free slots are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopManyUntil(const TickClock::time_point timePoint, T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popManyInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopManyUntil(TickClock::time_point, T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopManyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			T* const values, const size_t count)
+	{
+		return tryPopManyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
@@ -503,6 +682,134 @@ public:
 		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), std::move(value));
 	}
 
+	/**
+	 * \brief Tries to push many elements to the queue.
+	 *
+	 * If at least one slot is free, pushes as many elements from \a values as there are free slots in a single
+	 * operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushMany(const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushManyInternal(semaphoreTryWaitFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push many elements to the queue for a given duration of time.
+	 *
+	 * Waits (with timeout) until at least one slot is free, then pushes as many elements from \a values as there are
+	 * free slots in a single operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushManyFor(const TickClock::duration duration, const T* const values, const size_t count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return pushManyInternal(semaphoreTryWaitForFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push many elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushManyFor(TickClock::duration, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushManyFor(const std::chrono::duration<Rep, Period> duration, const T* const values,
+			const size_t count)
+	{
+		return tryPushManyFor(std::chrono::duration_cast<TickClock::duration>(duration), values, count);
+	}
+
+	/**
+	 * \brief Tries to push many elements to the queue until a given time point.
+	 *
+	 * Waits (with timeout) until at least one slot is free, then pushes as many elements from \a values as there are
+	 * free slots in a single operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushManyUntil(const TickClock::time_point timePoint, const T* const values,
+			const size_t count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushManyInternal(semaphoreTryWaitUntilFunctor, values, count);
+	}
+
+	/**
+	 * \brief Tries to push many elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushManyUntil(TickClock::time_point, const T*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushManyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const T* const values, const size_t count)
+	{
+		return tryPushManyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, count);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
@@ -627,6 +934,25 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
 
+	/**
+	 * \brief Pops many oldest (first) elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T* values,
+			size_t count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -658,6 +984,25 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
+	/**
+	 * \brief Pushes many elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] count is the number of objects in \a values array
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T* values,
+			size_t count);
+
 	/// contained internal::FifoQueueBase object which implements whole functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -688,6 +1033,24 @@ int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::popManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		T* const values, const size_t count)
+{
+	const auto swapPopBulkQueueFunctor = internal::makeBoundBulkQueueFunctor(
+			[values](void* const storage, const size_t index, const size_t runCount)
+			{
+				const auto swappedValues = reinterpret_cast<T*>(storage);
+				for (size_t i {}; i < runCount; ++i)
+				{
+					using std::swap;
+					swap(values[index + i], swappedValues[i]);
+					swappedValues[i].~T();
+				}
+			});
+	return fifoQueueBase_.popMany(waitSemaphoreFunctor, swapPopBulkQueueFunctor, count);
+}
+
 template<typename T>
 int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
 {
@@ -702,6 +1065,20 @@ int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
 }
 
+template<typename T>
+std::pair<int, size_t> FifoQueue<T>::pushManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const T* const values, const size_t count)
+{
+	const auto copyConstructBulkQueueFunctor = internal::makeBoundBulkQueueFunctor(
+			[values](void* const storage, const size_t index, const size_t runCount)
+			{
+				const auto elements = static_cast<Storage*>(storage);
+				for (size_t i {}; i < runCount; ++i)
+					new (&elements[i]) T{values[index + i]};
+			});
+	return fifoQueueBase_.pushMany(waitSemaphoreFunctor, copyConstructBulkQueueFunctor, count);
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
@@ -14,6 +14,8 @@
 
 #include <dirent.h>
 
+#include <sys/types.h>
+
 #include <utility>
 
 namespace distortos
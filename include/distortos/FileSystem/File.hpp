@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_FILESYSTEM_FILE_HPP_
 
 #include <sys/stat.h>
+#include <sys/types.h>
 
 #include <utility>
 
@@ -0,0 +1,333 @@
+/**
+ * \file
+ * \brief MemoryPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include <limits>
+#include <memory>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class SemaphoreFunctor;
+
+}	// namespace internal
+
+/**
+ * \brief MemoryPool class is a pool of fixed-size blocks of memory.
+ *
+ * Free blocks are linked in a list, so allocation and deallocation of a block are O(1) operations with masked
+ * interrupts, which never use the mutex that protects the heap and never fragment the memory. Number of free blocks is
+ * tracked by internal Semaphore, so a thread which tries to allocate a block from an empty pool may be blocked until
+ * any block is deallocated - with or without timeout. Blocks may be deallocated from interrupt context, which unblocks
+ * the waiting thread with the highest priority.
+ *
+ * State of each block is tracked in a map of allocated blocks (one bit per block), so deallocation of a block which is
+ * not allocated (double free) is rejected without corrupting the pool.
+ *
+ * If "distortos_Checks_07_Poisoning_of_memory_pool_blocks" is selected, contents of each deallocated block are filled
+ * with a known pattern, which is verified when the block is allocated again - any write to a block after it was
+ * deallocated is detected with FATAL_ERROR().
+ *
+ * This class provides only the pool - its storage is provided by StaticMemoryPool or DynamicMemoryPool.
+ *
+ * \ingroup synchronization
+ */
+
+class MemoryPool
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief Gets size of storage required by single block.
+	 *
+	 * \param [in] blockSize is the size of single block, bytes
+	 *
+	 * \return size of storage required by single block (large enough to hold a pointer to next free block), multiple
+	 * of alignment of dynamically allocated memory, bytes
+	 */
+
+	constexpr static size_t getBlockStorageSize(const size_t blockSize)
+	{
+		return ((blockSize > sizeof(FreeBlock) ? blockSize : sizeof(FreeBlock)) + alignof(max_align_t) - 1) /
+				alignof(max_align_t) * alignof(max_align_t);
+	}
+
+	/**
+	 * \brief Gets size of storage required by the pool.
+	 *
+	 * \param [in] blockSize is the size of single block, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 *
+	 * \return size of storage required by \a blocks blocks (each of size equal to getBlockStorageSize() called with
+	 * \a blockSize) followed by the map of allocated blocks, bytes
+	 */
+
+	constexpr static size_t getStorageSize(const size_t blockSize, const size_t blocks)
+	{
+		return getBlockStorageSize(blockSize) * blocks +
+				(blocks + bitsPerMapWord - 1) / bitsPerMapWord * sizeof(MapWord);
+	}
+
+	/**
+	 * \brief MemoryPool's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for \a blocks blocks
+	 * and the map of allocated blocks (sufficiently large - at least getStorageSize() called with \a blockSize and
+	 * \a blocks, aligned to alignment of dynamically allocated memory) and appropriate deleter
+	 * \param [in] blockSize is the size of single block, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 */
+
+	MemoryPool(StorageUniquePointer&& storageUniquePointer, size_t blockSize, size_t blocks);
+
+	/**
+	 * \brief MemoryPool's destructor
+	 *
+	 * \warning All blocks must be deallocated before the pool is destroyed.
+	 */
+
+	~MemoryPool();
+
+	/**
+	 * \brief Allocates block from the pool.
+	 *
+	 * If the pool has no free blocks, current thread is blocked until any block is deallocated.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (aligned to
+	 * alignment of dynamically allocated memory); error codes:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, void*> allocate();
+
+	/**
+	 * \brief Deallocates block.
+	 *
+	 * The block is returned to the pool and the thread with the highest priority which waits for a free block is
+	 * unblocked.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] block is a pointer to block which will be deallocated, must have been allocated from this pool
+	 *
+	 * \return 0 if block was deallocated successfully, error code otherwise:
+	 * - EINVAL - \a block was not allocated from this pool or it is not currently allocated (it was already
+	 * deallocated);
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int deallocate(void* block);
+
+	/**
+	 * \return size of single block, bytes
+	 */
+
+	size_t getBlockSize() const
+	{
+		return blockSize_;
+	}
+
+	/**
+	 * \return number of blocks in the pool
+	 */
+
+	size_t getBlocks() const
+	{
+		return blocks_;
+	}
+
+	/**
+	 * \return number of allocations which failed - because the pool had no free blocks and the call was non-blocking,
+	 * its timeout expired or it was interrupted
+	 */
+
+	size_t getFailures() const
+	{
+		return failures_;
+	}
+
+	/**
+	 * \return maximal number of blocks which were allocated at the same time (peak usage of the pool)
+	 */
+
+	size_t getMaxUsedBlocks() const
+	{
+		return maxUsedBlocks_;
+	}
+
+	/**
+	 * \return number of blocks which are currently allocated
+	 */
+
+	size_t getUsedBlocks() const
+	{
+		return usedBlocks_;
+	}
+
+	/**
+	 * \brief Tries to allocate block from the pool.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (aligned to
+	 * alignment of dynamically allocated memory); error codes:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	std::pair<int, void*> tryAllocate();
+
+	/**
+	 * \brief Tries to allocate block from the pool for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (aligned to
+	 * alignment of dynamically allocated memory); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	std::pair<int, void*> tryAllocateFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to allocate block from the pool for a given duration of time.
+	 *
+	 * Template variant of tryAllocateFor(TickClock::duration).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (aligned to
+	 * alignment of dynamically allocated memory); error codes:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, void*> tryAllocateFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryAllocateFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to allocate block from the pool until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (aligned to
+	 * alignment of dynamically allocated memory); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, void*> tryAllocateUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to allocate block from the pool until a given time point.
+	 *
+	 * Template variant of tryAllocateUntil(TickClock::time_point).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without allocating the block
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block (aligned to
+	 * alignment of dynamically allocated memory); error codes:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, void*> tryAllocateUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryAllocateUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	MemoryPool(const MemoryPool&) = delete;
+	MemoryPool(MemoryPool&&) = delete;
+	const MemoryPool& operator=(const MemoryPool&) = delete;
+	MemoryPool& operator=(MemoryPool&&) = delete;
+
+private:
+
+	/// type of single word of the map of allocated blocks
+	using MapWord = size_t;
+
+	/// number of bits in single word of the map of allocated blocks
+	constexpr static size_t bitsPerMapWord {std::numeric_limits<MapWord>::digits};
+
+	/// contents of block while it is free
+	struct FreeBlock
+	{
+		/// pointer to next free block, nullptr if this is the last free block
+		FreeBlock* next;
+	};
+
+	/**
+	 * \brief Implementation of allocate(), tryAllocate(), tryAllocateFor() and tryAllocateUntil().
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a semaphore_
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and pointer to allocated block; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, void*> allocateInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor);
+
+	/// semaphore with value equal to the number of free blocks
+	Semaphore semaphore_;
+
+	/// storage for blocks
+	StorageUniquePointer storageUniquePointer_;
+
+	/// pointer to first free block, nullptr if the pool has no free blocks
+	FreeBlock* freeList_;
+
+	/// map of allocated blocks (located in storage, after all blocks), bit is set if the block is allocated
+	MapWord* allocatedBlocksMap_;
+
+	/// size of single block, bytes
+	size_t blockSize_;
+
+	/// number of blocks in the pool
+	size_t blocks_;
+
+	/// number of blocks which are currently allocated
+	size_t usedBlocks_;
+
+	/// maximal number of blocks which were allocated at the same time
+	size_t maxUsedBlocks_;
+
+	/// number of allocations which failed
+	size_t failures_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
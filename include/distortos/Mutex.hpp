@@ -24,11 +24,17 @@ namespace distortos
  * Similar to POSIX pthread_mutex_t -
  * http://pubs.opengroup.org/onlinepubs/9699919799/functions/V2_chap02.html#tag_15_09 -> 2.9.3 Thread Mutexes
  *
+ * Mutex with Protocol::none which is not contended is locked and unlocked with single atomic compare-and-swap of the
+ * owner word, without masking interrupts and without involving the scheduler. All other cases (priority protocols,
+ * recursive locking, blocking, transfer of ownership to blocked thread) are handled with interrupts masked.
+ *
  * \ingroup synchronization
  */
 
 class Mutex : private internal::MutexControlBlock
 {
+	friend class ConditionVariable;
+
 public:
 
 	/// mutex protocols
@@ -0,0 +1,286 @@
+/**
+ * \file
+ * \brief PollEntry class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_POLLENTRY_HPP_
+#define INCLUDE_DISTORTOS_POLLENTRY_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/EventFlags.hpp"
+#include "distortos/FifoQueue.hpp"
+#include "distortos/MessageQueue.hpp"
+#include "distortos/RawFifoQueue.hpp"
+#include "distortos/RawMessageQueue.hpp"
+
+namespace distortos
+{
+
+class SignalSet;
+
+namespace internal
+{
+
+class PollImplementation;
+
+}	// namespace internal
+
+/**
+ * \brief PollEntry class is a single object which is waited for with poll().
+ *
+ * Entry may select a semaphore, one direction of a queue, a set of flags of EventFlags or - if support for signals is
+ * enabled - a set of signals of current thread. poll() only checks whether the object is "ready" and never consumes
+ * anything from it, so after successful poll() the operation must be executed with non-blocking function of the object
+ * (for example Semaphore::tryWait() or FifoQueue::tryPop()). As the object could be taken by another thread or
+ * interrupt in the meantime, this function may still fail with EAGAIN.
+ *
+ * Entry is "ready" when:
+ * - semaphore - value of semaphore is greater than zero;
+ * - queue, QueueOperation::pop - queue is not empty;
+ * - queue, QueueOperation::push - queue is not full;
+ * - EventFlags - wait for flags selected by bitmask is satisfied by current value of flags, flags are never cleared by
+ * poll(), so EventFlags::WaitMode::anyClear and EventFlags::WaitMode::allClear are equivalent to
+ * EventFlags::WaitMode::any and EventFlags::WaitMode::all respectively;
+ * - signals - any of signals from the set is pending for current thread;
+ *
+ * \ingroup synchronization
+ */
+
+class PollEntry : private internal::SemaphoreObserver
+{
+	friend class internal::PollImplementation;
+
+public:
+
+	/// operation of queue which is waited for
+	enum class QueueOperation : uint8_t
+	{
+		/// queue is ready when it is not empty
+		pop,
+		/// queue is ready when it is not full
+		push,
+	};
+
+	/**
+	 * \brief PollEntry's constructor for semaphore
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be waited for
+	 */
+
+	constexpr explicit PollEntry(Semaphore& semaphore) :
+			internal::SemaphoreObserver{},
+			semaphore_{&semaphore},
+			threadControlBlock_{},
+			bitmask_{},
+			type_{Type::semaphore},
+			waitMode_{},
+			ready_{}
+	{
+
+	}
+
+	/**
+	 * \brief PollEntry's constructor for EventFlags
+	 *
+	 * \param [in] eventFlags is a reference to EventFlags which will be waited for
+	 * \param [in] bitmask is the bitmask with flags that will be waited for, must not be zero
+	 * \param [in] waitMode is the mode of wait
+	 */
+
+	constexpr PollEntry(EventFlags& eventFlags, const EventFlags::Value bitmask, const EventFlags::WaitMode waitMode) :
+			internal::SemaphoreObserver{},
+			eventFlags_{&eventFlags},
+			threadControlBlock_{},
+			bitmask_{bitmask},
+			type_{Type::eventFlags},
+			waitMode_{waitMode},
+			ready_{}
+	{
+
+	}
+
+	/**
+	 * \brief PollEntry's constructor for FifoQueue
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] fifoQueue is a reference to FifoQueue which will be waited for
+	 * \param [in] queueOperation is the operation of queue which will be waited for
+	 */
+
+	template<typename T>
+	PollEntry(FifoQueue<T>& fifoQueue, const QueueOperation queueOperation) :
+			PollEntry{queueOperation == QueueOperation::pop ? fifoQueue.fifoQueueBase_.getPopSemaphore() :
+					fifoQueue.fifoQueueBase_.getPushSemaphore()}
+	{
+
+	}
+
+	/**
+	 * \brief PollEntry's constructor for MessageQueue
+	 *
+	 * \tparam T is the type of data in queue
+	 *
+	 * \param [in] messageQueue is a reference to MessageQueue which will be waited for
+	 * \param [in] queueOperation is the operation of queue which will be waited for
+	 */
+
+	template<typename T>
+	PollEntry(MessageQueue<T>& messageQueue, const QueueOperation queueOperation) :
+			PollEntry{queueOperation == QueueOperation::pop ? messageQueue.messageQueueBase_.getPopSemaphore() :
+					messageQueue.messageQueueBase_.getPushSemaphore()}
+	{
+
+	}
+
+	/**
+	 * \brief PollEntry's constructor for RawFifoQueue
+	 *
+	 * \param [in] rawFifoQueue is a reference to RawFifoQueue which will be waited for
+	 * \param [in] queueOperation is the operation of queue which will be waited for
+	 */
+
+	PollEntry(RawFifoQueue& rawFifoQueue, const QueueOperation queueOperation) :
+			PollEntry{queueOperation == QueueOperation::pop ? rawFifoQueue.fifoQueueBase_.getPopSemaphore() :
+					rawFifoQueue.fifoQueueBase_.getPushSemaphore()}
+	{
+
+	}
+
+	/**
+	 * \brief PollEntry's constructor for RawMessageQueue
+	 *
+	 * \param [in] rawMessageQueue is a reference to RawMessageQueue which will be waited for
+	 * \param [in] queueOperation is the operation of queue which will be waited for
+	 */
+
+	PollEntry(RawMessageQueue& rawMessageQueue, const QueueOperation queueOperation) :
+			PollEntry{queueOperation == QueueOperation::pop ? rawMessageQueue.messageQueueBase_.getPopSemaphore() :
+					rawMessageQueue.messageQueueBase_.getPushSemaphore()}
+	{
+
+	}
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+	/**
+	 * \brief PollEntry's constructor for signals
+	 *
+	 * \param [in] signalSet is a reference to set of signals that will be waited for, signals which are not masked
+	 * interrupt poll() with EINTR when they are delivered
+	 */
+
+	constexpr explicit PollEntry(const SignalSet& signalSet) :
+			internal::SemaphoreObserver{},
+			signalSet_{&signalSet},
+			threadControlBlock_{},
+			bitmask_{},
+			type_{Type::signals},
+			waitMode_{},
+			ready_{}
+	{
+
+	}
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+
+	/**
+	 * \brief PollEntry's move constructor
+	 *
+	 * \note Entry may be moved only when it is not used by poll().
+	 *
+	 * \param [in] other is a reference to PollEntry object that will be moved
+	 */
+
+	PollEntry(PollEntry&& other) :
+			internal::SemaphoreObserver{},
+			semaphore_{other.semaphore_},
+			threadControlBlock_{},
+			bitmask_{other.bitmask_},
+			type_{other.type_},
+			waitMode_{other.waitMode_},
+			ready_{other.ready_}
+	{
+
+	}
+
+	/**
+	 * \brief PollEntry's destructor
+	 */
+
+	~PollEntry() = default;
+
+	/**
+	 * \return true if the object was ready when the last poll() returned, false otherwise
+	 */
+
+	bool isReady() const
+	{
+		return ready_;
+	}
+
+	PollEntry(const PollEntry&) = delete;
+	const PollEntry& operator=(const PollEntry&) = delete;
+	PollEntry& operator=(PollEntry&&) = delete;
+
+private:
+
+	/// type of object which is waited for
+	enum class Type : uint8_t
+	{
+		/// semaphore - also used for queues
+		semaphore,
+		/// EventFlags
+		eventFlags,
+		/// signals
+		signals,
+	};
+
+	/**
+	 * \brief Notifies the entry that its object may have become ready.
+	 *
+	 * Unblocks the thread which is blocked in poll().
+	 *
+	 * \note This function is called with masked interrupts, possibly from interrupt context.
+	 */
+
+	void notify() override;
+
+	union
+	{
+		/// pointer to semaphore, valid only if type_ is Type::semaphore
+		Semaphore* semaphore_;
+
+		/// pointer to EventFlags, valid only if type_ is Type::eventFlags
+		EventFlags* eventFlags_;
+
+		/// pointer to set of signals, valid only if type_ is Type::signals
+		const SignalSet* signalSet_;
+	};
+
+	/// pointer to control block of thread which is blocked in poll(), valid only when the entry is attached
+	internal::ThreadControlBlock* threadControlBlock_;
+
+	/// bitmask with flags that are waited for, valid only if type_ is Type::eventFlags
+	EventFlags::Value bitmask_;
+
+	/// type of object which is waited for
+	Type type_;
+
+	/// mode of wait, valid only if type_ is Type::eventFlags
+	EventFlags::WaitMode waitMode_;
+
+	/// true if the object was ready when the last poll() returned, false otherwise
+	bool ready_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_POLLENTRY_HPP_
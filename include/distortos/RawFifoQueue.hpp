@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,9 @@ namespace distortos
 
 class RawFifoQueue
 {
+	friend class ExecutorTask;
+	friend class PollEntry;
+
 public:
 
 	/// unique_ptr (with deleter) to storage
@@ -45,6 +48,37 @@ public:
 
 	RawFifoQueue(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
 
+	/**
+	 * \brief Commits the slot reserved with reserve(), making the element stored in it available for popping.
+	 *
+	 * If other reserved slots are not committed yet, the element becomes available when all of them are committed, so
+	 * the order of elements is always preserved.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \return 0 if slot was committed successfully, error code otherwise:
+	 * - EPERM - no slot is reserved;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit();
+
+	/**
+	 * \brief Peeks the oldest (first) element of the queue.
+	 *
+	 * Gives direct access to storage of the oldest (first) element and removes it from the queue, but the slot is not
+	 * reused until it is released with release().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int peek(const void*& storage);
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -82,6 +116,27 @@ public:
 		return pop(&buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Pops many oldest (first) elements from the queue.
+	 *
+	 * Waits until at least one element is available, then pops as many available elements as fit in \a buffer in a
+	 * single operation. Threads waiting for free slots are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popMany(void* buffer, size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -119,6 +174,153 @@ public:
 		return push(&data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes many elements to the queue.
+	 *
+	 * Waits until at least one slot is free, then pushes as many elements from \a data as there are free slots in a
+	 * single operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushMany(const void* data, size_t size);
+
+	/**
+	 * \brief Releases the slot of element obtained with peek(), making it available for pushing.
+	 *
+	 * If other peeked slots are not released yet, the slot becomes available when all of them are released, so slots
+	 * are always reused in order.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \return 0 if slot was released successfully, error code otherwise:
+	 * - EPERM - no slot is peeked;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release();
+
+	/**
+	 * \brief Reserves free slot in the queue.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int reserve(void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element of the queue.
+	 *
+	 * Gives direct access to storage of the oldest (first) element and removes it from the queue, but the slot is not
+	 * reused until it is released with release().
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPeek(const void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element of the queue for a given duration of time.
+	 *
+	 * Gives direct access to storage of the oldest (first) element and removes it from the queue, but the slot is not
+	 * reused until it is released with release().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryPeekFor(TickClock::duration duration, const void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element of the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekFor(TickClock::duration, const void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPeekFor(const std::chrono::duration<Rep, Period> duration, const void*& storage)
+	{
+		return tryPeekFor(std::chrono::duration_cast<TickClock::duration>(duration), storage);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest (first) element of the queue until a given time point.
+	 *
+	 * Gives direct access to storage of the oldest (first) element and removes it from the queue, but the slot is not
+	 * reused until it is released with release().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPeekUntil(TickClock::time_point timePoint, const void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest (first) element of the queue until a given time point.
+	 *
+	 * Template variant of tryPeekUntil(TickClock::time_point, const void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPeekUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void*& storage)
+	{
+		return tryPeekUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), storage);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -219,6 +421,126 @@ public:
 		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue.
+	 *
+	 * If at least one element is available, pops as many available elements as fit in \a buffer in a single operation.
+	 * Threads waiting for free slots are woken once per call.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopMany(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Waits (with timeout) until at least one element is available, then pops as many available elements as fit in \a
+	 * buffer in a single operation. Threads waiting for free slots are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopManyFor(TickClock::duration duration, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopManyFor(TickClock::duration, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopManyFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size)
+	{
+		return tryPopManyFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue until a given time point.
+	 *
+	 * Waits (with timeout) until at least one element is available, then pops as many available elements as fit in \a
+	 * buffer in a single operation. Threads waiting for free slots are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPopManyUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopManyUntil(TickClock::time_point, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopManyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size)
+	{
+		return tryPopManyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
@@ -384,6 +706,126 @@ public:
 		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to push many elements to the queue.
+	 *
+	 * If at least one slot is free, pushes as many elements from \a data as there are free slots in a single operation.
+	 * Threads waiting for elements are woken once per call.
+	 *
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushMany(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push many elements to the queue for a given duration of time.
+	 *
+	 * Waits (with timeout) until at least one slot is free, then pushes as many elements from \a data as there are free
+	 * slots in a single operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushManyFor(TickClock::duration duration, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push many elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushManyFor(TickClock::duration, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPushManyFor(const std::chrono::duration<Rep, Period> duration, const void* const data,
+			const size_t size)
+	{
+		return tryPushManyFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size);
+	}
+
+	/**
+	 * \brief Tries to push many elements to the queue until a given time point.
+	 *
+	 * Waits (with timeout) until at least one slot is free, then pushes as many elements from \a data as there are free
+	 * slots in a single operation. Threads waiting for elements are woken once per call.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> tryPushManyUntil(TickClock::time_point timePoint, const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push many elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushManyUntil(TickClock::time_point, const void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPushManyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const void* const data, const size_t size)
+	{
+		return tryPushManyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
@@ -450,6 +892,101 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to reserve free slot in the queue.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryReserve(void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryReserveFor(TickClock::duration duration, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReserveFor(const std::chrono::duration<Rep, Period> duration, void*& storage)
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration), storage);
+	}
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryReserveUntil(TickClock::time_point timePoint, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& storage)
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), storage);
+	}
+
 private:
 
 	/**
@@ -469,6 +1006,26 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size);
 
+	/**
+	 * \brief Pops many oldest (first) elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer,
+			size_t size);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -486,6 +1043,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size);
 
+	/**
+	 * \brief Pushes many elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] data is a pointer to elements that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data,
+			size_t size);
+
 	/// contained internal::FifoQueueBase object which implements base functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -32,6 +32,9 @@ namespace distortos
 
 class RawMessageQueue
 {
+	friend class ExecutorTask;
+	friend class PollEntry;
+
 public:
 
 	/// type of uninitialized storage for Entry with link
@@ -65,6 +68,42 @@ public:
 	RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
 			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements);
 
+	/**
+	 * \brief Commits the slot reserved with reserve(), making the element stored in it available for popping.
+	 *
+	 * Priority of the element is set when the slot is committed, so the element is placed after all elements with the
+	 * same or higher priority which were committed before.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [in] priority is the priority of element
+	 * \param [in] storage is a pointer to reserved slot, returned by one of reserve functions
+	 *
+	 * \return 0 if slot was committed successfully, error code otherwise:
+	 * - EINVAL - \a storage is not a pointer to slot of this queue;
+	 * - EPERM - slot pointed by \a storage is not reserved (it was never reserved or it was already committed);
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit(uint8_t priority, void* storage);
+
+	/**
+	 * \brief Peeks the oldest element with highest priority of the queue.
+	 *
+	 * Gives direct access to storage of the oldest element with highest priority and removes it from the queue, but the
+	 * slot is not reused until it is released with release().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int peek(uint8_t& priority, const void*& storage);
+
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
 	 *
@@ -152,6 +191,138 @@ public:
 		return push(priority, &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Releases the slot of element obtained with peek(), making it available for pushing.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [in] storage is a pointer to peeked element, returned by one of peek functions
+	 *
+	 * \return 0 if slot was released successfully, error code otherwise:
+	 * - EINVAL - \a storage is not a pointer to slot of this queue;
+	 * - EPERM - slot pointed by \a storage is not peeked (it was never peeked or it was already released);
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release(const void* storage);
+
+	/**
+	 * \brief Reserves free slot in the queue.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int reserve(void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest element with highest priority of the queue.
+	 *
+	 * Gives direct access to storage of the oldest element with highest priority and removes it from the queue, but the
+	 * slot is not reused until it is released with release().
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPeek(uint8_t& priority, const void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest element with highest priority of the queue for a given duration of time.
+	 *
+	 * Gives direct access to storage of the oldest element with highest priority and removes it from the queue, but the
+	 * slot is not reused until it is released with release().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryPeekFor(TickClock::duration duration, uint8_t& priority, const void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest element with highest priority of the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekFor(TickClock::duration, uint8_t&, const void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without peeking the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPeekFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, const void*& storage)
+	{
+		return tryPeekFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, storage);
+	}
+
+	/**
+	 * \brief Tries to peek the oldest element with highest priority of the queue until a given time point.
+	 *
+	 * Gives direct access to storage of the oldest element with highest priority and removes it from the queue, but the
+	 * slot is not reused until it is released with release().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPeekUntil(TickClock::time_point timePoint, uint8_t& priority, const void*& storage);
+
+	/**
+	 * \brief Tries to peek the oldest element with highest priority of the queue until a given time point.
+	 *
+	 * Template variant of tryPeekUntil(TickClock::time_point, uint8_t&, const void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without peeking the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPeekUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority,
+			const void*& storage)
+	{
+		return tryPeekUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, storage);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest element with highest priority from the queue.
 	 *
@@ -534,6 +705,101 @@ public:
 				sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to reserve free slot in the queue.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryReserve(void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryReserveFor(TickClock::duration duration, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReserveFor(TickClock::duration, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReserveFor(const std::chrono::duration<Rep, Period> duration, void*& storage)
+	{
+		return tryReserveFor(std::chrono::duration_cast<TickClock::duration>(duration), storage);
+	}
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * Gives direct access to storage of free slot, so the element can be constructed in place. The element is not
+	 * available for popping until the slot is committed with commit().
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryReserveUntil(TickClock::time_point timePoint, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * Template variant of tryReserveUntil(TickClock::time_point, void*&).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryReserveUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& storage)
+	{
+		return tryReserveUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), storage);
+	}
+
 private:
 
 	/**
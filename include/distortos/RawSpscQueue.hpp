@@ -0,0 +1,570 @@
+/**
+ * \file
+ * \brief RawSpscQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RAWSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_RAWSPSCQUEUE_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include <atomic>
+#include <memory>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class SemaphoreFunctor;
+
+}	// namespace internal
+
+/**
+ * \brief RawSpscQueue class is a lock-free ring buffer for single producer and single consumer of binary serializable
+ * types (like POD types).
+ *
+ * This queue is intended for streaming of data from interrupt to thread. Producer and consumer communicate only via
+ * atomic loads and stores of positions in the ring, so neither of them masks interrupts to transfer elements and no
+ * read-modify-write atomic operations are used - the queue works also on cores without LDREX/STREX instructions.
+ *
+ * Producer never blocks - when the queue is full, push fails. Consumer blocks only when the queue is empty. Before
+ * blocking it requests to be woken when at least \a wakeThreshold elements are available, so producer posts internal
+ * semaphore (and masks interrupts for this short moment) at most once per such batch, not for each element.
+ *
+ * Type \a T can be used with RawSpscQueue only when <em>std::is_trivially_copyable<T>::value == true</em>.
+ *
+ * \warning At any given moment only one thread or interrupt may call push functions and only one thread or interrupt
+ * may call pop functions.
+ *
+ * \ingroup queues
+ */
+
+class RawSpscQueue
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief RawSpscQueue's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] maxElements is the number of elements in storage memory block
+	 * \param [in] wakeThreshold is the number of elements which must be available to wake consumer waiting for empty
+	 * queue, values outside of [1; \a maxElements] range are clamped to this range, default - 1
+	 */
+
+	RawSpscQueue(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements,
+			size_t wakeThreshold = 1);
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * If the queue is empty, waits until at least \a wakeThreshold elements are available.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int pop(void* buffer, size_t size);
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	template<typename T>
+	int pop(T& buffer)
+	{
+		return pop(&buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Pops many oldest (first) elements from the queue.
+	 *
+	 * If the queue is empty, waits until at least \a wakeThreshold elements are available, then pops as many available
+	 * elements as fit in \a buffer.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	std::pair<int, size_t> popMany(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EAGAIN - queue is empty;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	int tryPop(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EAGAIN - queue is empty;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	template<typename T>
+	int tryPop(T& buffer)
+	{
+		return tryPop(&buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * If the queue is empty, waits until at least \a wakeThreshold elements are available. If the timeout expires when
+	 * any element is available, this element is popped.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopFor(TickClock::duration duration, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopFor(TickClock::duration, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without popping the element
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& buffer)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue.
+	 *
+	 * Pops as many available elements as fit in \a buffer.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EAGAIN - queue is empty;
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	std::pair<int, size_t> tryPopMany(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * If the queue is empty, waits until at least \a wakeThreshold elements are available, then pops as many available
+	 * elements as fit in \a buffer. If the timeout expires when any element is available, this element is popped, so
+	 * this function can be used to flush incomplete batches.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, size_t> tryPopManyFor(TickClock::duration duration, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopManyFor(TickClock::duration, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, size_t> tryPopManyFor(const std::chrono::duration<Rep, Period> duration, void* const buffer,
+			const size_t size)
+	{
+		return tryPopManyFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue until a given time point.
+	 *
+	 * If the queue is empty, waits until at least \a wakeThreshold elements are available, then pops as many available
+	 * elements as fit in \a buffer. If the timeout expires when any element is available, this element is popped, so
+	 * this function can be used to flush incomplete batches.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	std::pair<int, size_t> tryPopManyUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop many oldest (first) elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopManyUntil(TickClock::time_point, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	std::pair<int, size_t> tryPopManyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			void* const buffer, const size_t size)
+	{
+		return tryPopManyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * If the queue is empty, waits until at least \a wakeThreshold elements are available. If the timeout expires when
+	 * any element is available, this element is popped.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPopUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * Template variant of tryPopUntil(TickClock::time_point, void*, size_t).
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer,
+			const size_t size)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \warning This function must not be called from interrupt context!
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without popping the element
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return 0 if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration, typename T>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& buffer)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * Interrupts are masked only when consumer waiting for this element is woken.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawSpscQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - queue is full;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	int tryPush(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a reference to data that will be pushed to RawSpscQueue
+	 *
+	 * \return 0 if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - queue is full;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	template<typename T>
+	int tryPush(const T& data)
+	{
+		return tryPush(&data, sizeof(data));
+	}
+
+	/**
+	 * \brief Tries to push many elements to the queue.
+	 *
+	 * Pushes as many elements from \a data as fit in the queue. Interrupts are masked only when consumer waiting for
+	 * these elements is woken.
+	 *
+	 * \note This function never blocks, so it can be used from interrupt context.
+	 *
+	 * \param [in] data is a pointer to elements that will be pushed to RawSpscQueue
+	 * \param [in] size is the size of \a data, bytes - must be a multiple of the \a elementSize attribute of
+	 * RawSpscQueue
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EAGAIN - queue is full;
+	 * - EMSGSIZE - \a size is not a multiple of the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	std::pair<int, size_t> tryPushMany(const void* data, size_t size);
+
+	RawSpscQueue(const RawSpscQueue&) = delete;
+	RawSpscQueue(RawSpscQueue&&) = delete;
+	const RawSpscQueue& operator=(const RawSpscQueue&) = delete;
+	RawSpscQueue& operator=(RawSpscQueue&&) = delete;
+
+private:
+
+	/**
+	 * \brief Advances position in the ring.
+	 *
+	 * \param [in] position is the position which will be advanced, [0; 2 * \a maxElements_)
+	 * \param [in] count is the number of elements by which \a position will be advanced, [0; \a maxElements_]
+	 *
+	 * \return \a position advanced by \a count elements, [0; 2 * \a maxElements_)
+	 */
+
+	size_t advance(size_t position, size_t count) const;
+
+	/**
+	 * \brief Converts position in the ring to index of element in storage.
+	 *
+	 * \param [in] position is the position in the ring, [0; 2 * \a maxElements_)
+	 *
+	 * \return index of element in storage, [0; \a maxElements_)
+	 */
+
+	size_t getIndex(size_t position) const;
+
+	/**
+	 * \brief Gets number of elements between two positions in the ring.
+	 *
+	 * \param [in] readPosition is the position of the oldest element in the ring
+	 * \param [in] writePosition is the position after the newest element in the ring
+	 *
+	 * \return number of elements between \a readPosition and \a writePosition, [0; \a maxElements_]
+	 */
+
+	size_t getSize(size_t readPosition, size_t writePosition) const;
+
+	/**
+	 * \brief Pops many oldest (first) elements from the queue.
+	 *
+	 * Internal version - common for all pop functions.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a semaphore_
+	 * when the queue is empty
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] maxCount is the maximum number of elements which will be popped
+	 *
+	 * \return pair with return code (0 if at least one element was popped successfully, error code otherwise) and
+	 * number of popped elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	std::pair<int, size_t> popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer,
+			size_t maxCount);
+
+	/**
+	 * \brief Tries to push many elements to the queue.
+	 *
+	 * Internal version - common for all push functions.
+	 *
+	 * \param [in] data is a pointer to elements that will be pushed to RawSpscQueue
+	 * \param [in] maxCount is the maximum number of elements which will be pushed
+	 *
+	 * \return pair with return code (0 if at least one element was pushed successfully, error code otherwise) and
+	 * number of pushed elements; error codes:
+	 * - EAGAIN - queue is full;
+	 */
+
+	std::pair<int, size_t> pushInternal(const void* data, size_t maxCount);
+
+	/// semaphore used by consumer to wait for elements
+	Semaphore semaphore_;
+
+	/// storage for queue elements
+	StorageUniquePointer storageUniquePointer_;
+
+	/// position of the oldest element in the ring, written only by consumer, [0; 2 * \a maxElements_)
+	std::atomic<size_t> readPosition_;
+
+	/// position after the newest element in the ring, written only by producer, [0; 2 * \a maxElements_)
+	std::atomic<size_t> writePosition_;
+
+	/// size of single queue element, bytes
+	const size_t elementSize_;
+
+	/// number of elements in storage
+	const size_t maxElements_;
+
+	/// number of elements which must be available to wake consumer waiting for empty queue
+	const size_t wakeThreshold_;
+
+	/// true if consumer waits for the queue to contain at least \a wakeThreshold_ elements, false otherwise
+	std::atomic<bool> waiting_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RAWSPSCQUEUE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief SchedulingPolicy enum class header
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,9 @@ enum class SchedulingPolicy : uint8_t
 	fifo,
 	/// round-robin scheduling policy
 	roundRobin,
+	/// earliest-deadline-first scheduling policy - among threads with equal priority, the one with the earliest
+	/// deadline is executed first
+	earliestDeadlineFirst,
 };
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,8 +14,12 @@
 
 #include "distortos/internal/scheduler/ThreadList.hpp"
 
+#include "distortos/internal/synchronization/SemaphoreObserver.hpp"
+
 #include "distortos/TickClock.hpp"
 
+#include <atomic>
+
 namespace distortos
 {
 
@@ -24,6 +28,10 @@ namespace distortos
  *
  * Similar to POSIX semaphores - http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/V1_chap04.html#tag_04_16
  *
+ * If the architecture supports lock-free atomic operations on Value type, tryWait() and post() don't mask interrupts in
+ * the common case - the value is modified with atomic compare-and-swap. post() takes the slow path (with interrupts
+ * masked) only when any thread is blocked on the semaphore or any observer is attached to it.
+ *
  * \ingroup synchronization
  */
 
@@ -47,8 +55,26 @@ public:
 
 	constexpr explicit Semaphore(const Value value, const Value maxValue = std::numeric_limits<Value>::max()) :
 			blockedList_{},
+			observerList_{},
 			value_{value < maxValue ? value : maxValue},
-			maxValue_{maxValue}
+			maxValue_{maxValue},
+			waiting_{}
+	{
+
+	}
+
+	/**
+	 * \brief Semaphore's move constructor
+	 *
+	 * \param [in] other is a rvalue reference to Semaphore used as source of move construction
+	 */
+
+	Semaphore(Semaphore&& other) :
+			blockedList_{std::move(other.blockedList_)},
+			observerList_{std::move(other.observerList_)},
+			value_{other.value_.load(std::memory_order_relaxed)},
+			maxValue_{other.maxValue_},
+			waiting_{other.waiting_.load(std::memory_order_relaxed)}
 	{
 
 	}
@@ -64,6 +90,19 @@ public:
 
 	~Semaphore() = default;
 
+	/**
+	 * \brief Attaches observer to the semaphore.
+	 *
+	 * The observer is notified - and detached - by the first post() which increments the value of semaphore. If the
+	 * observer is already attached to any semaphore, it is detached from it first.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] observer is a reference to observer which will be attached
+	 */
+
+	void attach(internal::SemaphoreObserver& observer);
+
 	/**
 	 * \brief Gets current value of semaphore.
 	 *
@@ -74,7 +113,7 @@ public:
 
 	Value getValue() const
 	{
-		return value_;
+		return value_.load(std::memory_order_relaxed);
 	}
 
 	/**
@@ -89,6 +128,8 @@ public:
 	 * shall be unblocked, and if there is more than one highest priority thread blocked waiting for the semaphore, then
 	 * the highest priority thread that has been waiting the longest shall be unblocked.
 	 *
+	 * If the semaphore value was incremented, all observers attached to the semaphore are notified and detached.
+	 *
 	 * \return 0 if the calling process successfully "posted" the semaphore, error code otherwise:
 	 * - EOVERFLOW - the maximum allowable value for a semaphore would be exceeded;
 	 */
@@ -220,12 +261,23 @@ public:
 	int wait();
 
 	Semaphore(const Semaphore&) = delete;
-	Semaphore(Semaphore&&) = default;
 	const Semaphore& operator=(const Semaphore&) = delete;
 	Semaphore& operator=(Semaphore&&) = delete;
 
 private:
 
+	/**
+	 * \brief Slow path of post().
+	 *
+	 * Passes the value of semaphore - which was just incremented - to the first blocked thread or notifies (and
+	 * detaches) all attached observers if there are no blocked threads. Afterwards waiting_ is updated to reflect the
+	 * current state of both lists.
+	 *
+	 * \attention must be called with interrupts masked
+	 */
+
+	void handOver();
+
 	/**
 	 * \brief Internal version of tryWait().
 	 *
@@ -240,11 +292,19 @@ private:
 	/// ThreadControlBlock objects blocked on this semaphore
 	internal::ThreadList blockedList_;
 
-	/// internal value of the semaphore
-	Value value_;
+	/// observers attached to this semaphore
+	internal::SemaphoreObserverList observerList_;
+
+	/// internal value of the semaphore; modified with atomic compare-and-swap in fast paths, all other modifications
+	/// are done with interrupts masked
+	std::atomic<Value> value_;
 
 	/// max value of the semaphore
 	Value maxValue_;
+
+	/// true if any thread may be blocked on the semaphore or any observer may be attached to it - post() must use the
+	/// slow path, false otherwise
+	std::atomic<bool> waiting_;
 };
 
 }	// namespace distortos
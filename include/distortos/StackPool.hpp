@@ -0,0 +1,201 @@
+/**
+ * \file
+ * \brief StackPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STACKPOOL_HPP_
+#define INCLUDE_DISTORTOS_STACKPOOL_HPP_
+
+#include <memory>
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class DynamicThreadBase;
+
+}	// namespace internal
+
+/**
+ * \brief StackPool class is a pool of fixed-size blocks of storage for DynamicThread objects.
+ *
+ * Each pool is a single "size class" - all its blocks are large enough for a thread with given size of stack. Several
+ * pools with different sizes of stack may be used at the same time. A thread which selects the pool in its
+ * DynamicThreadParameters gets its stack - and, if thread detachment is enabled, its internal thread object - from
+ * single block of the pool, instead of allocating them from the heap. Free blocks are linked in a list, so taking a
+ * block from the pool and returning it there are O(1) operations with masked interrupts, which never use the mutex that
+ * protects the heap. The block is returned to its pool directly when the thread is destroyed - also when the thread was
+ * detached and is deleted by DeferredThreadDeleter.
+ *
+ * \note Bound function object of the thread and - if signals are enabled - its DynamicSignalsReceiver may still use the
+ * heap.
+ *
+ * This class provides only the pool - its storage is provided by StaticStackPool or DynamicStackPool.
+ *
+ * \ingroup threads
+ */
+
+class StackPool
+{
+	friend class internal::DynamicThreadBase;
+
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief Header of each block, placed right before the storage of block
+	 *
+	 * While the block is allocated, its header holds a pointer to the pool which owns it. While the block is free, its
+	 * header holds a pointer to the next free block.
+	 */
+
+	struct BlockHeader
+	{
+		/// pointer to pool which owns the block, nullptr if the block was allocated from the heap
+		StackPool* owner;
+
+		/// pointer to header of next free block, nullptr if this is the last free block
+		BlockHeader* next;
+	};
+
+	/// size of block header, multiple of alignment of dynamically allocated memory, bytes
+	constexpr static size_t blockHeaderSize
+	{
+		(sizeof(BlockHeader) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t)
+	};
+
+	/**
+	 * \brief Gets size of storage required by single block (including its header).
+	 *
+	 * \param [in] blockSize is the size of single block (excluding its header), bytes
+	 *
+	 * \return size of storage required by single block (including its header), multiple of alignment of dynamically
+	 * allocated memory, bytes
+	 */
+
+	constexpr static size_t getBlockStorageSize(const size_t blockSize)
+	{
+		return blockHeaderSize + (blockSize + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+	}
+
+	/**
+	 * \brief StackPool's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for \a blocks blocks
+	 * (sufficiently large for \a blocks elements of size equal to getBlockStorageSize() called with block size required
+	 * by \a stackSize, aligned to alignment of dynamically allocated memory) and appropriate deleter
+	 * \param [in] stackSize is the size of stack of threads using blocks of the pool, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 */
+
+	StackPool(StorageUniquePointer&& storageUniquePointer, size_t stackSize, size_t blocks);
+
+	/**
+	 * \brief StackPool's destructor
+	 *
+	 * \warning All threads using blocks of the pool must be destroyed before the pool is destroyed.
+	 */
+
+	~StackPool();
+
+	/**
+	 * \return size of single block (excluding its header), bytes
+	 */
+
+	size_t getBlockSize() const
+	{
+		return blockSize_;
+	}
+
+	/**
+	 * \return number of free blocks in the pool
+	 */
+
+	size_t getFreeBlocks() const
+	{
+		return freeBlocks_;
+	}
+
+	/**
+	 * \return size of stack of threads using blocks of the pool, bytes
+	 */
+
+	size_t getStackSize() const
+	{
+		return stackSize_;
+	}
+
+	StackPool(const StackPool&) = delete;
+	StackPool(StackPool&&) = delete;
+	const StackPool& operator=(const StackPool&) = delete;
+	StackPool& operator=(StackPool&&) = delete;
+
+private:
+
+	/**
+	 * \brief Allocates block from the pool.
+	 *
+	 * \return pointer to storage of allocated block (aligned to alignment of dynamically allocated memory), nullptr if
+	 * the pool has no free blocks
+	 */
+
+	void* allocate();
+
+	/**
+	 * \brief Allocates block with header from the heap.
+	 *
+	 * This can be used for objects which are deallocated with deallocate(), but which were not allocated from any pool.
+	 *
+	 * \param [in] size is the size of block (excluding its header), bytes
+	 *
+	 * \return pointer to storage of allocated block (aligned to alignment of dynamically allocated memory), nullptr if
+	 * the allocation failed
+	 */
+
+	static void* allocateFromHeap(size_t size);
+
+	/**
+	 * \brief Deallocates block.
+	 *
+	 * The block is returned to the pool which owns it or - if it was allocated with allocateFromHeap() - to the heap.
+	 *
+	 * \param [in] block is a pointer to storage of block (as returned by allocate() or allocateFromHeap()), nullptr is
+	 * ignored
+	 */
+
+	static void deallocate(void* block);
+
+	/// storage for blocks
+	StorageUniquePointer storageUniquePointer_;
+
+	/// pointer to header of first free block, nullptr if the pool has no free blocks
+	BlockHeader* freeList_;
+
+	/// size of single block (excluding its header), bytes
+	size_t blockSize_;
+
+	/// number of blocks in the pool
+	size_t blocks_;
+
+	/// number of free blocks in the pool
+	size_t freeBlocks_;
+
+	/// size of stack of threads using blocks of the pool, bytes
+	size_t stackSize_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STACKPOOL_HPP_
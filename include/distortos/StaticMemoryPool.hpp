@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief StaticMemoryPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+
+#include "distortos/MemoryPool.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <type_traits>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticMemoryPool class is a variant of MemoryPool that has automatic storage for blocks.
+ *
+ * \tparam BlockSize is the size of single block, bytes
+ * \tparam Blocks is the number of blocks in the pool
+ *
+ * \ingroup synchronization
+ */
+
+template<size_t BlockSize, size_t Blocks>
+class StaticMemoryPool : public MemoryPool
+{
+public:
+
+	/**
+	 * \brief StaticMemoryPool's constructor
+	 */
+
+	explicit StaticMemoryPool() :
+			MemoryPool{{&storage_, internal::dummyDeleter<Storage>}, BlockSize, Blocks}
+	{
+
+	}
+
+private:
+
+	/// type of uninitialized storage for blocks and map of allocated blocks
+	using Storage = typename std::aligned_storage<getStorageSize(BlockSize, Blocks), alignof(max_align_t)>::type;
+
+	/// storage for blocks and map of allocated blocks
+	Storage storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
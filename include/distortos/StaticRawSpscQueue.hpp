@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief StaticRawSpscQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICRAWSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICRAWSPSCQUEUE_HPP_
+
+#include "RawSpscQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticRawSpscQueue class is a variant of RawSpscQueue that has automatic storage for queue's contents.
+ *
+ * \tparam ElementSize is the size of single queue element, bytes
+ * \tparam QueueSize is the maximum number of elements in queue
+ *
+ * \ingroup queues
+ */
+
+template<size_t ElementSize, size_t QueueSize>
+class StaticRawSpscQueue : public RawSpscQueue
+{
+public:
+
+	/**
+	 * \brief StaticRawSpscQueue's constructor
+	 *
+	 * \param [in] wakeThreshold is the number of elements which must be available to wake consumer waiting for empty
+	 * queue, default - 1
+	 */
+
+	explicit StaticRawSpscQueue(const size_t wakeThreshold = 1) :
+			RawSpscQueue{{storage_.data(), internal::dummyDeleter<uint8_t>}, ElementSize, QueueSize, wakeThreshold}
+	{
+
+	}
+
+private:
+
+	/// storage for queue's contents
+	std::array<uint8_t, ElementSize * QueueSize> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICRAWSPSCQUEUE_HPP_
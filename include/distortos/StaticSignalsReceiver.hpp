@@ -22,6 +22,8 @@
 
 #include "distortos/internal/memory/dummyDeleter.hpp"
 
+#include <array>
+
 namespace distortos
 {
 
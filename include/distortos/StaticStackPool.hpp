@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \brief StaticStackPool class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICSTACKPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICSTACKPOOL_HPP_
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include "distortos/internal/scheduler/DynamicThreadBase.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticStackPool class is a variant of StackPool that has automatic storage for blocks.
+ *
+ * \tparam StackSize is the size of stack of threads using blocks of the pool, bytes
+ * \tparam Blocks is the number of blocks in the pool
+ *
+ * \ingroup threads
+ */
+
+template<size_t StackSize, size_t Blocks>
+class StaticStackPool : public StackPool
+{
+public:
+
+	/**
+	 * \brief StaticStackPool's constructor
+	 */
+
+	explicit StaticStackPool() :
+			StackPool{{storage_.data(), internal::dummyDeleter<Storage>}, StackSize, Blocks}
+	{
+
+	}
+
+private:
+
+	/// type of uninitialized storage for single block (including its header)
+	using Storage = typename std::aligned_storage<
+			getBlockStorageSize(internal::DynamicThreadBase::getStackPoolBlockSize(StackSize)),
+			alignof(max_align_t)>::type;
+
+	/// storage for blocks
+	std::array<Storage, Blocks> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICSTACKPOOL_HPP_
@@ -96,9 +96,10 @@ protected:
 
 private:
 
-	/// size of stack adjusted to alignment requirements, bytes
-	constexpr static size_t adjustedStackSize {(StackSize + CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) /
-			CONFIG_ARCHITECTURE_STACK_ALIGNMENT * CONFIG_ARCHITECTURE_STACK_ALIGNMENT};
+	/// size of stack (with architecture-specific overhead) adjusted to alignment requirements, bytes
+	constexpr static size_t adjustedStackSize {(StackSize + CONFIG_ARCHITECTURE_STACK_OVERHEAD +
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT};
 
 	/// stack buffer
 	alignas(CONFIG_ARCHITECTURE_STACK_ALIGNMENT)
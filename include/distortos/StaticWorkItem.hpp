@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief StaticWorkItem class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICWORKITEM_HPP_
+#define INCLUDE_DISTORTOS_STATICWORKITEM_HPP_
+
+#include "distortos/WorkItem.hpp"
+
+#include <functional>
+
+namespace distortos
+{
+
+/// \addtogroup workQueues
+/// \{
+
+/**
+ * \brief StaticWorkItem class is a templated interface for work item
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for function
+ */
+
+template<typename Function, typename... Args>
+class StaticWorkItem : public WorkItem
+{
+public:
+
+	/**
+	 * \brief StaticWorkItem's constructor
+	 *
+	 * \param [in] function is a function that will be executed by worker thread of WorkQueue
+	 * \param [in] args are arguments for function
+	 */
+
+	StaticWorkItem(Function&& function, Args&&... args) :
+			WorkItem{},
+			boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief "Run" function of work item
+	 *
+	 * Executes bound function object.
+	 */
+
+	void run() override
+	{
+		boundFunction_();
+	}
+
+	/// bound function object
+	decltype(std::bind(std::declval<Function>(), std::declval<Args>()...)) boundFunction_;
+};
+
+/**
+ * \brief Helper factory function to make StaticWorkItem object with deduced template arguments
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for function
+ *
+ * \param [in] function is a function that will be executed by worker thread of WorkQueue
+ * \param [in] args are arguments for function
+ *
+ * \return StaticWorkItem object with deduced template arguments
+ */
+
+template<typename Function, typename... Args>
+StaticWorkItem<Function, Args...> makeStaticWorkItem(Function&& function, Args&&... args)
+{
+	return {std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICWORKITEM_HPP_
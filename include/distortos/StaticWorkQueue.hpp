@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \brief StaticWorkQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICWORKQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICWORKQUEUE_HPP_
+
+#include "distortos/StaticThread.hpp"
+#include "distortos/WorkQueue.hpp"
+
+#include "estd/IntegerSequence.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticWorkQueue class is a variant of WorkQueue that has automatic storage for worker threads.
+ *
+ * \tparam StackSize is the size of stack of each worker thread, bytes
+ * \tparam Workers is the number of worker threads
+ *
+ * \ingroup workQueues
+ */
+
+template<size_t StackSize, size_t Workers = 1>
+class StaticWorkQueue : public WorkQueue
+{
+public:
+
+	static_assert(Workers > 0, "StaticWorkQueue requires at least one worker thread!");
+
+	/**
+	 * \brief StaticWorkQueue's constructor
+	 *
+	 * \param [in] priority is the priority of worker threads, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of worker threads, default - SchedulingPolicy::fifo
+	 */
+
+	explicit StaticWorkQueue(const uint8_t priority, const SchedulingPolicy schedulingPolicy = SchedulingPolicy::fifo) :
+			StaticWorkQueue{priority, schedulingPolicy, estd::MakeIntegerSequence<size_t, Workers>{}}
+	{
+
+	}
+
+	/**
+	 * \brief StaticWorkQueue's destructor
+	 *
+	 * Worker threads which were started are stopped and joined.
+	 *
+	 * \warning Work items which are still pending in the queue are not executed - they are dropped silently. If all
+	 * submitted work items must be executed, user code must ensure that the queue is empty before it is destroyed.
+	 */
+
+	~StaticWorkQueue();
+
+	/**
+	 * \brief Starts worker threads of the queue.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by Thread::start();
+	 */
+
+	int start();
+
+private:
+
+	/// type of worker thread
+	using Worker = StaticThread<StackSize, false, 0, 0, void (WorkQueue::*)(), WorkQueue*>;
+
+	/**
+	 * \brief StaticWorkQueue's constructor
+	 *
+	 * \tparam Indexes is a sequence of indexes of worker threads
+	 *
+	 * \param [in] priority is the priority of worker threads, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of worker threads
+	 * \param [in] indexSequence is an unused integer sequence with indexes of worker threads
+	 */
+
+	template<size_t... Indexes>
+	StaticWorkQueue(const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+			estd::IndexSequence<Indexes...>) :
+			WorkQueue{},
+			workers_
+			{{
+					{(static_cast<void>(Indexes), priority), schedulingPolicy, &StaticWorkQueue::run,
+							static_cast<WorkQueue*>(this)}...
+			}}
+	{
+
+	}
+
+	/// worker threads of the queue
+	std::array<Worker, Workers> workers_;
+};
+
+template<size_t StackSize, size_t Workers>
+StaticWorkQueue<StackSize, Workers>::~StaticWorkQueue()
+{
+	requestStop(Workers);
+
+	for (auto& worker : workers_)
+		if (worker.getState() != ThreadState::created)
+			worker.join();
+}
+
+template<size_t StackSize, size_t Workers>
+int StaticWorkQueue<StackSize, Workers>::start()
+{
+	for (auto& worker : workers_)
+	{
+		const auto ret = worker.start();
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICWORKQUEUE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,6 +19,7 @@ namespace distortos
 {
 
 class Thread;
+class ThreadGroup;
 class ThreadIdentifier;
 
 namespace ThisThread
@@ -68,6 +69,22 @@ void exit();
 
 Thread& get();
 
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return absolute deadline of current job of calling (current) thread, TickClock::time_point::max() if not set
+ */
+
+TickClock::time_point getDeadline();
+
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return number of deadline misses of calling (current) thread
+ */
+
+uint32_t getDeadlineMissCount();
+
 /**
  * \warning This function must not be called from interrupt context!
  *
@@ -92,6 +109,18 @@ ThreadIdentifier getIdentifier();
 
 uint8_t getPriority();
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/**
+ * \warning This function must not be called from interrupt context!
+ *
+ * \return total run time of calling (current) thread, excluding time spent in tick interrupt handler
+ */
+
+std::chrono::nanoseconds getRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 /**
  * \return scheduling policy of calling (current) thread
  */
@@ -114,6 +143,23 @@ size_t getStackHighWaterMark();
 
 size_t getStackSize();
 
+/**
+ * \brief Sets absolute deadline of next job of calling (current) thread.
+ *
+ * Deadline is used for scheduling only by threads with SchedulingPolicy::earliestDeadlineFirst - among threads with
+ * equal priority, the one with the earliest deadline is executed first. Deadline should be set at the release of each
+ * job (for example after returning from sleepUntil() in a periodic thread). Previous job is considered to be finished
+ * when its deadline is replaced, so if previous deadline already passed at that moment, deadline miss is counted. To
+ * detect misses precisely, the deadline should be cleared (by setting it to TickClock::time_point::max()) right after
+ * the job is finished.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] deadline is the new absolute deadline, TickClock::time_point::max() to clear the deadline
+ */
+
+void setDeadline(TickClock::time_point deadline);
+
 /**
  * Changes priority of calling (current) thread.
  *
@@ -133,6 +179,22 @@ void setPriority(uint8_t priority, bool alwaysBehind = {});
 
 void setSchedulingPolicy(SchedulingPolicy schedulingPolicy);
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+/**
+ * \brief Moves calling (current) thread to another thread group.
+ *
+ * All threads started by calling (current) thread after this call will also belong to \a threadGroup.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] threadGroup is a reference to ThreadGroup to which calling (current) thread will be moved
+ */
+
+void setThreadGroup(ThreadGroup& threadGroup);
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 /**
  * \brief Makes the calling (current) thread sleep for at least given duration.
  *
@@ -2,7 +2,7 @@
  * \file
  * \brief Thread class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -20,6 +20,12 @@
 
 #include <csignal>
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#include <chrono>
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 namespace distortos
 {
 
@@ -84,6 +90,12 @@ public:
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+	/**
+	 * \return number of deadline misses of thread
+	 */
+
+	virtual uint32_t getDeadlineMissCount() const = 0;
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -121,6 +133,16 @@ public:
 
 	virtual uint8_t getPriority() const = 0;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return total run time of thread, excluding time spent in tick interrupt handler
+	 */
+
+	virtual std::chrono::nanoseconds getRunTime() const = 0;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -0,0 +1,115 @@
+/**
+ * \file
+ * \brief ThreadGroup class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_THREADGROUP_HPP_
+#define INCLUDE_DISTORTOS_THREADGROUP_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+}	// namespace internal
+
+/**
+ * \brief ThreadGroup class is a group of threads which share common CPU budget.
+ *
+ * Threads are moved to the group with ThisThread::setThreadGroup() and all threads started by them later are also
+ * added to this group. Budget limits the number of ticks in which threads of the group may run with their normal
+ * priority in one replenishment period. When the budget is exhausted, all threads of the group are demoted to priority
+ * 0 until the budget is replenished, so they cannot starve threads with lower priority which belong to other groups.
+ * Consumption of full budget starts the replenishment period - budget is replenished when this period ends.
+ *
+ * \warning ThreadGroup object must not be destroyed while any thread belongs to it.
+ *
+ * \ingroup threads
+ */
+
+class ThreadGroup
+{
+	friend internal::ThreadControlBlock;
+
+public:
+
+	/**
+	 * \brief ThreadGroup's constructor
+	 *
+	 * Budget of the group is initially disabled.
+	 */
+
+	constexpr ThreadGroup() :
+			threadGroupControlBlock_{}
+	{
+
+	}
+
+	/**
+	 * \return number of times the budget of the group was exhausted
+	 */
+
+	uint32_t getExhaustionCount() const
+	{
+		return threadGroupControlBlock_.getExhaustionCount();
+	}
+
+	/**
+	 * \return remaining budget of the group, 0 if the budget is disabled
+	 */
+
+	TickClock::duration getRemainingBudget() const
+	{
+		return threadGroupControlBlock_.getRemainingBudget();
+	}
+
+	/**
+	 * \brief Sets budget and replenishment period of the group.
+	 *
+	 * Remaining budget is set to \a budget and threads of the group which were demoted are restored to their normal
+	 * priority.
+	 *
+	 * \param [in] budget is the number of ticks which may be used by threads of the group in one replenishment period,
+	 * 0 to disable the budget
+	 * \param [in] period is the replenishment period, ignored if \a budget is 0
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - error codes returned by internal::ThreadGroupControlBlock::setBudget();
+	 */
+
+	int setBudget(const TickClock::duration budget, const TickClock::duration period)
+	{
+		return threadGroupControlBlock_.setBudget(budget, period);
+	}
+
+	ThreadGroup(const ThreadGroup&) = delete;
+	ThreadGroup(ThreadGroup&&) = delete;
+	const ThreadGroup& operator=(const ThreadGroup&) = delete;
+	ThreadGroup& operator=(ThreadGroup&&) = delete;
+
+private:
+
+	/// contained internal::ThreadGroupControlBlock object
+	internal::ThreadGroupControlBlock threadGroupControlBlock_;
+};
+
+}	// namespace distortos
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_THREADGROUP_HPP_
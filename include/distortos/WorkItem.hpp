@@ -0,0 +1,155 @@
+/**
+ * \file
+ * \brief WorkItem class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WORKITEM_HPP_
+#define INCLUDE_DISTORTOS_WORKITEM_HPP_
+
+#include "distortos/SoftwareTimerCommon.hpp"
+
+#include "estd/IntrusiveList.hpp"
+
+namespace distortos
+{
+
+class WorkQueue;
+
+/**
+ * \brief WorkItem class is an abstract interface for a piece of work which is executed by worker thread of WorkQueue.
+ *
+ * Work item is linked in the queue with an intrusive node and contains its own software timer used for delayed
+ * submission, so submitting, cancelling and resubmitting it never requires dynamic memory allocation. At any given
+ * moment work item may be pending in at most one queue.
+ *
+ * \ingroup workQueues
+ */
+
+class WorkItem
+{
+	friend class WorkQueue;
+
+public:
+
+	/**
+	 * \brief WorkItem's constructor
+	 */
+
+	constexpr WorkItem() :
+			node_{},
+			delayTimer_{*this},
+			workQueue_{}
+	{
+
+	}
+
+	/**
+	 * \brief WorkItem's move constructor
+	 *
+	 * State of source object is not transferred - constructed work item is neither pending nor delayed. Source object
+	 * must be neither pending nor delayed.
+	 */
+
+	constexpr WorkItem(WorkItem&&) :
+			WorkItem{}
+	{
+
+	}
+
+	/**
+	 * \brief WorkItem's destructor
+	 *
+	 * Work item is cancelled.
+	 *
+	 * \warning Work item must not be destroyed while it is executed.
+	 */
+
+	virtual ~WorkItem();
+
+	/**
+	 * \brief Cancels the work item.
+	 *
+	 * Work item which is pending in the queue is removed from it, delayed submission of work item is stopped. Work item
+	 * which is currently being executed is not affected.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EALREADY - work item was neither pending nor delayed;
+	 */
+
+	int cancel();
+
+	/**
+	 * \return true if the work item is pending in the queue or its delayed submission is in progress, false otherwise
+	 */
+
+	bool isPending() const;
+
+	WorkItem(const WorkItem&) = delete;
+	const WorkItem& operator=(const WorkItem&) = delete;
+	WorkItem& operator=(WorkItem&&) = delete;
+
+protected:
+
+	/**
+	 * \brief "Run" function of work item
+	 *
+	 * This function is executed by worker thread of the queue to which the work item was submitted.
+	 */
+
+	virtual void run() = 0;
+
+private:
+
+	/// DelayTimer class is a software timer which submits the work item to its queue when the delay ends
+	class DelayTimer : public SoftwareTimerCommon
+	{
+	public:
+
+		/**
+		 * \brief DelayTimer's constructor
+		 *
+		 * \param [in] owner is a reference to WorkItem object that owns this DelayTimer
+		 */
+
+		constexpr explicit DelayTimer(WorkItem& owner) :
+				SoftwareTimerCommon{},
+				owner_{owner}
+		{
+
+		}
+
+	private:
+
+		/**
+		 * \brief "Run" function of software timer
+		 *
+		 * Submits the work item to its queue.
+		 */
+
+		void run() override;
+
+		/// reference to WorkItem object that owns this DelayTimer
+		WorkItem& owner_;
+	};
+
+	/// node for intrusive list of work items pending in the queue
+	estd::IntrusiveListNode node_;
+
+	/// software timer used for delayed submission
+	DelayTimer delayTimer_;
+
+	/// pointer to WorkQueue to which the work item was submitted, nullptr if the work item was never submitted
+	WorkQueue* workQueue_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WORKITEM_HPP_
@@ -0,0 +1,238 @@
+/**
+ * \file
+ * \brief WorkQueue class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_WORKQUEUE_HPP_
+#define INCLUDE_DISTORTOS_WORKQUEUE_HPP_
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/WorkItem.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief WorkQueue class is a queue of work items which are executed by worker threads of the queue.
+ *
+ * Work items are linked in the queue with intrusive nodes, so submitting, cancelling and resubmitting them never
+ * requires dynamic memory allocation. Work items are executed in the order of their submission. Delayed submission of
+ * work item is handled by its own software timer, which submits the work item to the queue in system tick interrupt
+ * handler when the delay ends.
+ *
+ * This class provides only the queue and the "run" function of worker threads - worker threads themselves are provided
+ * by StaticWorkQueue.
+ *
+ * \warning If the queue has more than one worker thread, work item which is resubmitted while it is being executed may
+ * be executed by another worker thread concurrently with its previous execution.
+ *
+ * \ingroup workQueues
+ */
+
+class WorkQueue
+{
+	friend class WorkItem;
+
+public:
+
+	/**
+	 * \brief WorkQueue's constructor
+	 */
+
+	constexpr WorkQueue() :
+			pendingList_{},
+			semaphore_{0},
+			stopRequested_{}
+	{
+
+	}
+
+	/**
+	 * \brief WorkQueue's destructor
+	 *
+	 * Work items which are still pending in the queue are removed from it.
+	 *
+	 * \warning Delayed submissions of work items to the queue must be cancelled before the queue is destroyed.
+	 */
+
+	~WorkQueue();
+
+	/**
+	 * \brief Submits work item to the queue.
+	 *
+	 * If the work item is already pending in this queue, this function does nothing. If the delayed submission of the
+	 * work item to this queue is in progress, the delay is cancelled and the work item is submitted immediately.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] workItem is a reference to submitted work item
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	int submit(WorkItem& workItem);
+
+	/**
+	 * \brief Submits work item to the queue after given duration of time.
+	 *
+	 * If the work item is already pending in this queue or its delayed submission to this queue is in progress, the
+	 * submission is rescheduled.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] workItem is a reference to submitted work item
+	 * \param [in] duration is the duration after which the work item will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	int submitAfter(WorkItem& workItem, TickClock::duration duration);
+
+	/**
+	 * \brief Submits work item to the queue after given duration of time.
+	 *
+	 * Template variant of submitAfter(WorkItem&, TickClock::duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] workItem is a reference to submitted work item
+	 * \param [in] duration is the duration after which the work item will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	template<typename Rep, typename Period>
+	int submitAfter(WorkItem& workItem, const std::chrono::duration<Rep, Period> duration)
+	{
+		return submitAfter(workItem, std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Submits work item to the queue at given time point.
+	 *
+	 * If the work item is already pending in this queue or its delayed submission to this queue is in progress, the
+	 * submission is rescheduled.
+	 *
+	 * \note This function can be used from thread and interrupt context.
+	 *
+	 * \param [in] workItem is a reference to submitted work item
+	 * \param [in] timePoint is the time point at which the work item will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	int submitAt(WorkItem& workItem, TickClock::time_point timePoint);
+
+	/**
+	 * \brief Submits work item to the queue at given time point.
+	 *
+	 * Template variant of submitAt(WorkItem&, TickClock::time_point).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] workItem is a reference to submitted work item
+	 * \param [in] timePoint is the time point at which the work item will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	template<typename Duration>
+	int submitAt(WorkItem& workItem, const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return submitAt(workItem, std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	WorkQueue(const WorkQueue&) = delete;
+	WorkQueue(WorkQueue&&) = delete;
+	const WorkQueue& operator=(const WorkQueue&) = delete;
+	WorkQueue& operator=(WorkQueue&&) = delete;
+
+protected:
+
+	/**
+	 * \brief Requests all worker threads of the queue to stop.
+	 *
+	 * Each worker thread returns from run() as soon as it finishes execution of current work item.
+	 *
+	 * \warning Work items which are still pending in the queue are not executed - they are dropped silently when the
+	 * queue is destroyed.
+	 *
+	 * \param [in] workers is the number of worker threads of the queue
+	 */
+
+	void requestStop(size_t workers);
+
+	/**
+	 * \brief "Run" function of worker thread
+	 *
+	 * Waits for work items submitted to the queue and executes them, until requestStop() is called.
+	 */
+
+	void run();
+
+private:
+
+	/// intrusive list of work items
+	using List = estd::IntrusiveList<WorkItem, &WorkItem::node_>;
+
+	/**
+	 * \brief Cancels work item - internal version, with no interrupt masking.
+	 *
+	 * \param [in] workItem is a reference to cancelled work item, which must have been submitted to this queue
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EALREADY - work item was neither pending nor delayed;
+	 */
+
+	int cancelInternal(WorkItem& workItem);
+
+	/**
+	 * \brief Prepares work item for delayed submission to the queue - internal version, with no interrupt masking.
+	 *
+	 * If the work item is already pending in this queue or its delayed submission to this queue is in progress, it is
+	 * cancelled.
+	 *
+	 * \param [in] workItem is a reference to work item which will be submitted
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	int prepareDelayedSubmissionInternal(WorkItem& workItem);
+
+	/**
+	 * \brief Submits work item to the queue - internal version, with no interrupt masking.
+	 *
+	 * \param [in] workItem is a reference to submitted work item
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EBUSY - work item is pending in another queue or its delayed submission to another queue is in progress;
+	 */
+
+	int submitInternal(WorkItem& workItem);
+
+	/// list of work items pending in the queue
+	List pendingList_;
+
+	/// semaphore with value equal to the number of work items pending in the queue
+	Semaphore semaphore_;
+
+	/// true if worker threads should stop, false otherwise
+	bool stopRequested_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_WORKQUEUE_HPP_
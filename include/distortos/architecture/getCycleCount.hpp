@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief getCycleCount() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Gets current value of high-resolution cycle counter.
+ *
+ * The counter is monotonic and never overflows. Its frequency is returned by getCycleCountFrequency().
+ *
+ * \pre Interrupts are masked.
+ *
+ * \return current value of high-resolution cycle counter
+ */
+
+uint64_t getCycleCount();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETCYCLECOUNT_HPP_
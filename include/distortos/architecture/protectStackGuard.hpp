@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief protectStackGuard() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_PROTECTSTACKGUARD_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_PROTECTSTACKGUARD_HPP_
+
+#include "distortos/architecture/stackGuardProtectionGranularity.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific hardware protection of "stack guard".
+ *
+ * Makes provided memory region read-only, so that any write to it - caused by stack overflow - results in a fault.
+ * Only one region is protected at any given time - protection of region passed to previous call of this function is
+ * removed.
+ *
+ * \attention \a begin and \a size must be properly adjusted for architecture requirements - \a size must be a power
+ * of two which is not smaller than stackGuardProtectionGranularity and \a begin must be aligned to \a size
+ *
+ * \param [in] begin is a pointer to the beginning of protected region
+ * \param [in] size is the size of protected region, bytes
+ */
+
+void protectStackGuard(void* begin, size_t size);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_PROTECTSTACKGUARD_HPP_
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief startTicklessIdle() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_STARTTICKLESSIDLE_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_STARTTICKLESSIDLE_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific start of tickless idle mode.
+ *
+ * Replaces periodic tick interrupt with a one-shot timer, which will generate tick interrupt at the moment when the
+ * \a ticks -th periodic tick interrupt would be generated. Architecture may limit the number of ticks to the maximum
+ * supported by its timer - architecture::stopTicklessIdle() reports the number of ticks that actually elapsed.
+ *
+ * \pre Interrupts are masked.
+ * \pre \a ticks is greater than 1.
+ *
+ * \param [in] ticks is the number of ticks after which tick interrupt should be generated
+ */
+
+void startTicklessIdle(uint64_t ticks);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_STARTTICKLESSIDLE_HPP_
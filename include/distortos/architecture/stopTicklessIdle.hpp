@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief stopTicklessIdle() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_STOPTICKLESSIDLE_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_STOPTICKLESSIDLE_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific end of tickless idle mode.
+ *
+ * Restores periodic tick interrupt, keeping its phase unchanged. If the one-shot timer configured by
+ * architecture::startTicklessIdle() already expired, the tick interrupt it generated is left pending.
+ *
+ * \pre Interrupts are masked.
+ *
+ * \return number of ticks which elapsed since the call to architecture::startTicklessIdle() and which were not (and will
+ * not be) signaled with tick interrupt
+ */
+
+uint64_t stopTicklessIdle();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_STOPTICKLESSIDLE_HPP_
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief waitForInterrupt() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_WAITFORINTERRUPT_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_WAITFORINTERRUPT_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific wait for interrupt.
+ *
+ * Puts the core in low-power state until any interrupt becomes pending. The interrupt is not handled - it stays pending
+ * until interrupt masking is disabled.
+ *
+ * \pre Interrupts are masked.
+ */
+
+void waitForInterrupt();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_WAITFORINTERRUPT_HPP_
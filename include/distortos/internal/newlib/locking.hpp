@@ -12,10 +12,16 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_NEWLIB_LOCKING_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_NEWLIB_LOCKING_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/Mutex.hpp"
 
+#ifndef CONFIG_ARCHITECTURE_POSIX
+
 #include <sys/lock.h>
 
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
+
 #if defined(_RETARGETABLE_LOCKING)
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThreadBase class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -51,26 +51,20 @@ public:
 	/**
 	 * \brief DynamicThreadBase's constructor
 	 *
+	 * If \a parameters select stack pool, then the object must be allocated from this pool - with
+	 * operator new(size_t, StackPool*) - as the rest of its block is used for stack.
+	 *
 	 * \tparam Function is the function that will be executed in separate thread
 	 * \tparam Args are the arguments for \a Function
 	 *
-	 * \param [in] stackSize is the size of stack, bytes
-	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
-	 * thread
-	 * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
-	 * \a canReceiveSignals == true, 0 to disable queuing of signals for this thread
-	 * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
-	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
-	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
-	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
 	 * \param [in] owner is a reference to owner DynamicThread object
 	 * \param [in] function is a function that will be executed in separate thread
 	 * \param [in] args are arguments for \a function
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThreadBase(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, DynamicThread& owner, Function&& function,
+	DynamicThreadBase(const DynamicThreadParameters parameters, DynamicThread& owner, Function&& function,
 			Args&&... args);
 
 #else	// CONFIG_THREAD_DETACH_ENABLE != 1
@@ -95,8 +89,14 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThreadBase(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args);
+	DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
+			const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+			Function&& function, Args&&... args) :
+			DynamicThreadBase{DynamicThreadParameters{stackSize, canReceiveSignals, queuedSignals, signalActions,
+					priority, schedulingPolicy}, std::forward<Function>(function), std::forward<Args>(args)...}
+	{
+
+	}
 
 	/**
 	 * \brief DynamicThreadBase's constructor
@@ -110,13 +110,7 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThreadBase(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
-			DynamicThreadBase{parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
-					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
-					std::forward<Function>(function), std::forward<Args>(args)...}
-	{
-
-	}
+	DynamicThreadBase(const DynamicThreadParameters parameters, Function&& function, Args&&... args);
 
 #endif	// CONFIG_THREAD_DETACH_ENABLE != 1
 
@@ -139,6 +133,26 @@ public:
 
 #endif	// CONFIG_THREAD_DETACH_ENABLE == 1
 
+	/**
+	 * \brief Gets size of block of StackPool required by thread with given size of stack.
+	 *
+	 * If thread detachment is enabled, internal thread object is placed at the beginning of the block and the rest of
+	 * the block is used for stack. Otherwise the whole block is used for stack.
+	 *
+	 * \param [in] stackSize is the size of stack, bytes
+	 *
+	 * \return size of block of StackPool required by thread with \a stackSize, bytes
+	 */
+
+	constexpr static size_t getStackPoolBlockSize(const size_t stackSize)
+	{
+#if CONFIG_THREAD_DETACH_ENABLE == 1
+		return getPooledObjectSize() + adjustStackSize(stackSize) + stackGuardSize;
+#else	// CONFIG_THREAD_DETACH_ENABLE != 1
+		return adjustStackSize(stackSize) + stackGuardSize;
+#endif	// CONFIG_THREAD_DETACH_ENABLE != 1
+	}
+
 	/**
 	 * \brief Starts the thread.
 	 *
@@ -153,6 +167,45 @@ public:
 		return ThreadCommon::startInternal();
 	}
 
+#if CONFIG_THREAD_DETACH_ENABLE == 1
+
+	/**
+	 * \brief Allocation function for DynamicThreadBase objects
+	 *
+	 * The object is allocated from a free block of \a stackPool or - if \a stackPool is nullptr - from the heap. In
+	 * both cases the object is preceded by StackPool::BlockHeader, so that operator delete(void*) can return it to the
+	 * right place.
+	 *
+	 * \param [in] size is the size of allocated object, bytes
+	 * \param [in] stackPool is a pointer to StackPool object from which the object will be allocated, nullptr to
+	 * allocate it from the heap
+	 *
+	 * \return pointer to allocated storage, nullptr if \a stackPool has no free blocks or if the allocation from the
+	 * heap failed
+	 */
+
+	static void* operator new(size_t size, StackPool* stackPool) noexcept;
+
+	/**
+	 * \brief Deallocation function for DynamicThreadBase objects
+	 *
+	 * \param [in] storage is a pointer to storage allocated with operator new(size_t, StackPool*), which is returned to
+	 * its StackPool or to the heap
+	 */
+
+	static void operator delete(void* storage);
+
+	/**
+	 * \brief Deallocation function for DynamicThreadBase objects, used when constructor exits with an exception
+	 *
+	 * \param [in] storage is a pointer to storage allocated with operator new(size_t, StackPool*), which is returned to
+	 * its StackPool or to the heap
+	 */
+
+	static void operator delete(void* storage, StackPool*);
+
+#endif	// CONFIG_THREAD_DETACH_ENABLE == 1
+
 	DynamicThreadBase(const DynamicThreadBase&) = delete;
 	DynamicThreadBase(DynamicThreadBase&&) = default;
 	const DynamicThreadBase& operator=(const DynamicThreadBase&) = delete;
@@ -194,10 +247,40 @@ protected:
 
 private:
 
+	/**
+	 * \brief Adjusts size of stack to alignment requirements.
+	 *
+	 * Architecture-specific overhead is added to function argument.
+	 *
+	 * \param [in] stackSize is the size of stack, bytes
+	 *
+	 * \return size of stack adjusted to alignment requirements, bytes
+	 */
+
+	constexpr static size_t adjustStackSize(const size_t stackSize)
+	{
+		return (stackSize + CONFIG_ARCHITECTURE_STACK_OVERHEAD + CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) /
+				CONFIG_ARCHITECTURE_STACK_ALIGNMENT * CONFIG_ARCHITECTURE_STACK_ALIGNMENT;
+	}
+
+#if CONFIG_THREAD_DETACH_ENABLE == 1
+
+	/**
+	 * \return size of internal thread object placed in block of StackPool, multiple of alignment of dynamically
+	 * allocated memory, bytes
+	 */
+
+	constexpr static size_t getPooledObjectSize()
+	{
+		return (sizeof(DynamicThreadBase) + alignof(max_align_t) - 1) / alignof(max_align_t) * alignof(max_align_t);
+	}
+
+#endif	// CONFIG_THREAD_DETACH_ENABLE == 1
+
 	/**
 	 * \brief Helper function to make stack with size adjusted to alignment requirements
 	 *
-	 * Size of "stack guard" is added to function argument.
+	 * Size of "stack guard" and architecture-specific overhead are added to function argument.
 	 *
 	 * \param [in] stackSize is the size of stack, bytes
 	 *
@@ -209,12 +292,46 @@ private:
 		static_assert(alignof(max_align_t) >= CONFIG_ARCHITECTURE_STACK_ALIGNMENT,
 				"Alignment of dynamically allocated memory is too low!");
 
-		const auto adjustedStackSize = (stackSize + CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) /
-				CONFIG_ARCHITECTURE_STACK_ALIGNMENT * CONFIG_ARCHITECTURE_STACK_ALIGNMENT;
+		const auto adjustedStackSize = adjustStackSize(stackSize);
 		return {{new uint8_t[adjustedStackSize + stackGuardSize], storageDeleter<uint8_t>},
 				adjustedStackSize + stackGuardSize};
 	}
 
+#if CONFIG_THREAD_DETACH_ENABLE == 1
+
+	/**
+	 * \brief Helper function to make stack for thread with given parameters
+	 *
+	 * If \a parameters select stack pool, then the stack is placed in the block of the pool right after the internal
+	 * thread object, otherwise the stack is allocated from the heap.
+	 *
+	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+	 * \param [in] object is a pointer to internal thread object, which - if \a parameters select stack pool - was
+	 * allocated from this pool
+	 *
+	 * \return Stack object for thread with \a parameters, with no storage if blocks of stack pool are too small
+	 */
+
+	static Stack makeStack(const DynamicThreadParameters& parameters, void* object);
+
+#else	// CONFIG_THREAD_DETACH_ENABLE != 1
+
+	/**
+	 * \brief Helper function to make stack for thread with given parameters
+	 *
+	 * If \a parameters select stack pool, then the stack is allocated from this pool, otherwise it is allocated from
+	 * the heap.
+	 *
+	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+	 *
+	 * \return Stack object for thread with \a parameters, with no storage if stack pool has no free blocks or its
+	 * blocks are too small
+	 */
+
+	static Stack makeStack(const DynamicThreadParameters& parameters);
+
+#endif	// CONFIG_THREAD_DETACH_ENABLE != 1
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 	/// internal DynamicSignalsReceiver object
@@ -236,13 +353,12 @@ private:
 #if CONFIG_SIGNALS_ENABLE == 1 && CONFIG_THREAD_DETACH_ENABLE == 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
-		DynamicThread& owner, Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr,
-						canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
-				dynamicSignalsReceiver_{canReceiveSignals == true ? queuedSignals : 0,
-						canReceiveSignals == true ? signalActions : 0},
+DynamicThreadBase::DynamicThreadBase(const DynamicThreadParameters parameters, DynamicThread& owner,
+		Function&& function, Args&&... args) :
+				ThreadCommon{makeStack(parameters, this), parameters.priority, parameters.schedulingPolicy, nullptr,
+						parameters.canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
+				dynamicSignalsReceiver_{parameters.canReceiveSignals == true ? parameters.queuedSignals : 0,
+						parameters.canReceiveSignals == true ? parameters.signalActions : 0},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)},
 				owner_{&owner}
 {
@@ -252,13 +368,11 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canRecei
 #elif CONFIG_SIGNALS_ENABLE == 1 && CONFIG_THREAD_DETACH_ENABLE != 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
-		Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr,
-						canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
-				dynamicSignalsReceiver_{canReceiveSignals == true ? queuedSignals : 0,
-						canReceiveSignals == true ? signalActions : 0},
+DynamicThreadBase::DynamicThreadBase(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
+				ThreadCommon{makeStack(parameters), parameters.priority, parameters.schedulingPolicy, nullptr,
+						parameters.canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
+				dynamicSignalsReceiver_{parameters.canReceiveSignals == true ? parameters.queuedSignals : 0,
+						parameters.canReceiveSignals == true ? parameters.signalActions : 0},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
 {
 
@@ -267,9 +381,10 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canRecei
 #elif CONFIG_SIGNALS_ENABLE != 1 && CONFIG_THREAD_DETACH_ENABLE == 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, bool, size_t, size_t, const uint8_t priority,
-		const SchedulingPolicy schedulingPolicy, DynamicThread& owner, Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr, nullptr},
+DynamicThreadBase::DynamicThreadBase(const DynamicThreadParameters parameters, DynamicThread& owner,
+		Function&& function, Args&&... args) :
+				ThreadCommon{makeStack(parameters, this), parameters.priority, parameters.schedulingPolicy, nullptr,
+						nullptr},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)},
 				owner_{&owner}
 {
@@ -279,9 +394,9 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, bool, size_t, size_
 #else	// CONFIG_SIGNALS_ENABLE != 1 && CONFIG_THREAD_DETACH_ENABLE != 1
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, bool, size_t, size_t, const uint8_t priority,
-		const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args) :
-				ThreadCommon{makeStack(stackSize), priority, schedulingPolicy, nullptr, nullptr},
+DynamicThreadBase::DynamicThreadBase(const DynamicThreadParameters parameters, Function&& function, Args&&... args) :
+				ThreadCommon{makeStack(parameters), parameters.priority, parameters.schedulingPolicy, nullptr,
+						nullptr},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
 {
 
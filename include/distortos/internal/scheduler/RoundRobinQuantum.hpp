@@ -67,6 +67,22 @@ public:
 			--quantum_;
 	}
 
+	/**
+	 * \brief Decrements round-robin's quantum by given duration.
+	 *
+	 * This function should be called after tick interrupts were suppressed (tickless idle mode) for the currently running
+	 * thread. Underflow of quantum after this decrement is not possible.
+	 *
+	 * \note this function must be called with enabled interrupt masking
+	 *
+	 * \param [in] duration is the duration by which the quantum will be decremented
+	 */
+
+	void decrement(const TickClock::duration duration)
+	{
+		quantum_ = duration >= quantum_ ? Duration{} : quantum_ - std::chrono::duration_cast<Duration>(duration);
+	}
+
 	/**
 	 * \brief Gets current value of round-robin's quantum.
 	 *
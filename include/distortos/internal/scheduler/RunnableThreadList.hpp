@@ -0,0 +1,185 @@
+/**
+ * \file
+ * \brief RunnableThreadList class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief RunnableThreadList class is a container of threads in "runnable" state.
+ *
+ * Threads are kept in an array of ThreadList "buckets", each bucket holding threads with the same range of effective
+ * priorities. Non-empty buckets are marked in a two-level bitmap, so the bucket with the highest priority is found with
+ * two "count leading zeros" operations. When there is one priority per bucket (default configuration), all operations
+ * are done in constant time. With fewer buckets, threads in each bucket are kept sorted, so the cost of insertion is
+ * proportional to the number of runnable threads in given bucket.
+ *
+ * Order of threads with the same effective priority is identical to the one provided by sorted ThreadList - new
+ * threads are placed at the end of the group of threads with equal priority, unless they are explicitly requested to
+ * be placed at the beginning of that group. Threads using SchedulingPolicy::earliestDeadlineFirst are exception to this
+ * rule - they are placed in the group of threads with equal effective priority before all threads using the same
+ * policy with later deadline, so insertion of such threads is always proportional to the number of threads in given
+ * bucket.
+ *
+ * ThreadControlBlock::getList() of each thread on this container points to the bucket in which the thread is placed.
+ */
+
+class RunnableThreadList
+{
+public:
+
+	/// const iterator of elements on the list
+	using const_iterator = ThreadList::const_iterator;
+
+	/// iterator of elements on the list
+	using iterator = ThreadList::iterator;
+
+	/// number of buckets
+	constexpr static size_t bucketCount {CONFIG_SCHEDULER_PRIORITY_BUCKETS};
+
+	static_assert(bucketCount >= 1 && bucketCount <= 256 && (bucketCount & (bucketCount - 1)) == 0,
+			"Number of buckets must be a power of 2 in [1; 256] range!");
+
+	/// number of priorities in each bucket
+	constexpr static size_t prioritiesPerBucket {256 / bucketCount};
+
+	/**
+	 * \brief RunnableThreadList's constructor
+	 */
+
+	constexpr RunnableThreadList() :
+			bitmap_{},
+			summary_{}
+	{
+
+	}
+
+	/**
+	 * \return iterator of first thread with the highest effective priority, iterator to "one past the last" element of
+	 * first bucket if the container is empty
+	 */
+
+	iterator begin()
+	{
+		return summary_ == 0 ? buckets_[0].end() : buckets_[findHighestBucket()].begin();
+	}
+
+	/**
+	 * \return const iterator of first thread with the highest effective priority, const iterator to "one past the last"
+	 * element of first bucket if the container is empty
+	 */
+
+	const_iterator begin() const
+	{
+		return summary_ == 0 ? buckets_[0].end() : buckets_[findHighestBucket()].begin();
+	}
+
+	/**
+	 * \brief Unlinks the thread from the container.
+	 *
+	 * \pre Thread is on this container.
+	 *
+	 * \param [in] position is an iterator of the thread that will be unlinked from the container
+	 */
+
+	void erase(iterator position);
+
+	/**
+	 * \brief Links the thread in the container.
+	 *
+	 * If the thread is currently linked in another list, it is transferred from that list.
+	 *
+	 * \param [in] threadControlBlock is a reference to thread that will be linked in the container
+	 * \param [in] front selects the position in the group of threads with equal effective priority:
+	 * - true - the thread is placed at the beginning of the group,
+	 * - false - the thread is placed at the end of the group;
+	 * ignored for threads using SchedulingPolicy::earliestDeadlineFirst
+	 */
+
+	void insert(ThreadControlBlock& threadControlBlock, bool front = {});
+
+	/**
+	 * \brief Moves the thread to the position that matches its current effective priority.
+	 *
+	 * This function should be called when thread's effective priority changes or when the thread should be moved to
+	 * the end of the group of threads with equal effective priority (round-robin scheduling, yield).
+	 *
+	 * \pre Thread is on this container.
+	 *
+	 * \param [in] position is an iterator of the thread that will be moved
+	 * \param [in] front selects the position in the group of threads with equal effective priority:
+	 * - true - the thread is placed at the beginning of the group,
+	 * - false - the thread is placed at the end of the group;
+	 */
+
+	void reposition(iterator position, bool front = {});
+
+	/**
+	 * \brief Transfers the thread from another list to this container.
+	 *
+	 * The thread is placed at the end of the group of threads with equal effective priority.
+	 *
+	 * \param [in] splicedElement is an iterator of the thread that will be spliced from another list to this container
+	 */
+
+	void splice(const iterator splicedElement)
+	{
+		insert(*splicedElement);
+	}
+
+	RunnableThreadList(const RunnableThreadList&) = delete;
+	RunnableThreadList(RunnableThreadList&&) = delete;
+	const RunnableThreadList& operator=(const RunnableThreadList&) = delete;
+	RunnableThreadList& operator=(RunnableThreadList&&) = delete;
+
+private:
+
+	/// number of elements in bitmap
+	constexpr static size_t bitmapSize {(bucketCount + 31) / 32};
+
+	/**
+	 * \pre Container is not empty.
+	 *
+	 * \return index of non-empty bucket with the highest priority
+	 */
+
+	size_t findHighestBucket() const
+	{
+		const size_t word = 31 - __builtin_clz(summary_);
+		return word * 32 + (31 - __builtin_clz(bitmap_[word]));
+	}
+
+	/// array with buckets, each containing threads with the same range of effective priorities
+	std::array<ThreadList, bucketCount> buckets_;
+
+	/// bitmap with non-empty buckets, bit n of word m is set if bucket with index (m * 32 + n) is not empty
+	std::array<uint32_t, bitmapSize> bitmap_;
+
+	/// summary of bitmap, bit m is set if word m of bitmap is not zero
+	uint32_t summary_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
@@ -13,9 +13,16 @@
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
 #include "distortos/internal/scheduler/ThreadList.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#include <chrono>
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 namespace distortos
 {
 
@@ -36,8 +43,20 @@ public:
 			runnableList_{},
 			suspendedList_{},
 			softwareTimerSupervisor_{},
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+			staleTimeoutList_{},
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
 			contextSwitchCount_{},
 			tickCount_{}
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+			, idleThreadControlBlock_{},
+			cycleCount_{},
+			interruptRunTime_{},
+			cpuLoadWindowCycleCount_{},
+			cpuLoadWindowIdleRunTime_{},
+			cpuLoadWindowEnd_{},
+			cpuLoad_{}
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
 	{
 
 	}
@@ -119,6 +138,37 @@ public:
 
 	uint64_t getContextSwitchCount() const;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return CPU load in last completed window, [0; 10000] range, 10000 - 100 %
+	 */
+
+	uint16_t getCpuLoad() const;
+
+	/**
+	 * \return total run time of idle thread
+	 */
+
+	std::chrono::nanoseconds getIdleTime() const;
+
+	/**
+	 * \return total time spent in tick interrupt handler
+	 */
+
+	std::chrono::nanoseconds getInterruptTime() const;
+
+	/**
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread which will be checked
+	 *
+	 * \return total run time of the thread (including time since last context switch for currently running thread),
+	 * excluding time spent in tick interrupt handler
+	 */
+
+	std::chrono::nanoseconds getRunTime(const ThreadControlBlock& threadControlBlock) const;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return reference to currently active ThreadControlBlock
 	 */
@@ -166,6 +216,20 @@ public:
 
 	int initialize(ThreadControlBlock& mainThreadControlBlock);
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \brief Registers currently running thread as idle thread.
+	 *
+	 * Run time of idle thread is reported as idle time and is used to calculate CPU load.
+	 *
+	 * \warning This function must be called only from idle thread!
+	 */
+
+	void registerIdleThread();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \brief Requests context switch if it is needed.
 	 *
@@ -191,6 +255,36 @@ public:
 
 	int remove();
 
+	/**
+	 * \brief Repositions "runnable" thread after change of its effective priority.
+	 *
+	 * \note This function must be called with masked interrupts.
+	 *
+	 * \param [in] iterator is the iterator to the thread that will be repositioned, the thread must be in "runnable"
+	 * state
+	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
+	 * priority is raised!):
+	 * - true - the thread is moved to the head of the group of threads with the new priority,
+	 * - false - the thread is moved to the tail of the group of threads with the new priority.
+	 */
+
+	void reposition(ThreadList::iterator iterator, bool loweringBefore);
+
+	/**
+	 * \brief Moves blocked thread to another list of blocked threads.
+	 *
+	 * The thread stays blocked - it is only transferred to \a container with new state, as if it was blocked there in
+	 * the first place. Unblock functor of the thread is preserved, timeout of the thread (if any) is cancelled.
+	 *
+	 * \note This function must be called with masked interrupts.
+	 *
+	 * \param [in] container is a reference to destination list of blocked threads
+	 * \param [in] iterator is the iterator to the thread that will be moved, the thread must be blocked
+	 * \param [in] state is the new state of moved thread
+	 */
+
+	void requeue(ThreadList& container, ThreadList::iterator iterator, ThreadState state);
+
 	/**
 	 * \brief Resumes suspended thread.
 	 *
@@ -255,6 +349,42 @@ public:
 
 	bool tickInterruptHandler();
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	/**
+	 * \brief Adds thread to the list of threads with stale timeout timer.
+	 *
+	 * Timeout timer is stale if it is running with time point which differs from the time point of the timeout of the
+	 * thread - this is the case after lazy cancellation of the timeout.
+	 *
+	 * \note this must not be called by user code
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of thread with stale timeout timer
+	 */
+
+	void addStaleTimeout(ThreadControlBlock& threadControlBlock)
+	{
+		staleTimeoutList_.push_back(threadControlBlock);
+	}
+
+	/**
+	 * \brief Executes one iteration of tickless idle mode.
+	 *
+	 * If no context switch is required, synchronizes timeout timers of all threads added with addStaleTimeout() with
+	 * timeouts of these threads (so that expiration of a stale timer does not wake the core up prematurely) and
+	 * calculates the number of ticks to the nearest event known to the scheduler - expiration of software timer or end
+	 * of round-robin quantum of current thread (only if there are other runnable threads with the same priority). If
+	 * this number is greater than 1, periodic tick interrupt is replaced with a one-shot timer and the core waits for
+	 * any interrupt. After wakeup periodic tick interrupt is restored and tick count is advanced by the number of ticks
+	 * which elapsed without tick interrupt.
+	 *
+	 * \warning This function must be called only from idle thread!
+	 */
+
+	void ticklessIdle();
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 	/**
 	 * \brief Unblocks provided thread, transferring it from it's current container to "runnable" container.
 	 *
@@ -274,6 +404,13 @@ public:
 
 private:
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	/// list of threads with stale timeout timer
+	using StaleTimeoutList = estd::IntrusiveList<ThreadListNode, &ThreadListNode::staleTimeoutNode, ThreadControlBlock>;
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 	/**
 	 * \brief Adds new ThreadControlBlock to scheduler.
 	 *
@@ -332,11 +469,23 @@ private:
 
 	void unblockInternal(ThreadList::iterator iterator, UnblockReason unblockReason);
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \brief Adds time elapsed since last call to this function to run time of currently running thread.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 */
+
+	void updateRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/// iterator to the currently active ThreadControlBlock
 	ThreadList::iterator currentThreadControlBlock_;
 
-	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order
-	ThreadList runnableList_;
+	/// container of ThreadControlBlock elements in "runnable" state, ordered by priority in descending order
+	RunnableThreadList runnableList_;
 
 	/// list of ThreadControlBlock elements in "suspended" state, sorted by priority in descending order
 	ThreadList suspendedList_;
@@ -344,11 +493,43 @@ private:
 	/// internal SoftwareTimerSupervisor object
 	SoftwareTimerSupervisor softwareTimerSupervisor_;
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	/// list of threads with stale timeout timer
+	StaleTimeoutList staleTimeoutList_;
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 	/// number of context switches
 	uint64_t contextSwitchCount_;
 
 	/// tick count
 	uint64_t tickCount_;
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/// pointer to ThreadControlBlock of idle thread, nullptr if idle thread was not executed yet
+	const ThreadControlBlock* idleThreadControlBlock_;
+
+	/// value of cycle counter during last update of run time
+	uint64_t cycleCount_;
+
+	/// total time spent in tick interrupt handler, cycles
+	uint64_t interruptRunTime_;
+
+	/// value of cycle counter at the beginning of current CPU load window
+	uint64_t cpuLoadWindowCycleCount_;
+
+	/// run time of idle thread at the beginning of current CPU load window, cycles
+	uint64_t cpuLoadWindowIdleRunTime_;
+
+	/// tick count at which current CPU load window ends
+	uint64_t cpuLoadWindowEnd_;
+
+	/// CPU load in last completed window, [0; 10000] range, 10000 - 100 %
+	uint16_t cpuLoad_;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerSupervisor class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,18 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 #include "distortos/internal/scheduler/SoftwareTimerList.hpp"
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 namespace distortos
 {
 
@@ -30,7 +40,7 @@ public:
 	 */
 
 	constexpr SoftwareTimerSupervisor() :
-			activeList_{}
+			activeTimers_{}
 	{
 
 	}
@@ -43,6 +53,13 @@ public:
 
 	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+	/**
+	 * \return time point of expiration of the earliest active software timer, TickClock::time_point::max() if there are
+	 * no active software timers
+	 */
+
+	TickClock::time_point getNextTimePoint() const;
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
@@ -55,8 +72,17 @@ public:
 
 private:
 
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+	/// wheel of active software timers (waiting for execution)
+	SoftwareTimerWheel activeTimers_;
+
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 	/// list of active software timers (waiting for execution)
-	SoftwareTimerList activeList_;
+	SoftwareTimerList activeTimers_;
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
 };
 
 }	// namespace internal
@@ -0,0 +1,154 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
+
+#include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+class SoftwareTimerControlBlock;
+
+/**
+ * \brief SoftwareTimerWheel class is a hierarchical timing wheel of active software timers (software timer control
+ * blocks).
+ *
+ * The wheel has levelCount levels, each with slotsPerLevel slots. Level n groups timers by bits [5 * n; 5 * n + 4] of
+ * their expiration time point - a timer is placed on the lowest level at which its expiration time point differs from
+ * the current time point of the wheel, so each slot of level 0 holds timers which expire at exactly the same tick, while
+ * each slot of higher levels covers a range of ticks. When the current time point reaches the beginning of such range,
+ * all timers from the slot are "cascaded" to lower levels. Timers which expire after the range covered by the wheel are
+ * kept on additional "overflow" list, which is cascaded when the whole wheel wraps around. Non-empty slots of each level
+ * are tracked with a bitmap, so the wheel skips over empty slots and levels in constant time, which also makes it
+ * suitable for tickless idle mode. Additionally the tick of the next slot that must be processed is cached, so ticks at
+ * which nothing happens are handled with a single comparison.
+ *
+ * Timers are linked in the wheel with the same node as the one used by SoftwareTimerList, so any timer can be removed
+ * from the wheel in constant time just by unlinking this node. Timers with equal expiration time points are executed
+ * in the order in which they were started.
+ */
+
+class SoftwareTimerWheel
+{
+public:
+
+	/**
+	 * \brief SoftwareTimerWheel's constructor
+	 */
+
+	constexpr SoftwareTimerWheel() :
+			bitmaps_{},
+			expiredList_{},
+			overflowList_{},
+			nextTick_{UINT64_MAX},
+			tick_{}
+	{
+
+	}
+
+	/**
+	 * \return time point of expiration of the earliest software timer in the wheel, TickClock::time_point::max() if the
+	 * wheel is empty
+	 */
+
+	TickClock::time_point getNextTimePoint() const;
+
+	/**
+	 * \brief Links the software timer in the wheel.
+	 *
+	 * Software timers with expiration time point which is not later than the current time point of the wheel will be
+	 * returned by next call to pop().
+	 *
+	 * \param [in] softwareTimerControlBlock is a reference to software timer that will be linked in the wheel
+	 */
+
+	void insert(SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+	/**
+	 * \brief Advances the wheel to given time point and unlinks one expired software timer.
+	 *
+	 * \param [in] timePoint is the current time point, must not be earlier than the one used in previous call
+	 *
+	 * \return pointer to unlinked software timer with expiration time point not later than \a timePoint, nullptr if
+	 * there are no such timers
+	 */
+
+	SoftwareTimerControlBlock* pop(TickClock::time_point timePoint);
+
+	SoftwareTimerWheel(const SoftwareTimerWheel&) = delete;
+	SoftwareTimerWheel(SoftwareTimerWheel&&) = delete;
+	const SoftwareTimerWheel& operator=(const SoftwareTimerWheel&) = delete;
+	SoftwareTimerWheel& operator=(SoftwareTimerWheel&&) = delete;
+
+private:
+
+	/// unsorted intrusive list of software timers (software timer control blocks)
+	using List = estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
+
+	/// number of bits of time point used to select the slot in each level
+	constexpr static size_t bitsPerLevel {5};
+
+	/// number of slots in each level
+	constexpr static size_t slotsPerLevel {1 << bitsPerLevel};
+
+	/// number of levels
+	constexpr static size_t levelCount {4};
+
+	/**
+	 * \brief Finds the slot with software timers that expire first.
+	 *
+	 * \param [out] level is the level of found slot, levelCount if found "slot" is the overflow list
+	 *
+	 * \return index of found slot in \a level, slotsPerLevel if the wheel is empty
+	 */
+
+	size_t findNextSlot(size_t& level) const;
+
+	/**
+	 * \param [in] level is the level of slot, levelCount for overflow list
+	 * \param [in] slot is the index of slot in \a level
+	 *
+	 * \return earliest time point covered by the slot
+	 */
+
+	uint64_t getSlotTick(size_t level, size_t slot) const;
+
+	/// array with slots of all levels
+	std::array<std::array<List, slotsPerLevel>, levelCount> slots_;
+
+	/// array with bitmaps of slots, bit n of element m is set if slot n of level m may be not empty
+	std::array<uint32_t, levelCount> bitmaps_;
+
+	/// list of software timers that already expired
+	List expiredList_;
+
+	/// list of software timers that expire after the range covered by the wheel
+	List overflowList_;
+
+	/// lower bound of the earliest tick at which any slot of the wheel (or overflow list) must be processed
+	uint64_t nextTick_;
+
+	/// current time point of the wheel, ticks
+	uint64_t tick_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERWHEEL_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief Stack class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -127,6 +127,19 @@ public:
 
 	int initialize(RunnableThread& runnableThread);
 
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+	/**
+	 * \brief Enables hardware protection of "stack guard".
+	 *
+	 * The highest aligned part of "stack guard" which has the size required for hardware protection is protected.
+	 * Protection of "stack guard" of the stack passed to previous call of this function is disabled.
+	 */
+
+	void protectStackGuard() const;
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
 	/**
 	 * \brief Sets value of stack pointer.
 	 *
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadCommon class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -75,6 +75,12 @@ public:
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+	/**
+	 * \return number of deadline misses of thread
+	 */
+
+	uint32_t getDeadlineMissCount() const override;
+
 	/**
 	 * \return effective priority of thread
 	 */
@@ -112,6 +118,16 @@ public:
 
 	uint8_t getPriority() const override;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return total run time of thread, excluding time spent in tick interrupt handler
+	 */
+
+	std::chrono::nanoseconds getRunTime() const override;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
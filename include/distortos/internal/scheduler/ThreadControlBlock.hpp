@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -20,12 +20,14 @@
 #include "distortos/internal/synchronization/MutexList.hpp"
 
 #include "distortos/SchedulingPolicy.hpp"
+#include "distortos/SoftwareTimerCommon.hpp"
 #include "distortos/ThreadState.hpp"
 
 namespace distortos
 {
 
 class SignalsReceiver;
+class ThreadGroup;
 
 namespace internal
 {
@@ -76,6 +78,23 @@ public:
 
 	int addHook();
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \brief Adds time to run time of the thread.
+	 *
+	 * \attention This function should be called only by Scheduler.
+	 *
+	 * \param [in] cycles is the number of cycles of architecture::getCycleCount() that will be added
+	 */
+
+	void addRunTime(const uint64_t cycles)
+	{
+		runTime_ += cycles;
+	}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \brief Block hook function of thread
 	 *
@@ -91,6 +110,38 @@ public:
 		unblockFunctor_ = unblockFunctor;
 	}
 
+	/**
+	 * \brief Cancels timeout of the thread.
+	 *
+	 * Cancellation is lazy - internal software timer is left running, it will be ignored or restarted when it expires.
+	 * This way the common case of a timed wait which ends before the timeout costs almost nothing. With tickless idle
+	 * mode enabled, the thread with timer left running is added to scheduler's list of threads with stale timeout
+	 * timer, so that the timer is synchronized with the timeout before the core enters tickless idle mode.
+	 *
+	 * \attention This function should be called only by Scheduler::blockUntil() and Scheduler::requeue() with
+	 * interrupts masked.
+	 */
+
+	void cancelTimeout();
+
+	/**
+	 * \return absolute deadline of current job of the thread, TickClock::time_point::max() if not set
+	 */
+
+	TickClock::time_point getDeadline() const
+	{
+		return deadline_;
+	}
+
+	/**
+	 * \return number of deadline misses of the thread
+	 */
+
+	uint32_t getDeadlineMissCount() const
+	{
+		return deadlineMissCount_;
+	}
+
 	/**
 	 * \return pointer to list that has this object
 	 */
@@ -127,6 +178,20 @@ public:
 		return roundRobinQuantum_;
 	}
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/**
+	 * \return run time of the thread accumulated until last context switch or tick interrupt, cycles of
+	 * architecture::getCycleCount()
+	 */
+
+	uint64_t getRunTime() const
+	{
+		return runTime_;
+	}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -186,6 +251,15 @@ public:
 		return state_;
 	}
 
+	/**
+	 * \return pointer to ThreadGroupControlBlock with which this object is associated
+	 */
+
+	ThreadGroupControlBlock* getThreadGroupControlBlock() const
+	{
+		return threadGroupControlBlock_;
+	}
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -197,6 +271,35 @@ public:
 		list_ = list;
 	}
 
+	/**
+	 * \brief Sets absolute deadline of thread's next job.
+	 *
+	 * If previous deadline was set and it already passed, deadline miss is counted - previous job is considered to be
+	 * finished when its deadline is replaced. If the thread uses SchedulingPolicy::earliestDeadlineFirst, its position
+	 * among threads with equal priority is updated.
+	 *
+	 * \param [in] deadline is the new absolute deadline, TickClock::time_point::max() to clear the deadline
+	 */
+
+	void setDeadline(TickClock::time_point deadline);
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/**
+	 * \brief Demotes thread to priority 0 or restores its normal priority.
+	 *
+	 * If the effective priority really changes, the position in the thread list is adjusted and context switch may be
+	 * requested.
+	 *
+	 * \note this should only be called by ThreadGroupControlBlock when budget of the group is exhausted or replenished
+	 *
+	 * \param [in] demoted selects whether the thread will be demoted (true) or restored (false)
+	 */
+
+	void setDemoted(bool demoted);
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 	/**
 	 * \brief Changes priority of thread.
 	 *
@@ -215,13 +318,18 @@ public:
 	 * protocol) that blocks this thread
 	 */
 
-	void setPriorityInheritanceMutexControlBlock(const MutexControlBlock* const priorityInheritanceMutexControlBlock)
+	void setPriorityInheritanceMutexControlBlock(MutexControlBlock* const priorityInheritanceMutexControlBlock)
 	{
 		priorityInheritanceMutexControlBlock_ = priorityInheritanceMutexControlBlock;
 	}
 
 	/**
-	 * param [in] schedulingPolicy is the new scheduling policy of the thread
+	 * \brief Changes scheduling policy of thread.
+	 *
+	 * If SchedulingPolicy::earliestDeadlineFirst is enabled or disabled, the position in the thread list is adjusted
+	 * and context switch may be requested.
+	 *
+	 * \param [in] schedulingPolicy is the new scheduling policy of the thread
 	 */
 
 	void setSchedulingPolicy(SchedulingPolicy schedulingPolicy);
@@ -235,6 +343,50 @@ public:
 		state_ = state;
 	}
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/**
+	 * \brief Moves the thread to another thread group.
+	 *
+	 * If budget of new thread group is exhausted, the thread is demoted, otherwise its normal priority is restored.
+	 *
+	 * \param [in] threadGroup is a reference to ThreadGroup to which the thread will be moved
+	 */
+
+	void setThreadGroup(ThreadGroup& threadGroup);
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/**
+	 * \brief Starts timeout of the thread.
+	 *
+	 * When the timeout expires and the thread is still blocked, it is unblocked with UnblockReason::timeout. If
+	 * internal software timer was left running by lazily cancelled timeout and it expires no later than \a timePoint,
+	 * it is not restarted now - this is done when it expires.
+	 *
+	 * \attention This function should be called only by Scheduler::blockUntil() with interrupts masked.
+	 *
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 */
+
+	void startTimeout(TickClock::time_point timePoint);
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	/**
+	 * \brief Synchronizes internal software timer with the timeout of the thread.
+	 *
+	 * Internal software timer left running by lazily cancelled timeout is stopped if the timeout is not active or
+	 * restarted with the time point of the timeout otherwise. The thread is removed from scheduler's list of threads
+	 * with stale timeout timer.
+	 *
+	 * \attention This function should be called only by Scheduler::ticklessIdle() with interrupts masked.
+	 */
+
+	void synchronizeTimeout();
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
@@ -245,7 +397,9 @@ public:
 
 	void switchedToHook()
 	{
+#ifndef CONFIG_ARCHITECTURE_POSIX
 		_impure_ptr = &reent_;
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
 	}
 
 	/**
@@ -264,13 +418,13 @@ public:
 	 * \brief Updates boosted priority of the thread.
 	 *
 	 * This function should be called after all operations involving this thread and a mutex with enabled priority
-	 * protocol.
-	 *
-	 * \param [in] boostedPriority is the initial boosted priority, this should be effective priority of the thread that
-	 * is about to be blocked on a mutex owned by this thread, default - 0
+	 * protocol. Boosted priority of the thread is the highest cached boosted priority of the owned mutexes, which is
+	 * available in constant time, as ownedProtocolMutexList_ is sorted by these values. If the effective priority of the
+	 * thread changes and the thread is blocked on a mutex with priorityInheritance protocol, the change is propagated to
+	 * the owner of that mutex, and so on.
 	 */
 
-	void updateBoostedPriority(uint8_t boostedPriority = {});
+	void updateBoostedPriority();
 
 	ThreadControlBlock(const ThreadControlBlock&) = delete;
 	ThreadControlBlock(ThreadControlBlock&&) = default;
@@ -279,6 +433,48 @@ public:
 
 private:
 
+	/// TimeoutTimer class is a software timer which handles timeout of the thread
+	class TimeoutTimer : public SoftwareTimerCommon
+	{
+	public:
+
+		/**
+		 * \brief TimeoutTimer's constructor
+		 *
+		 * \param [in] owner is a reference to ThreadControlBlock object that owns this TimeoutTimer
+		 */
+
+		constexpr explicit TimeoutTimer(ThreadControlBlock& owner) :
+				SoftwareTimerCommon{},
+				owner_{owner}
+		{
+
+		}
+
+	private:
+
+		/**
+		 * \brief "Run" function of software timer
+		 *
+		 * Handles timeout of the thread.
+		 */
+
+		void run() override;
+
+		/// reference to ThreadControlBlock object that owns this TimeoutTimer
+		ThreadControlBlock& owner_;
+	};
+
+	/**
+	 * \brief Handles expiration of internal software timer.
+	 *
+	 * If the timeout was cancelled, nothing is done. If the timeout was started after the timer, the timer is restarted
+	 * with the time point of the timeout. Otherwise the thread is unblocked with UnblockReason::timeout (if it was not
+	 * already unblocked).
+	 */
+
+	void handleTimeout();
+
 	/**
 	 * \brief Repositions the thread on the list it's currently on.
 	 *
@@ -288,19 +484,24 @@ private:
 	 *
 	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
 	 * priority is raised!):
-	 * - true - the thread is moved to the head of the group of threads with the new priority, this is accomplished by
-	 * temporarily boosting effective priority by 1,
+	 * - true - the thread is moved to the head of the group of threads with the new priority, for threads which are not
+	 * "runnable" this is accomplished by temporarily boosting effective priority by 1,
 	 * - false - the thread is moved to the tail of the group of threads with the new priority.
 	 */
 
 	void reposition(bool loweringBefore);
 
-	/// list of mutexes (mutex control blocks) with enabled priority protocol owned by this thread
+	/// list of mutexes (mutex control blocks) with enabled priority protocol owned by this thread, sorted by descending
+	/// boosted priority of mutexes
 	MutexList ownedProtocolMutexList_;
 
+#ifndef CONFIG_ARCHITECTURE_POSIX
+
 	/// newlib's _reent structure with thread-specific data
 	_reent reent_;
 
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
+
 	/// internal stack object
 	Stack stack_;
 
@@ -311,11 +512,33 @@ private:
 	RunnableThread& owner_;
 
 	/// pointer to MutexControlBlock (with priorityInheritance protocol) that blocks this thread
-	const MutexControlBlock* priorityInheritanceMutexControlBlock_;
+	MutexControlBlock* priorityInheritanceMutexControlBlock_;
 
 	/// sequence number, one half of thread identifier
 	uintptr_t sequenceNumber_;
 
+	/// absolute deadline of current job, TickClock::time_point::max() if not set
+	TickClock::time_point deadline_;
+
+	/// number of deadline misses
+	uint32_t deadlineMissCount_;
+
+	/// software timer used to handle timeouts
+	TimeoutTimer timeoutTimer_;
+
+	/// time point with which timeoutTimer_ was started
+	TickClock::time_point timeoutTimerTimePoint_;
+
+	/// time point of current timeout, TickClock::time_point::max() if timeout is not active
+	TickClock::time_point timeoutTimePoint_;
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	/// run time of the thread, cycles of architecture::getCycleCount()
+	uint64_t runTime_;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 #if CONFIG_SIGNALS_ENABLE == 1
 
 	/// pointer to SignalsReceiverControlBlock object for this thread, nullptr if this thread cannot receive signals
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadGroupControlBlock class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,12 @@
 
 #include "distortos/internal/scheduler/ThreadListNode.hpp"
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+#include "distortos/SoftwareTimerCommon.hpp"
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 namespace distortos
 {
 
@@ -22,7 +28,17 @@ namespace internal
 
 class ThreadControlBlock;
 
-/// ThreadGroupControlBlock class is a control block for ThreadGroup
+/**
+ * \brief ThreadGroupControlBlock class is a control block for ThreadGroup
+ *
+ * If support for budgets of thread groups is enabled, the group may optionally limit CPU time used by its threads, in a
+ * way similar to sporadic server. Budget is consumed by system ticks in which any thread of the group was running. When
+ * the group starts consuming its full budget, replenishment is scheduled one period later. If the budget is exhausted
+ * before that moment, all threads of the group are demoted to priority 0 (but they can still be boosted by priority
+ * inheritance or priority protocol of mutexes) until the budget is replenished. Replenishment is done by internal
+ * software timer, so it is executed from system tick interrupt handler - also in tickless idle mode.
+ */
+
 class ThreadGroupControlBlock
 {
 public:
@@ -33,6 +49,13 @@ public:
 
 	constexpr ThreadGroupControlBlock() :
 			threadList_{}
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+			, replenishmentTimer_{*this},
+			budget_{},
+			period_{},
+			remainingBudget_{},
+			exhaustionCount_{}
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
 	{
 
 	}
@@ -40,18 +63,138 @@ public:
 	/**
 	 * \brief Adds new ThreadControlBlock to internal list of this object.
 	 *
+	 * If the thread already belongs to another group, it is moved to this one.
+	 *
 	 * \param [in] threadControlBlock is a reference to added ThreadControlBlock object
 	 */
 
 	void add(ThreadControlBlock& threadControlBlock);
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/**
+	 * \brief Consumes one tick of budget.
+	 *
+	 * \note this should only be called by Scheduler::tickInterruptHandler() for the group of current thread
+	 *
+	 * \param [in] timePoint is the current time point
+	 */
+
+	void consumeBudget(TickClock::time_point timePoint);
+
+	/**
+	 * \return number of times the budget of the group was exhausted
+	 */
+
+	uint32_t getExhaustionCount() const;
+
+	/**
+	 * \return remaining budget of the group, 0 if the budget is disabled
+	 */
+
+	TickClock::duration getRemainingBudget() const;
+
+	/**
+	 * \brief Sets budget and replenishment period of the group.
+	 *
+	 * Remaining budget is set to \a budget and threads of the group which were demoted are restored to their normal
+	 * priority.
+	 *
+	 * \param [in] budget is the number of ticks which may be used by threads of the group in one replenishment period,
+	 * 0 to disable the budget
+	 * \param [in] period is the replenishment period, ignored if \a budget is 0
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - EINVAL - \a budget is negative or \a period is not greater than 0 or \a budget is greater than \a period;
+	 */
+
+	int setBudget(TickClock::duration budget, TickClock::duration period);
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	ThreadGroupControlBlock(const ThreadGroupControlBlock&) = delete;
+	ThreadGroupControlBlock(ThreadGroupControlBlock&&) = delete;
+	const ThreadGroupControlBlock& operator=(const ThreadGroupControlBlock&) = delete;
+	ThreadGroupControlBlock& operator=(ThreadGroupControlBlock&&) = delete;
+
 private:
 
 	/// intrusive list of threads (thread control blocks)
 	using List = estd::IntrusiveList<ThreadListNode, &ThreadListNode::threadGroupNode, ThreadControlBlock>;
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/// ReplenishmentTimer class is a software timer which replenishes budget of the group
+	class ReplenishmentTimer : public SoftwareTimerCommon
+	{
+	public:
+
+		/**
+		 * \brief ReplenishmentTimer's constructor
+		 *
+		 * \param [in] owner is a reference to ThreadGroupControlBlock object that owns this ReplenishmentTimer
+		 */
+
+		constexpr explicit ReplenishmentTimer(ThreadGroupControlBlock& owner) :
+				SoftwareTimerCommon{},
+				owner_{owner}
+		{
+
+		}
+
+	private:
+
+		/**
+		 * \brief "Run" function of software timer
+		 *
+		 * Replenishes budget of the group.
+		 */
+
+		void run() override;
+
+		/// reference to ThreadGroupControlBlock object that owns this ReplenishmentTimer
+		ThreadGroupControlBlock& owner_;
+	};
+
+	/**
+	 * \brief Replenishes budget of the group.
+	 *
+	 * Remaining budget is set to configured budget and threads of the group are restored to their normal priority.
+	 */
+
+	void replenish();
+
+	/**
+	 * \brief Demotes or restores priority of all threads in the group.
+	 *
+	 * \param [in] demoted selects whether the threads will be demoted (true) or restored (false)
+	 */
+
+	void setDemoted(bool demoted);
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 	/// list of threads (thread control blocks) in this group
 	List threadList_;
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/// software timer used to replenish the budget
+	ReplenishmentTimer replenishmentTimer_;
+
+	/// budget of the group in one replenishment period, 0 if the budget is disabled
+	TickClock::duration budget_;
+
+	/// replenishment period
+	TickClock::duration period_;
+
+	/// remaining budget of the group
+	TickClock::duration remainingBudget_;
+
+	/// number of times the budget of the group was exhausted
+	uint32_t exhaustionCount_;
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadListNode class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_THREADLISTNODE_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "estd/IntrusiveList.hpp"
 
 namespace distortos
@@ -40,8 +42,14 @@ public:
 	constexpr explicit ThreadListNode(const uint8_t priority) :
 			threadListNode{},
 			threadGroupNode{},
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+			staleTimeoutNode{},
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
 			priority_{priority},
 			boostedPriority_{}
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+			, demoted_{}
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
 	{
 
 	}
@@ -52,7 +60,11 @@ public:
 
 	uint8_t getEffectivePriority() const
 	{
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+		return std::max(demoted_ == false ? priority_ : uint8_t{}, boostedPriority_);
+#else	// !def CONFIG_THREAD_GROUP_BUDGET_ENABLE
 		return std::max(priority_, boostedPriority_);
+#endif	// !def CONFIG_THREAD_GROUP_BUDGET_ENABLE
 	}
 
 	/**
@@ -70,6 +82,13 @@ public:
 	/// node for intrusive list in thread group
 	estd::IntrusiveListNode threadGroupNode;
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	/// node for intrusive list of threads with stale timeout timer
+	estd::IntrusiveListNode staleTimeoutNode;
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 protected:
 
 	/// thread's priority, 0 - lowest, UINT8_MAX - highest
@@ -77,6 +96,13 @@ protected:
 
 	/// thread's boosted priority, 0 - no boosting
 	uint8_t boostedPriority_;
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	/// true if thread's priority is lowered to 0, because budget of its thread group is exhausted, false otherwise
+	bool demoted_;
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
 };
 
 }	// namespace internal
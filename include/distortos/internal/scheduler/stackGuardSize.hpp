@@ -2,7 +2,7 @@
  * \file
  * \brief stackGuardSize constant
  *
- * \author Copyright (C) 2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2017-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,12 @@
 
 #include "distortos/distortosConfiguration.h"
 
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+#include "distortos/architecture/stackGuardProtectionGranularity.hpp"
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
 #include <cstddef>
 
 namespace distortos
@@ -26,6 +32,33 @@ namespace internal
 constexpr size_t stackGuardSize {(CONFIG_STACK_GUARD_SIZE + CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) /
 		CONFIG_ARCHITECTURE_STACK_ALIGNMENT * CONFIG_ARCHITECTURE_STACK_ALIGNMENT};
 
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+static_assert(2 * architecture::stackGuardProtectionGranularity - CONFIG_ARCHITECTURE_STACK_ALIGNMENT <= stackGuardSize,
+		"Stack guard is too small for hardware protection!");
+
+/**
+ * \brief Calculates size of the part of "stack guard" with hardware protection.
+ *
+ * Protected part must be aligned to its size, so "stack guard" must be large enough to contain such aligned part
+ * regardless of its own alignment - this requires at least `2 * size - CONFIG_ARCHITECTURE_STACK_ALIGNMENT` bytes.
+ *
+ * \param [in] size is the size of protected part which is already known to fit, bytes
+ *
+ * \return size of the largest protected part which fits in "stack guard", bytes
+ */
+
+constexpr size_t getStackGuardProtectionSize(const size_t size = architecture::stackGuardProtectionGranularity)
+{
+	return 2 * (2 * size) - CONFIG_ARCHITECTURE_STACK_ALIGNMENT <= stackGuardSize ?
+			getStackGuardProtectionSize(2 * size) : size;
+}
+
+/// size (and alignment) of the part of "stack guard" with hardware protection, bytes
+constexpr size_t stackGuardProtectionSize {getStackGuardProtectionSize()};
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief traceEvent() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
+
+#include "distortos/trace.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#ifdef CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records event in trace buffer.
+ *
+ * \param [in] type is the type of event
+ * \param [in] object is a pointer to object related to event, nullptr if not used
+ * \param [in] argument is the argument of event, 0 if not used
+ */
+
+void traceEvent(trace::EventType type, const void* object, uint16_t argument = {});
+
+#else	// !def CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records event in trace buffer - empty version used when trace is disabled.
+ */
+
+inline void traceEvent(trace::EventType, const void*, uint16_t = {})
+{
+
+}
+
+#endif	// !def CONFIG_TRACE_ENABLE
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \brief BoundBulkQueueFunctor class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDBULKQUEUEFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDBULKQUEUEFUNCTOR_HPP_
+
+#include "distortos/internal/synchronization/BulkQueueFunctor.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief BoundBulkQueueFunctor is a type-erased BulkQueueFunctor which calls its bound functor to execute actions on
+ * contiguous run of elements in queue's storage
+ *
+ * \tparam F is the type of bound functor, it will be called with <em>void*</em>, <em>size_t</em> and <em>size_t</em>
+ * as arguments
+ */
+
+template<typename F>
+class BoundBulkQueueFunctor : public BulkQueueFunctor
+{
+public:
+
+	/**
+	 * \brief BoundBulkQueueFunctor's constructor
+	 *
+	 * \param [in] boundFunctor is a rvalue reference to bound functor which will be used to move-construct internal
+	 * bound functor
+	 */
+
+	constexpr explicit BoundBulkQueueFunctor(F&& boundFunctor) :
+			boundFunctor_{std::move(boundFunctor)}
+	{
+
+	}
+
+	/**
+	 * \brief Calls the bound functor which will execute some action on contiguous run of elements in queue's storage
+	 * (like copying, swapping, destroying, ...)
+	 *
+	 * \param [in,out] storage is a pointer to storage with/for first element of the run
+	 * \param [in] index is the index of first element of the run in the whole operation
+	 * \param [in] count is the number of elements in the run
+	 */
+
+	void operator()(void* const storage, const size_t index, const size_t count) const override
+	{
+		boundFunctor_(storage, index, count);
+	}
+
+private:
+
+	/// bound functor
+	F boundFunctor_;
+};
+
+/**
+ * \brief Helper factory function to make BoundBulkQueueFunctor object with deduced template arguments
+ *
+ * \tparam F is the type of bound functor, it will be called with <em>void*</em>, <em>size_t</em> and <em>size_t</em>
+ * as arguments
+ *
+ * \param [in] boundFunctor is a rvalue reference to bound functor which will be used to move-construct returned object
+ *
+ * \return BoundBulkQueueFunctor object with deduced template arguments
+ */
+
+template<typename F>
+constexpr BoundBulkQueueFunctor<F> makeBoundBulkQueueFunctor(F&& boundFunctor)
+{
+	return BoundBulkQueueFunctor<F>{std::move(boundFunctor)};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDBULKQUEUEFUNCTOR_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,10 +14,12 @@
 
 #include "distortos/Semaphore.hpp"
 
+#include "distortos/internal/synchronization/BulkQueueFunctor.hpp"
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
 #include <memory>
+#include <utility>
 
 namespace distortos
 {
@@ -50,6 +52,19 @@ public:
 
 	~FifoQueueBase();
 
+	/**
+	 * \brief Commits the slot reserved with reserve(), making the element stored in it available for popping.
+	 *
+	 * If other slots reserved earlier or later are still not committed, the element becomes available when all of them
+	 * are committed, so the order of elements is always preserved.
+	 *
+	 * \return 0 if slot was committed successfully, error code otherwise:
+	 * - EPERM - no slot is reserved;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit();
+
 	/**
 	 * \return size of single queue element, bytes
 	 */
@@ -59,6 +74,41 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \return reference to semaphore guarding access to "pop" functions - its value is equal to the number of available
+	 * elements
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
+	/**
+	 * \return reference to semaphore guarding access to "push" functions - its value is equal to the number of free
+	 * slots
+	 */
+
+	Semaphore& getPushSemaphore()
+	{
+		return pushSemaphore_;
+	}
+
+	/**
+	 * \brief Implementation of peek()
+	 *
+	 * Gets the oldest element for direct access to its storage. Slot of this element is not reused until it is released
+	 * with release().
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] storage is a reference to pointer which will be used to return address of the oldest element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int peek(const SemaphoreFunctor& waitSemaphoreFunctor, const void*& storage);
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -76,6 +126,25 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
 	}
 
+	/**
+	 * \brief Implementation of popMany() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [in] functor is a reference to BulkQueueFunctor which will execute actions related to popping - it will
+	 * get readPosition_ (or beginning of storage after wrap) as argument
+	 * \param [in] count is the max number of elements that will be popped
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of popped elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popMany(const SemaphoreFunctor& waitSemaphoreFunctor, const BulkQueueFunctor& functor,
+			const size_t count)
+	{
+		return popPushMany(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_, count);
+	}
+
 	/**
 	 * \brief Implementation of push() using type-erased functor
 	 *
@@ -93,8 +162,87 @@ public:
 		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
 	}
 
+	/**
+	 * \brief Implementation of pushMany() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] functor is a reference to BulkQueueFunctor which will execute actions related to pushing - it will
+	 * get writePosition_ (or beginning of storage after wrap) as argument
+	 * \param [in] count is the max number of elements that will be pushed
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of pushed elements; error codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> pushMany(const SemaphoreFunctor& waitSemaphoreFunctor, const BulkQueueFunctor& functor,
+			const size_t count)
+	{
+		return popPushMany(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_, count);
+	}
+
+	/**
+	 * \brief Releases the slot of element obtained with peek(), making it available for pushing.
+	 *
+	 * If other slots peeked earlier or later are still not released, the slot becomes available when all of them are
+	 * released, so slots are always reused in order.
+	 *
+	 * \return 0 if slot was released successfully, error code otherwise:
+	 * - EPERM - no slot is peeked;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release();
+
+	/**
+	 * \brief Implementation of reserve()
+	 *
+	 * Reserves free slot for direct access to its storage. Element stored in this slot is not available for popping
+	 * until the slot is committed with commit().
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int reserve(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage);
+
 private:
 
+	/**
+	 * \brief Implementation of peek() and reserve()
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for peek(), \a
+	 * pushSemaphore_ for reserve()
+	 * \param [in] position is a reference to appropriate pointer to storage, \a readPosition_ for peek(),
+	 * \a writePosition_ for reserve()
+	 * \param [in] pendingSlots is a reference to appropriate counter of pending slots, \a peekedSlots_ for peek(),
+	 * \a reservedSlots_ for reserve()
+	 * \param [out] storage is a reference to pointer which will be used to return address of claimed slot
+	 *
+	 * \return 0 if slot was claimed successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int claim(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore, void*& position,
+			size_t& pendingSlots, void*& storage);
+
+	/**
+	 * \brief Implementation of commit() and release()
+	 *
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted, \a popSemaphore_ for commit(), \a
+	 * pushSemaphore_ for release()
+	 *
+	 * \return 0 if slot was completed successfully, error code otherwise:
+	 * - EPERM - no slot is pending;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int complete(Semaphore& postSemaphore);
+
 	/**
 	 * \brief Implementation of pop() and push() using type-erased functor
 	 *
@@ -116,6 +264,50 @@ private:
 	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, Semaphore& waitSemaphore,
 			Semaphore& postSemaphore, void*& storage);
 
+	/**
+	 * \brief Publishes slots after pop or push operation.
+	 *
+	 * \a postSemaphore is posted for \a count slots only when no slot on the same side of the queue is pending -
+	 * otherwise posting is deferred until all pending slots are completed.
+	 *
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted, \a popSemaphore_ after push, \a
+	 * pushSemaphore_ after pop
+	 * \param [in] count is the number of published slots
+	 *
+	 * \return 0 if slots were published successfully, error code otherwise:
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int publish(Semaphore& postSemaphore, size_t count);
+
+	/**
+	 * \brief Implementation of popMany() and pushMany() using type-erased functor
+	 *
+	 * \a waitSemaphoreFunctor is executed only for the first element, remaining elements are transferred only if they
+	 * are available immediately. Elements are transferred with at most two calls to \a functor - one for each side of
+	 * the wrap point of storage - and \a postSemaphore is posted for all of them in the same section with masked
+	 * interrupts, so threads waiting for the queue are woken once per operation.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] functor is a reference to BulkQueueFunctor which will execute actions related to popping/pushing -
+	 * it will get \a storage (or beginning of storage after wrap) as argument
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for popMany(),
+	 * \a pushSemaphore_ for pushMany()
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
+	 * for popMany(), \a popSemaphore_ for pushMany()
+	 * \param [in] storage is a reference to appropriate pointer to storage, \a readPosition_ for popMany(),
+	 * \a writePosition_ for pushMany()
+	 * \param [in] count is the max number of elements that will be transferred
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of transferred elements; error
+	 * codes:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	std::pair<int, size_t> popPushMany(const SemaphoreFunctor& waitSemaphoreFunctor, const BulkQueueFunctor& functor,
+			Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage, size_t count);
+
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
 
@@ -136,6 +328,18 @@ private:
 
 	/// size of single queue element, bytes
 	const size_t elementSize_;
+
+	/// number of slots obtained with peek() which were not released yet
+	size_t peekedSlots_;
+
+	/// number of slots freed after \a peekedSlots_ which are not yet available for pushing
+	size_t releasedSlots_;
+
+	/// number of slots obtained with reserve() which were not committed yet
+	size_t reservedSlots_;
+
+	/// number of slots filled after \a reservedSlots_ which are not yet available for popping
+	size_t committedSlots_;
 };
 
 }	// namespace internal
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief MemcpyPopBulkQueueFunctor class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MEMCPYPOPBULKQUEUEFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MEMCPYPOPBULKQUEUEFUNCTOR_HPP_
+
+#include "distortos/internal/synchronization/BulkQueueFunctor.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// MemcpyPopBulkQueueFunctor is a functor used for popping of many elements from the raw queue with memcpy()
+class MemcpyPopBulkQueueFunctor : public BulkQueueFunctor
+{
+public:
+
+	/**
+	 * \brief MemcpyPopBulkQueueFunctor's constructor
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] elementSize is the size of single element, bytes
+	 */
+
+	constexpr MemcpyPopBulkQueueFunctor(void* const buffer, const size_t elementSize) :
+			buffer_{buffer},
+			elementSize_{elementSize}
+	{
+
+	}
+
+	/**
+	 * \brief Copies the elements from raw queue's storage (with memcpy()).
+	 *
+	 * \param [in,out] storage is a pointer to storage with elements
+	 * \param [in] index is the index of first element of the run in the whole operation
+	 * \param [in] count is the number of elements in the run
+	 */
+
+	void operator()(void* storage, size_t index, size_t count) const override;
+
+private:
+
+	/// pointer to buffer for popped elements
+	void* const buffer_;
+
+	/// size of single element, bytes
+	const size_t elementSize_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MEMCPYPOPBULKQUEUEFUNCTOR_HPP_
@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief MemcpyPushBulkQueueFunctor class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MEMCPYPUSHBULKQUEUEFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MEMCPYPUSHBULKQUEUEFUNCTOR_HPP_
+
+#include "distortos/internal/synchronization/BulkQueueFunctor.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// MemcpyPushBulkQueueFunctor is a functor used for pushing of many elements to the raw queue with memcpy()
+class MemcpyPushBulkQueueFunctor : public BulkQueueFunctor
+{
+public:
+
+	/**
+	 * \brief MemcpyPushBulkQueueFunctor's constructor
+	 *
+	 * \param [in] data is a pointer to elements that will be pushed to raw queue
+	 * \param [in] elementSize is the size of single element, bytes
+	 */
+
+	constexpr MemcpyPushBulkQueueFunctor(const void* const data, const size_t elementSize) :
+			data_{data},
+			elementSize_{elementSize}
+	{
+
+	}
+
+	/**
+	 * \brief Copies the elements to raw queue's storage (with memcpy()).
+	 *
+	 * \param [in,out] storage is a pointer to storage for elements
+	 * \param [in] index is the index of first element of the run in the whole operation
+	 * \param [in] count is the number of elements in the run
+	 */
+
+	void operator()(void* storage, size_t index, size_t count) const override;
+
+private:
+
+	/// pointer to elements that will be pushed to raw queue
+	const void* const data_;
+
+	/// size of single element, bytes
+	const size_t elementSize_;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MEMCPYPUSHBULKQUEUEFUNCTOR_HPP_
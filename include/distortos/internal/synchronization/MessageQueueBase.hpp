@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -17,8 +17,11 @@
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 #include "estd/SortedIntrusiveForwardList.hpp"
 
+#include <array>
 #include <memory>
 
 namespace distortos
@@ -35,6 +38,17 @@ public:
 	/// entry in the MessageQueueBase
 	struct Entry
 	{
+		/// state of direct access to storage of the entry
+		enum class Access : uint8_t
+		{
+			/// entry is neither reserved nor peeked
+			none,
+			/// entry was reserved with reserve() and was not committed yet
+			reserved,
+			/// entry was peeked with peek() and was not released yet
+			peeked,
+		};
+
 		/**
 		 * \brief Entry's constructor
 		 *
@@ -45,6 +59,7 @@ public:
 		constexpr Entry(const uint8_t priorityy, void* const storagee) :
 				node{},
 				priority{priorityy},
+				access{Access::none},
 				storage{storagee}
 		{
 
@@ -56,6 +71,9 @@ public:
 		/// priority of the entry
 		uint8_t priority;
 
+		/// state of direct access to storage of the entry
+		Access access;
+
 		/// storage for the entry
 		void* storage;
 	};
@@ -105,11 +123,116 @@ public:
 		}
 	};
 
+	/// type of free entry list
+	using FreeEntryList = estd::IntrusiveForwardList<Entry, &Entry::node>;
+
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BUCKETS_ENABLE
+
+	/**
+	 * \brief EntryList class is a list of available entries, kept in descending order of priority.
+	 *
+	 * Entries with equal priority form a FIFO bucket, which is a consecutive segment of a single intrusive forward
+	 * list. Last entry of each non-empty bucket is tracked in an array indexed with priority and non-empty buckets are
+	 * marked in a two-level bitmap, so new entry is linked either after the last entry of its own bucket or after the
+	 * last entry of the closest bucket with higher priority, which is found with two "count trailing zeros" operations.
+	 * All operations are done in constant time.
+	 *
+	 * Order of entries is identical to the one provided by SortedIntrusiveForwardList with DescendingPriority - new
+	 * entry is placed at the end of the group of entries with equal priority.
+	 */
+
+	class EntryList
+	{
+	public:
+
+		/**
+		 * \brief EntryList's constructor
+		 */
+
+		constexpr EntryList() :
+				list_{},
+				tails_{},
+				bitmap_{},
+				summary_{}
+		{
+
+		}
+
+		/**
+		 * \return true if list is empty, false otherwise
+		 */
+
+		bool empty() const
+		{
+			return list_.empty();
+		}
+
+		/**
+		 * \return reference to oldest entry with highest priority
+		 */
+
+		Entry& front()
+		{
+			return list_.front();
+		}
+
+		/**
+		 * \brief Links the entry in the list, at the end of the group of entries with equal priority.
+		 *
+		 * \param [in] entry is a reference to entry that will be linked in the list
+		 */
+
+		void insert(Entry& entry);
+
+		/**
+		 * \brief Unlinks the oldest entry with highest priority from the list.
+		 *
+		 * \pre List is not empty.
+		 */
+
+		void pop_front();
+
+		EntryList(const EntryList&) = delete;
+		EntryList(EntryList&&) = delete;
+		const EntryList& operator=(const EntryList&) = delete;
+		EntryList& operator=(EntryList&&) = delete;
+
+	private:
+
+		/// number of buckets
+		constexpr static size_t bucketCount {UINT8_MAX + 1};
+
+		/// number of elements in bitmap
+		constexpr static size_t bitmapSize {bucketCount / 32};
+
+		/**
+		 * \param [in] priority is the priority of bucket
+		 *
+		 * \return pointer to last entry of non-empty bucket with the lowest priority that is higher than \a priority,
+		 * nullptr if all buckets with higher priority are empty
+		 */
+
+		Entry* findHigherTail(uint8_t priority) const;
+
+		/// list of available entries
+		estd::IntrusiveForwardList<Entry, &Entry::node> list_;
+
+		/// array with pointers to last entry of each bucket, nullptr for empty buckets
+		std::array<Entry*, bucketCount> tails_;
+
+		/// bitmap with non-empty buckets, bit n of word m is set if bucket with priority (m * 32 + n) is not empty
+		std::array<uint32_t, bitmapSize> bitmap_;
+
+		/// summary of bitmap, bit m is set if word m of bitmap is not zero
+		uint32_t summary_;
+	};
+
+#else	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BUCKETS_ENABLE
+
 	/// type of entry list
 	using EntryList = estd::SortedIntrusiveForwardList<DescendingPriority, Entry, &Entry::node>;
 
-	/// type of free entry list
-	using FreeEntryList = EntryList::UnsortedIntrusiveForwardList;
+#endif	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BUCKETS_ENABLE
 
 	/**
 	 * \brief InternalFunctor is a type-erased interface for functors which execute common code of pop() and push()
@@ -144,6 +267,56 @@ public:
 
 	~MessageQueueBase();
 
+	/**
+	 * \brief Commits the slot reserved with reserve(), making the element stored in it available for popping.
+	 *
+	 * \param [in] priority is the priority of element
+	 * \param [in] storage is a pointer to reserved slot
+	 *
+	 * \return 0 if slot was committed successfully, error code otherwise:
+	 * - EINVAL - \a storage is not a pointer to slot of this queue;
+	 * - EPERM - slot pointed by \a storage is not reserved;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commit(uint8_t priority, void* storage);
+
+	/**
+	 * \return reference to semaphore guarding access to "pop" functions - its value is equal to the number of available
+	 * elements
+	 */
+
+	Semaphore& getPopSemaphore()
+	{
+		return popSemaphore_;
+	}
+
+	/**
+	 * \return reference to semaphore guarding access to "push" functions - its value is equal to the number of free
+	 * slots
+	 */
+
+	Semaphore& getPushSemaphore()
+	{
+		return pushSemaphore_;
+	}
+
+	/**
+	 * \brief Implementation of peek()
+	 *
+	 * Gets the oldest element with highest priority for direct access to its storage. Slot of this element is not
+	 * reused until it is released with release().
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] priority is a reference to variable that will be used to return priority of element
+	 * \param [out] storage is a reference to pointer which will be used to return address of element
+	 *
+	 * \return 0 if element was peeked successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int peek(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const void*& storage);
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -174,8 +347,46 @@ public:
 
 	int push(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority, const QueueFunctor& functor);
 
+	/**
+	 * \brief Releases the slot of element obtained with peek(), making it available for pushing.
+	 *
+	 * \param [in] storage is a pointer to peeked element
+	 *
+	 * \return 0 if slot was released successfully, error code otherwise:
+	 * - EINVAL - \a storage is not a pointer to slot of this queue;
+	 * - EPERM - slot pointed by \a storage is not peeked;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int release(const void* storage);
+
+	/**
+	 * \brief Implementation of reserve()
+	 *
+	 * Reserves free slot for direct access to its storage. Element stored in this slot is not available for popping
+	 * until the slot is committed with commit().
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [out] storage is a reference to pointer which will be used to return address of reserved slot
+	 *
+	 * \return 0 if slot was reserved successfully, error code otherwise:
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int reserve(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage);
+
 private:
 
+	/**
+	 * \brief Converts pointer to storage of element to entry which owns this storage.
+	 *
+	 * \param [in] storage is a pointer to storage of element
+	 *
+	 * \return pointer to entry which owns \a storage, nullptr if \a storage is not a pointer to slot of this queue
+	 */
+
+	Entry* getEntry(const void* storage) const;
+
 	/**
 	 * \brief Implementation of pop() and push() using type-erased internal functor
 	 *
@@ -212,6 +423,12 @@ private:
 
 	/// list of "free" entries
 	FreeEntryList freeEntryList_;
+
+	/// size of single queue element, bytes
+	const size_t elementSize_;
+
+	/// number of elements in storage
+	const size_t maxElements_;
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class header
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 
 #include "distortos/internal/scheduler/ThreadList.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/internal/synchronization/MutexListNode.hpp"
 
@@ -20,6 +21,7 @@
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
 
+#include <atomic>
 #include <climits>
 
 namespace distortos
@@ -51,10 +53,15 @@ public:
 	 * threads are blocked,
 	 * - priorityProtect - priority ceiling.
 	 *
+	 * The value is cached - for priorityInheritance protocol it is updated by updateBoostedPriority().
+	 *
 	 * \return "boosted priority" of the mutex
 	 */
 
-	uint8_t getBoostedPriority() const;
+	uint8_t getBoostedPriority() const
+	{
+		return boostedPriority_;
+	}
 
 	/**
 	 * \return owner of the mutex, nullptr if mutex is currently unlocked
@@ -62,9 +69,23 @@ public:
 
 	ThreadControlBlock* getOwner() const
 	{
-		return owner_;
+		return reinterpret_cast<ThreadControlBlock*>(ownerWord_.load(std::memory_order_relaxed) & ~contendedFlag);
 	}
 
+	/**
+	 * \brief Updates cached "boosted priority" of the mutex with priorityInheritance protocol.
+	 *
+	 * If the value changes and the mutex is locked, its position in the list of mutexes owned by the owner is adjusted.
+	 * Boosted priority of the owner is not updated - this should be done by the caller if this function returns true.
+	 *
+	 * \param [in] boostedPriority is the initial boosted priority, this should be effective priority of the thread that
+	 * is about to be blocked on this mutex, default - 0
+	 *
+	 * \return true if boosted priority of the owner must be updated, false otherwise
+	 */
+
+	bool updateBoostedPriority(uint8_t boostedPriority = {});
+
 	/// shift of "type" subfield, bits
 	constexpr static uint8_t typeShift {0};
 
@@ -90,15 +111,34 @@ protected:
 	constexpr MutexControlBlock(const Type type, const Protocol protocol, const uint8_t priorityCeiling) :
 			MutexListNode{},
 			blockedList_{},
-			owner_{},
+			ownerWord_{},
 			recursiveLocksCount_{},
 			priorityCeiling_{priorityCeiling},
+			boostedPriority_{protocol == Protocol::priorityProtect ? priorityCeiling : uint8_t{}},
 			typeProtocol_{static_cast<uint8_t>(static_cast<uint8_t>(type) << typeShift |
 					static_cast<uint8_t>(protocol) << protocolShift)}
 	{
 
 	}
 
+	/**
+	 * \brief MutexControlBlock's move constructor
+	 *
+	 * \param [in] other is a rvalue reference to MutexControlBlock used as source of move construction
+	 */
+
+	MutexControlBlock(MutexControlBlock&& other) :
+			MutexListNode{std::move(other)},
+			blockedList_{std::move(other.blockedList_)},
+			ownerWord_{other.ownerWord_.load(std::memory_order_relaxed)},
+			recursiveLocksCount_{other.recursiveLocksCount_},
+			priorityCeiling_{other.priorityCeiling_},
+			boostedPriority_{other.boostedPriority_},
+			typeProtocol_{other.typeProtocol_}
+	{
+
+	}
+
 	/**
 	 * \brief Blocks current thread, transferring it to blockedList_.
 	 *
@@ -127,6 +167,26 @@ protected:
 
 	void doLock();
 
+	/**
+	 * \brief Takes over thread which was blocked on condition variable associated with this mutex ("wait morphing").
+	 *
+	 * If the mutex is unlocked, it is locked on behalf of the thread and the thread is unblocked. If the mutex is
+	 * locked by another thread, the thread is moved to blockedList_, so it will get the lock when the owner unlocks the
+	 * mutex, without waking up only to block again.
+	 *
+	 * Only mutexes with Protocol::none are supported - transferring a thread to a mutex with any other protocol would
+	 * require adjusting priorities of the thread and of the owner.
+	 *
+	 * \attention must be called with interrupts masked
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of the thread which is blocked on condition
+	 * variable
+	 *
+	 * \return true if the thread was taken over, false if it must be unblocked by the caller
+	 */
+
+	bool doTakeOverWaiter(ThreadControlBlock& threadControlBlock);
+
 	/**
 	 * \brief Performs unlocking or transfer of lock from current owner to next thread on the list.
 	 *
@@ -173,18 +233,106 @@ protected:
 		return static_cast<Type>((typeProtocol_ >> typeShift) & ((1 << typeWidth) - 1));
 	}
 
+	/**
+	 * \brief Tries to lock the mutex without masking interrupts.
+	 *
+	 * This is the fast path of locking - it succeeds only if the mutex uses Protocol::none and is currently unlocked.
+	 * The owner word is changed from "unlocked" to \a threadControlBlock with single atomic compare-and-swap (LDREX /
+	 * STREX on ARMv7-M), without touching the scheduler.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of current thread
+	 *
+	 * \return true if the mutex was locked, false if the slow path must be used
+	 */
+
+	bool tryLockFast(ThreadControlBlock& threadControlBlock)
+	{
+#if ATOMIC_POINTER_LOCK_FREE == 2
+
+		if (getProtocol() != Protocol::none)
+			return false;
+
+		uintptr_t expected {};
+		if (ownerWord_.compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(&threadControlBlock),
+				std::memory_order_acquire, std::memory_order_relaxed) == false)
+			return false;
+
+		traceEvent(trace::EventType::mutexLock, this);
+		return true;
+
+#else	// ATOMIC_POINTER_LOCK_FREE != 2
+
+		static_cast<void>(threadControlBlock);	// suppress warning
+		return false;
+
+#endif	// ATOMIC_POINTER_LOCK_FREE != 2
+	}
+
+	/**
+	 * \brief Tries to unlock the mutex without masking interrupts.
+	 *
+	 * This is the fast path of unlocking - it succeeds only if the mutex uses Protocol::none, is locked by
+	 * \a threadControlBlock (not recursively) and no thread has blocked on it. The owner word is changed from
+	 * \a threadControlBlock to "unlocked" with single atomic compare-and-swap (LDREX / STREX on ARMv7-M), without
+	 * touching the scheduler.
+	 *
+	 * \param [in] threadControlBlock is a reference to ThreadControlBlock of current thread
+	 *
+	 * \return true if the mutex was unlocked, false if the slow path must be used
+	 */
+
+	bool tryUnlockFast(ThreadControlBlock& threadControlBlock)
+	{
+#if ATOMIC_POINTER_LOCK_FREE == 2
+
+		if (getProtocol() != Protocol::none || recursiveLocksCount_ != 0)
+			return false;
+
+		auto expected = reinterpret_cast<uintptr_t>(&threadControlBlock);
+		if (ownerWord_.compare_exchange_strong(expected, {}, std::memory_order_release, std::memory_order_relaxed) ==
+				false)
+			return false;
+
+		traceEvent(trace::EventType::mutexUnlock, this);
+		return true;
+
+#else	// ATOMIC_POINTER_LOCK_FREE != 2
+
+		static_cast<void>(threadControlBlock);	// suppress warning
+		return false;
+
+#endif	// ATOMIC_POINTER_LOCK_FREE != 2
+	}
+
 private:
 
 	/**
 	 * \brief Performs any actions required before actually blocking on the mutex.
 	 *
-	 * In case of priorityInheritance protocol, priority of owner thread is boosted and this mutex is set as the
-	 * blocking mutex of the calling thread. In all other cases this function does nothing.
+	 * Sets "contended" flag in the owner word, so the owner will unlock the mutex with the slow path. In case of
+	 * priorityInheritance protocol, priority of owner thread is boosted and this mutex is set as the blocking mutex of
+	 * the calling thread.
 	 *
 	 * \attention must be called in block() and blockUntil() before actually blocking of the calling thread.
 	 */
 
-	void beforeBlock() const;
+	void beforeBlock();
+
+	/**
+	 * \brief Moves the mutex to the position in the list of mutexes owned by the owner that matches its cached boosted
+	 * priority.
+	 *
+	 * Mutexes are sorted by descending boosted priority, so the owner can get the highest one in constant time. Mutex
+	 * which is on the list is moved from its current position, so the cost is the number of positions it moves. Mutex
+	 * which is not on any list is inserted starting from the end of the list, so the cost is the number of owned mutexes
+	 * with equal or lower boosted priority. Mutex without boost is always placed at the end in constant time.
+	 *
+	 * \pre Mutex is either not on any list or it is on the list of its current owner.
+	 *
+	 * \attention mutex must be locked
+	 */
+
+	void repositionInOwnerList();
 
 	/**
 	 * \brief Performs transfer of lock from current owner to next thread on the list.
@@ -202,11 +350,30 @@ private:
 
 	void doUnlock();
 
+	/**
+	 * \brief Sets owner of the mutex.
+	 *
+	 * \attention must be called with interrupts masked
+	 *
+	 * \param [in] owner is a pointer to new owner of the mutex, nullptr to mark the mutex as unlocked
+	 * \param [in] contended selects whether "contended" flag is set in the owner word, which makes tryUnlockFast() fail
+	 */
+
+	void setOwner(const ThreadControlBlock* const owner, const bool contended)
+	{
+		ownerWord_.store(reinterpret_cast<uintptr_t>(owner) | (contended == true ? contendedFlag : 0),
+				std::memory_order_relaxed);
+	}
+
+	/// "contended" flag in the owner word - set when any thread blocks on the mutex
+	constexpr static uintptr_t contendedFlag {1};
+
 	/// ThreadControlBlock objects blocked on mutex
 	ThreadList blockedList_;
 
-	/// owner of the mutex
-	ThreadControlBlock* owner_;
+	/// owner word - pointer to ThreadControlBlock of the owner (0 if mutex is unlocked) combined with contendedFlag;
+	/// modified with atomic compare-and-swap in fast paths, all other modifications are done with interrupts masked
+	std::atomic<uintptr_t> ownerWord_;
 
 	/// number of recursive locks, used when mutex type is recursive
 	RecursiveLocksCount recursiveLocksCount_;
@@ -214,6 +381,9 @@ private:
 	/// priority ceiling of mutex, valid only when protocol_ == Protocol::priorityProtect
 	uint8_t priorityCeiling_;
 
+	/// cached "boosted priority" of the mutex
+	uint8_t boostedPriority_;
+
 	/// type of mutex and its protocol
 	uint8_t typeProtocol_;
 };
@@ -0,0 +1,96 @@
+/**
+ * \file
+ * \brief SemaphoreObserver class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SEMAPHOREOBSERVER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SEMAPHOREOBSERVER_HPP_
+
+#include "estd/IntrusiveList.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief SemaphoreObserver class is an object which can be notified when the value of semaphore is incremented.
+ *
+ * Observer attached to the semaphore is notified - and detached - by the first post() which increments the value of
+ * semaphore, that is the first post() which does not unblock any thread. Notification only means that the semaphore
+ * could be locked at that moment, so the observer must try to lock it with Semaphore::tryWait() and attach itself again
+ * if this fails.
+ *
+ * The same observer can also be attached to EventFlags, in which case it is notified - and detached - by the first
+ * EventFlags::set().
+ */
+
+class SemaphoreObserver
+{
+public:
+
+	/**
+	 * \brief SemaphoreObserver's constructor
+	 */
+
+	constexpr SemaphoreObserver() :
+			node{}
+	{
+
+	}
+
+	/**
+	 * \brief Detaches observer from the semaphore to which it is attached.
+	 *
+	 * \note Interrupts must be masked when this function is called.
+	 */
+
+	void detach()
+	{
+		node.unlink();
+	}
+
+	/**
+	 * \return true if observer is attached to any semaphore, false otherwise
+	 */
+
+	bool isAttached() const
+	{
+		return node.isLinked();
+	}
+
+	/**
+	 * \brief Notifies the observer that the value of semaphore to which it was attached was incremented.
+	 *
+	 * \note This function is called with masked interrupts, possibly from interrupt context.
+	 */
+
+	virtual void notify() = 0;
+
+	/// node for intrusive list of observers attached to the semaphore
+	estd::IntrusiveListNode node;
+
+protected:
+
+	/**
+	 * \brief SemaphoreObserver's destructor
+	 */
+
+	~SemaphoreObserver() = default;
+};
+
+/// intrusive list of observers attached to the semaphore
+using SemaphoreObserverList = estd::IntrusiveList<SemaphoreObserver, &SemaphoreObserver::node>;
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_SEMAPHOREOBSERVER_HPP_
@@ -0,0 +1,145 @@
+/**
+ * \file
+ * \brief poll() header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_POLL_HPP_
+#define INCLUDE_DISTORTOS_POLL_HPP_
+
+#include "distortos/PollEntry.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+namespace distortos
+{
+
+/// PollEntriesRange is an alias for ContiguousRange of PollEntry elements
+using PollEntriesRange = estd::ContiguousRange<PollEntry>;
+
+/// \addtogroup synchronization
+/// \{
+
+/**
+ * \brief Waits until any of objects selected by entries is ready.
+ *
+ * Similar to poll() - http://pubs.opengroup.org/onlinepubs/9699919799/functions/poll.html
+ *
+ * Readiness of all entries is checked in single pass with interrupts masked. If no entry is ready, current thread is
+ * blocked until any of objects becomes ready - it is woken up directly by the object (Semaphore::post(), queue
+ * operations, EventFlags::set() or generation/queuing of signal), there is no periodic polling. When this function
+ * returns successfully, each entry is marked as ready or not ready, which can be checked with PollEntry::isReady().
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] pollEntriesRange is the range of entries with objects that will be waited for, must not be empty
+ *
+ * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a pollEntriesRange is empty or one of EventFlags entries has zero bitmask;
+ * - ENOTSUP - range contains entry with signals and reception of signals is disabled for current thread;
+ */
+
+std::pair<int, size_t> poll(PollEntriesRange pollEntriesRange);
+
+/**
+ * \brief Checks whether any of objects selected by entries is ready, without blocking.
+ *
+ * \param [in] pollEntriesRange is the range of entries with objects that will be checked, must not be empty
+ *
+ * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+ * - EAGAIN - none of objects is ready;
+ * - EINVAL - \a pollEntriesRange is empty or one of EventFlags entries has zero bitmask;
+ * - ENOTSUP - range contains entry with signals and reception of signals is disabled for current thread;
+ */
+
+std::pair<int, size_t> tryPoll(PollEntriesRange pollEntriesRange);
+
+/**
+ * \brief Waits for given duration of time until any of objects selected by entries is ready.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] pollEntriesRange is the range of entries with objects that will be waited for, must not be empty
+ * \param [in] duration is the duration after which the wait will be terminated without success
+ *
+ * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+ * - error codes returned by tryPollUntil();
+ */
+
+std::pair<int, size_t> tryPollFor(PollEntriesRange pollEntriesRange, TickClock::duration duration);
+
+/**
+ * \brief Waits for given duration of time until any of objects selected by entries is ready.
+ *
+ * Template variant of tryPollFor(PollEntriesRange, TickClock::duration).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Rep is type of tick counter
+ * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+ *
+ * \param [in] pollEntriesRange is the range of entries with objects that will be waited for, must not be empty
+ * \param [in] duration is the duration after which the wait will be terminated without success
+ *
+ * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+ * - error codes returned by tryPollUntil();
+ */
+
+template<typename Rep, typename Period>
+std::pair<int, size_t> tryPollFor(const PollEntriesRange pollEntriesRange,
+		const std::chrono::duration<Rep, Period> duration)
+{
+	return tryPollFor(pollEntriesRange, std::chrono::duration_cast<TickClock::duration>(duration));
+}
+
+/**
+ * \brief Waits until given time point until any of objects selected by entries is ready.
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \param [in] pollEntriesRange is the range of entries with objects that will be waited for, must not be empty
+ * \param [in] timePoint is the time point at which the wait will be terminated without success
+ *
+ * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+ * - EINTR - the wait was interrupted by an unmasked, caught signal;
+ * - EINVAL - \a pollEntriesRange is empty or one of EventFlags entries has zero bitmask;
+ * - ENOTSUP - range contains entry with signals and reception of signals is disabled for current thread;
+ * - ETIMEDOUT - none of objects became ready before the specified timeout expired;
+ */
+
+std::pair<int, size_t> tryPollUntil(PollEntriesRange pollEntriesRange, TickClock::time_point timePoint);
+
+/**
+ * \brief Waits until given time point until any of objects selected by entries is ready.
+ *
+ * Template variant of tryPollUntil(PollEntriesRange, TickClock::time_point).
+ *
+ * \warning This function must not be called from interrupt context!
+ *
+ * \tparam Duration is a std::chrono::duration type used to measure duration
+ *
+ * \param [in] pollEntriesRange is the range of entries with objects that will be waited for, must not be empty
+ * \param [in] timePoint is the time point at which the wait will be terminated without success
+ *
+ * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+ * - error codes returned by tryPollUntil();
+ */
+
+template<typename Duration>
+std::pair<int, size_t> tryPollUntil(const PollEntriesRange pollEntriesRange,
+		const std::chrono::time_point<TickClock, Duration> timePoint)
+{
+	return tryPollUntil(pollEntriesRange, std::chrono::time_point_cast<TickClock::duration>(timePoint));
+}
+
+/// \}
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_POLL_HPP_
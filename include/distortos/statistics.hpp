@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,9 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#include <chrono>
 #include <cstdint>
 
 namespace distortos
@@ -29,6 +32,33 @@ namespace statistics
 
 uint64_t getContextSwitchCount();
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/**
+ * \brief Gets CPU load.
+ *
+ * CPU load is calculated from run time of idle thread at the end of each window with length configured with
+ * CONFIG_CPU_LOAD_WINDOW_DURATION.
+ *
+ * \return CPU load in last completed window, [0; 10000] range, 10000 - 100 %
+ */
+
+uint16_t getCpuLoad();
+
+/**
+ * \return total run time of idle thread
+ */
+
+std::chrono::nanoseconds getIdleTime();
+
+/**
+ * \return total time spent in tick interrupt handler
+ */
+
+std::chrono::nanoseconds getInterruptTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 /// \}
 
 }	// namespace statistics
@@ -0,0 +1,189 @@
+/**
+ * \file
+ * \brief trace namespace header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TRACE_HPP_
+#define INCLUDE_DISTORTOS_TRACE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+/**
+ * \brief Scheduler event trace.
+ *
+ * When enabled with CONFIG_TRACE_ENABLE, scheduler events are recorded in a ring buffer with CONFIG_TRACE_BUFFER_SIZE
+ * records. When the buffer is full, oldest records are overwritten.
+ *
+ * Contents of the buffer are obtained with dump(), which produces following binary format (all fields use native
+ * byte order of the target):
+ * - DumpHeader,
+ * - DumpHeader::recordCount Record objects, sorted from the oldest to the newest.
+ *
+ * Such dump may be converted to a timeline (in Chrome's trace event format) with scripts/decodeTrace.py.
+ */
+
+namespace trace
+{
+
+/// \addtogroup trace
+/// \{
+
+/// type of event
+enum class EventType : uint8_t
+{
+	/// context switch, Record::object - thread which is switched to, Record::argument - its effective priority
+	contextSwitch,
+	/// thread was blocked, Record::object - thread, Record::argument - its new ThreadState
+	block,
+	/// thread was unblocked, Record::object - thread, Record::argument - internal::UnblockReason
+	unblock,
+	/// mutex was locked by current thread, Record::object - mutex
+	mutexLock,
+	/// mutex was unlocked by current thread and its ownership was transferred, Record::object - mutex
+	mutexTransfer,
+	/// mutex was unlocked by current thread, Record::object - mutex
+	mutexUnlock,
+	/// element was pushed to queue, Record::object - queue, Record::argument - number of elements in queue
+	queuePush,
+	/// element was popped from queue, Record::object - queue, Record::argument - number of elements in queue
+	queuePop,
+	/// software timer expired, Record::object - software timer
+	softwareTimerExpiry,
+	/// entry to interrupt handler, Record::argument - number of interrupt
+	interruptEnter,
+	/// exit from interrupt handler, Record::argument - number of interrupt
+	interruptExit,
+};
+
+/// single record of trace
+struct Record
+{
+	/// time point of event, cycles of architecture's cycle counter
+	uint64_t timestamp;
+
+	/// lower 32 bits of address of object related to event, 0 if not used
+	uint32_t object;
+
+	/// argument of event, 0 if not used
+	uint16_t argument;
+
+	/// type of event
+	EventType type;
+
+	/// reserved, always 0
+	uint8_t reserved;
+};
+
+static_assert(sizeof(Record) == 16, "Size of trace::Record must be 16 bytes!");
+
+/// header of dump of trace
+struct DumpHeader
+{
+	/// magic value - ASCII "DTRC" in native byte order of the target
+	uint32_t magic;
+
+	/// version of dump format
+	uint16_t version;
+
+	/// size of single Record, bytes
+	uint16_t recordSize;
+
+	/// number of records following the header
+	uint32_t recordCount;
+
+	/// bitfield with flags of dump, see DumpFlags
+	uint32_t flags;
+
+	/// frequency of timestamps, Hz
+	uint64_t frequency;
+
+	/// number of records which were overwritten or did not fit in the dump
+	uint64_t lostRecords;
+};
+
+static_assert(sizeof(DumpHeader) == 32, "Size of trace::DumpHeader must be 32 bytes!");
+
+/// value of DumpHeader::magic
+constexpr uint32_t dumpMagic {0x43525444};
+
+/// value of DumpHeader::version
+constexpr uint16_t dumpVersion {1};
+
+/// flags in DumpHeader::flags
+enum DumpFlags : uint32_t
+{
+	/// support for signals is enabled, so ThreadState and internal::UnblockReason include values related to signals
+	signalsEnabled = 1 << 0,
+};
+
+/// number of interrupt used in records of tick interrupt
+constexpr uint16_t tickInterruptNumber {UINT16_MAX};
+
+#ifdef CONFIG_TRACE_ENABLE
+
+/// maximum size of dump produced by dump(), bytes
+constexpr size_t maxDumpSize {sizeof(DumpHeader) + CONFIG_TRACE_BUFFER_SIZE * sizeof(Record)};
+
+/**
+ * \brief Removes all records from trace buffer.
+ */
+
+void clear();
+
+/**
+ * \brief Dumps contents of trace buffer.
+ *
+ * If the buffer is too small to hold all records, only the newest ones are dumped. Interrupts are masked for the whole
+ * duration of this function.
+ *
+ * \param [out] buffer is a pointer to buffer for dump
+ * \param [in] size is the size of \a buffer, bytes
+ *
+ * \return number of bytes written to \a buffer, 0 if \a size is smaller than sizeof(DumpHeader)
+ */
+
+size_t dump(void* buffer, size_t size);
+
+/**
+ * \brief Records entry to interrupt handler.
+ *
+ * This function may be called by application's interrupt handlers. Entry to tick interrupt handler is recorded
+ * automatically.
+ *
+ * \param [in] number is the number of interrupt
+ */
+
+void interruptEnter(uint16_t number);
+
+/**
+ * \brief Records exit from interrupt handler.
+ *
+ * This function may be called by application's interrupt handlers. Exit from tick interrupt handler is recorded
+ * automatically.
+ *
+ * \param [in] number is the number of interrupt
+ */
+
+void interruptExit(uint16_t number);
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+/// \}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TRACE_HPP_
@@ -14,6 +14,8 @@
 
 #include <array>
 
+#include <cstddef>
+
 namespace estd
 {
 
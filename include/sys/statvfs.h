@@ -15,6 +15,13 @@
 
 #include <sys/types.h>
 
+#ifdef __GLIBC__
+
+/* host's C library provides complete sys/statvfs.h */
+#include_next <sys/statvfs.h>
+
+#else	/* !def __GLIBC__ */
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -93,4 +100,6 @@ struct statvfs
 }	/* extern "C" */
 #endif	/* def __cplusplus */
 
+#endif	/* !def __GLIBC__ */
+
 #endif /* INCLUDE_SYS_STATVFS_H_ */
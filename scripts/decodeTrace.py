@@ -0,0 +1,184 @@
+#!/usr/bin/env python
+
+#
+# file: decodeTrace.py
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+"""Decode binary dump of distortos scheduler event trace into Chrome's trace event format (JSON).
+
+Dump is produced by `distortos::trace::dump()` and consists of a 32-byte header followed by 16-byte records, sorted
+from the oldest to the newest. Byte order of the dump is detected from the magic value in the header. Resulting JSON
+file can be opened in chrome://tracing or https://ui.perfetto.dev.
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+headerFormat = 'IHHIIQQ'
+recordFormat = 'QIHBB'
+
+dumpMagic = 0x43525444
+dumpVersion = 1
+
+signalsEnabledFlag = 1 << 0
+
+tickInterruptNumber = 0xffff
+
+eventTypes = ('contextSwitch', 'block', 'unblock', 'mutexLock', 'mutexTransfer', 'mutexUnlock', 'queuePush', 'queuePop',
+		'softwareTimerExpiry', 'interruptEnter', 'interruptExit')
+
+def getThreadStates(signalsEnabled):
+	"""Return tuple with names of values of `distortos::ThreadState`.
+
+	* `signalsEnabled` selects whether support for signals was enabled in the traced application
+	"""
+	return (('created', 'runnable', 'terminated', 'sleeping', 'blockedOnSemaphore', 'suspended', 'blockedOnMutex',
+			'blockedOnConditionVariable', 'blockedOnEventFlags', 'blockedOnPoll') +
+			(('waitingForSignal', ) if signalsEnabled else ()) + ('detached', ))
+
+def getUnblockReasons(signalsEnabled):
+	"""Return tuple with names of values of `distortos::internal::UnblockReason`.
+
+	* `signalsEnabled` selects whether support for signals was enabled in the traced application
+	"""
+	return ('unblockRequest', 'timeout') + (('signal', ) if signalsEnabled else ())
+
+def getName(names, value):
+	"""Return name of `value` from `names` or the value itself if it is out of range.
+
+	* `names` is a tuple with names of values
+	* `value` is the value which will be converted to name
+	"""
+	return names[value] if value < len(names) else str(value)
+
+def readDump(data):
+	"""Parse dump and return tuple with header (as a dictionary) and list of records (as tuples).
+
+	* `data` are the raw contents of the dump
+	"""
+	for byteOrder in ('<', '>'):
+		if len(data) < struct.calcsize(byteOrder + headerFormat):
+			raise ValueError('dump is too short')
+		fields = struct.unpack_from(byteOrder + headerFormat, data)
+		if fields[0] == dumpMagic:
+			break
+	else:
+		raise ValueError('invalid magic value in header')
+
+	header = dict(zip(('magic', 'version', 'recordSize', 'recordCount', 'flags', 'frequency', 'lostRecords'), fields))
+	if header['version'] != dumpVersion:
+		raise ValueError('unsupported version of dump: {}'.format(header['version']))
+	if header['recordSize'] != struct.calcsize(byteOrder + recordFormat):
+		raise ValueError('unsupported size of record: {}'.format(header['recordSize']))
+
+	offset = struct.calcsize(byteOrder + headerFormat)
+	if len(data) < offset + header['recordCount'] * header['recordSize']:
+		raise ValueError('dump is truncated')
+
+	records = [struct.unpack_from(byteOrder + recordFormat, data, offset + index * header['recordSize'])
+			for index in range(header['recordCount'])]
+	return header, records
+
+def convert(header, records):
+	"""Convert records of trace to a dictionary in Chrome's trace event format and return it.
+
+	Each thread (identified by the address of its control block) gets its own track with slices covering periods in
+	which it was running. Interrupts and expiration of software timers are placed on a separate track. All other events
+	are instant events placed on the track of thread which caused them.
+
+	* `header` is the header of dump
+	* `records` is a list with records of dump
+	"""
+	signalsEnabled = (header['flags'] & signalsEnabledFlag) != 0
+	threadStates = getThreadStates(signalsEnabled)
+	unblockReasons = getUnblockReasons(signalsEnabled)
+	interruptTrack = 0
+
+	events = []
+	threads = set()
+	runningThread = None
+	runningSince = None
+	startTimestamp = records[0][0] if records else 0
+
+	def timestamp(value):
+		return (value - startTimestamp) * 1000000.0 / header['frequency']
+
+	def instant(name, track, ts, arguments):
+		events.append({'name': name, 'ph': 'i', 's': 't', 'pid': 0, 'tid': track, 'ts': ts, 'args': arguments})
+
+	for cycles, objectAddress, argument, eventType, _ in records:
+		ts = timestamp(cycles)
+		name = getName(eventTypes, eventType)
+		objectName = '0x{:08x}'.format(objectAddress)
+		currentTrack = runningThread if runningThread is not None else interruptTrack
+
+		if name == 'contextSwitch':
+			if runningThread is not None:
+				events.append({'name': 'running', 'ph': 'X', 'pid': 0, 'tid': runningThread, 'ts': runningSince,
+						'dur': ts - runningSince})
+			runningThread = objectAddress
+			runningSince = ts
+			threads.add(objectAddress)
+			instant('switched to (priority {})'.format(argument), objectAddress, ts, {'priority': argument})
+		elif name == 'block':
+			threads.add(objectAddress)
+			instant('block: ' + getName(threadStates, argument), objectAddress, ts, {'thread': objectName})
+		elif name == 'unblock':
+			threads.add(objectAddress)
+			instant('unblock: ' + getName(unblockReasons, argument), objectAddress, ts, {'thread': objectName})
+		elif name in ('mutexLock', 'mutexTransfer', 'mutexUnlock'):
+			instant(name, currentTrack, ts, {'mutex': objectName})
+		elif name in ('queuePush', 'queuePop'):
+			instant(name, currentTrack, ts, {'queue': objectName, 'elements': argument})
+		elif name == 'softwareTimerExpiry':
+			instant(name, interruptTrack, ts, {'softwareTimer': objectName})
+		elif name in ('interruptEnter', 'interruptExit'):
+			interruptName = 'tick' if argument == tickInterruptNumber else 'interrupt {}'.format(argument)
+			events.append({'name': interruptName, 'ph': 'B' if name == 'interruptEnter' else 'E', 'pid': 0,
+					'tid': interruptTrack, 'ts': ts})
+		else:
+			instant(name, currentTrack, ts, {'object': objectName, 'argument': argument})
+
+	if runningThread is not None and records:
+		endTimestamp = timestamp(records[-1][0])
+		events.append({'name': 'running', 'ph': 'X', 'pid': 0, 'tid': runningThread, 'ts': runningSince,
+				'dur': endTimestamp - runningSince})
+
+	events.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': interruptTrack,
+			'args': {'name': 'interrupts'}})
+	for thread in sorted(threads):
+		events.append({'name': 'thread_name', 'ph': 'M', 'pid': 0, 'tid': thread,
+				'args': {'name': 'thread 0x{:08x}'.format(thread)}})
+
+	return {'traceEvents': events, 'displayTimeUnit': 'ns', 'otherData': {'frequency': header['frequency'],
+			'lostRecords': header['lostRecords']}}
+
+########################################################################################################################
+# main
+########################################################################################################################
+
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser(description = __doc__.splitlines()[0])
+	parser.add_argument('dumpFile', help = 'input file with binary dump of trace')
+	parser.add_argument('-o','--output', help = 'output JSON file, standard output if not given')
+	arguments = parser.parse_args()
+
+	with open(arguments.dumpFile, 'rb') as dumpFile:
+		header, records = readDump(dumpFile.read())
+
+	if header['lostRecords'] != 0:
+		sys.stderr.write('Warning: {} records were lost\n'.format(header['lostRecords']))
+
+	trace = convert(header, records)
+	if arguments.output:
+		with open(arguments.output, 'w') as outputFile:
+			json.dump(trace, outputFile, indent = 1)
+	else:
+		json.dump(trace, sys.stdout, indent = 1)
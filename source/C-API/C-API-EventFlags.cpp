@@ -0,0 +1,182 @@
+/**
+ * \file
+ * \brief Implementation of C-API for distortos::EventFlags
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/C-API/EventFlags.h"
+
+#include "distortos/fromCApi.hpp"
+#include "distortos/EventFlags.hpp"
+
+#include <cerrno>
+
+#ifndef DISTORTOS_UNIT_TEST
+
+static_assert(sizeof(distortos_EventFlags) == sizeof(distortos::EventFlags),
+		"Size of distortos_EventFlags does not match size of distortos::EventFlags!");
+static_assert(alignof(distortos_EventFlags) == alignof(distortos::EventFlags),
+		"Alignment of distortos_EventFlags does not match alignment of distortos::EventFlags!");
+
+#endif	// !def DISTORTOS_UNIT_TEST
+
+static_assert(distortos_EventFlags_WaitMode_any == static_cast<uint8_t>(distortos::EventFlags::WaitMode::any),
+		"Value of distortos_EventFlags_WaitMode_any does not match value of distortos::EventFlags::WaitMode::any!");
+static_assert(distortos_EventFlags_WaitMode_all == static_cast<uint8_t>(distortos::EventFlags::WaitMode::all),
+		"Value of distortos_EventFlags_WaitMode_all does not match value of distortos::EventFlags::WaitMode::all!");
+static_assert(distortos_EventFlags_WaitMode_anyClear ==
+		static_cast<uint8_t>(distortos::EventFlags::WaitMode::anyClear),
+		"Value of distortos_EventFlags_WaitMode_anyClear does not match value of "
+		"distortos::EventFlags::WaitMode::anyClear!");
+static_assert(distortos_EventFlags_WaitMode_allClear ==
+		static_cast<uint8_t>(distortos::EventFlags::WaitMode::allClear),
+		"Value of distortos_EventFlags_WaitMode_allClear does not match value of "
+		"distortos::EventFlags::WaitMode::allClear!");
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether mode of wait is valid.
+ *
+ * \param [in] waitMode is the mode of wait
+ *
+ * \return true if \a waitMode is valid, false otherwise
+ */
+
+bool isWaitModeValid(const uint8_t waitMode)
+{
+	return waitMode == distortos_EventFlags_WaitMode_any || waitMode == distortos_EventFlags_WaitMode_all ||
+			waitMode == distortos_EventFlags_WaitMode_anyClear || waitMode == distortos_EventFlags_WaitMode_allClear;
+}
+
+/**
+ * \brief Converts result of wait to C-API.
+ *
+ * \param [in] ret is the pair with return code and value of flags
+ * \param [out] value is a pointer to variable into which value of flags will be written, may be nullptr
+ *
+ * \return return code from \a ret
+ */
+
+int returnWaitResult(const std::pair<int, distortos::EventFlags::Value> ret, uint32_t* const value)
+{
+	if (value != nullptr)
+		*value = ret.second;
+	return ret.first;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int distortos_EventFlags_construct_1(distortos_EventFlags* const eventFlags, const uint32_t value)
+{
+	if (eventFlags == nullptr)
+		return EINVAL;
+
+	new (eventFlags) distortos::EventFlags {value};
+	return 0;
+}
+
+int distortos_EventFlags_destruct(distortos_EventFlags* const eventFlags)
+{
+	if (eventFlags == nullptr)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	realEventFlags.~EventFlags();
+	return 0;
+}
+
+int distortos_EventFlags_clear(distortos_EventFlags* const eventFlags, const uint32_t bitmask,
+		uint32_t* const previousValue)
+{
+	if (eventFlags == nullptr)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	const auto realPreviousValue = realEventFlags.clear(bitmask);
+	if (previousValue != nullptr)
+		*previousValue = realPreviousValue;
+	return 0;
+}
+
+int distortos_EventFlags_get(const distortos_EventFlags* const eventFlags, uint32_t* const value)
+{
+	if (eventFlags == nullptr || value == nullptr)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	*value = realEventFlags.get();
+	return 0;
+}
+
+int distortos_EventFlags_set(distortos_EventFlags* const eventFlags, const uint32_t bitmask,
+		uint32_t* const previousValue)
+{
+	if (eventFlags == nullptr)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	const auto realPreviousValue = realEventFlags.set(bitmask);
+	if (previousValue != nullptr)
+		*previousValue = realPreviousValue;
+	return 0;
+}
+
+int distortos_EventFlags_tryWait(distortos_EventFlags* const eventFlags, const uint32_t bitmask,
+		const uint8_t waitMode, uint32_t* const value)
+{
+	if (eventFlags == nullptr || isWaitModeValid(waitMode) == false)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	return returnWaitResult(realEventFlags.tryWait(bitmask, static_cast<distortos::EventFlags::WaitMode>(waitMode)),
+			value);
+}
+
+int distortos_EventFlags_tryWaitFor(distortos_EventFlags* const eventFlags, const int64_t duration,
+		const uint32_t bitmask, const uint8_t waitMode, uint32_t* const value)
+{
+	if (eventFlags == nullptr || isWaitModeValid(waitMode) == false)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	return returnWaitResult(realEventFlags.tryWaitFor(distortos::TickClock::duration{duration}, bitmask,
+			static_cast<distortos::EventFlags::WaitMode>(waitMode)), value);
+}
+
+int distortos_EventFlags_tryWaitUntil(distortos_EventFlags* const eventFlags, const int64_t timePoint,
+		const uint32_t bitmask, const uint8_t waitMode, uint32_t* const value)
+{
+	if (eventFlags == nullptr || isWaitModeValid(waitMode) == false)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	return returnWaitResult(realEventFlags.tryWaitUntil(
+			distortos::TickClock::time_point{distortos::TickClock::duration{timePoint}}, bitmask,
+			static_cast<distortos::EventFlags::WaitMode>(waitMode)), value);
+}
+
+int distortos_EventFlags_wait(distortos_EventFlags* const eventFlags, const uint32_t bitmask, const uint8_t waitMode,
+		uint32_t* const value)
+{
+	if (eventFlags == nullptr || isWaitModeValid(waitMode) == false)
+		return EINVAL;
+
+	auto& realEventFlags = distortos::fromCApi(*eventFlags);
+	return returnWaitResult(realEventFlags.wait(bitmask, static_cast<distortos::EventFlags::WaitMode>(waitMode)),
+			value);
+}
@@ -114,7 +114,7 @@ std::pair<int, size_t> LittlefsFile::read(void* const buffer, const size_t size)
 	if (ret < 0)
 		return {littlefsErrorToErrorCode(ret), {}};
 
-	return {{}, ret};
+	return {{}, static_cast<size_t>(ret)};
 }
 
 int LittlefsFile::rewind()
@@ -174,7 +174,7 @@ std::pair<int, size_t> LittlefsFile::write(const void* const buffer, const size_
 	if (ret < 0)
 		return {littlefsErrorToErrorCode(ret), {}};
 
-	return {{}, ret};
+	return {{}, static_cast<size_t>(ret)};
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -301,7 +301,7 @@ int LittlefsFileSystem::mount(devices::BlockDevice& blockDevice)
 	configuration_.prog_size = programBlockSize_ != 0 ? programBlockSize_ : blockDevice.getProgramBlockSize();
 	configuration_.block_size = eraseBlockSize_ != 0 ? eraseBlockSize_ : blockDevice.getEraseBlockSize();
 	configuration_.block_count = blocksCount_ != 0 ? blocksCount_ : (blockDevice.getSize() / configuration_.block_size);
-	configuration_.lookahead = (std::max(lookahead_, 1u) + 31) / 32 * 32;
+	configuration_.lookahead = (std::max<size_t>(lookahead_, 1) + 31) / 32 * 32;
 
 	{
 		const auto ret = lfs_mount(&fileSystem_, &configuration_);
@@ -331,7 +331,7 @@ std::pair<int, std::unique_ptr<Directory>> LittlefsFileSystem::openDirectory(con
 			return {ret, std::unique_ptr<LittlefsDirectory>{}};
 	}
 
-	return {{}, std::move(directory)};
+	return {0, std::move(directory)};
 }
 
 std::pair<int, std::unique_ptr<File>> LittlefsFileSystem::openFile(const char* const path, const int flags)
@@ -351,7 +351,7 @@ std::pair<int, std::unique_ptr<File>> LittlefsFileSystem::openFile(const char* c
 			return {ret, std::unique_ptr<LittlefsFile>{}};
 	}
 
-	return {{}, std::move(file)};
+	return {0, std::move(file)};
 }
 
 int LittlefsFileSystem::remove(const char* const path)
@@ -424,7 +424,7 @@ int LittlefsFileSystem::format(devices::BlockDevice& blockDevice, const size_t r
 	configuration.prog_size = programBlockSize != 0 ? programBlockSize : blockDevice.getProgramBlockSize();
 	configuration.block_size = eraseBlockSize != 0 ? eraseBlockSize : blockDevice.getEraseBlockSize();
 	configuration.block_count = blocksCount != 0 ? blocksCount : (blockDevice.getSize() / configuration.block_size);
-	configuration.lookahead = (std::max(lookahead, 1u) + 31) / 32 * 32;
+	configuration.lookahead = (std::max<size_t>(lookahead, 1) + 31) / 32 * 32;
 
 	const auto ret = lfs_format(&fileSystem, &configuration);
 	return littlefsErrorToErrorCode(ret);
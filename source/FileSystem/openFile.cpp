@@ -9,16 +9,25 @@
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#ifndef _GNU_SOURCE
 #define _GNU_SOURCE	// for fopencookie()
+#endif	// !def _GNU_SOURCE
 
 #include "distortos/FileSystem/openFile.hpp"
 
 #include "distortos/FileSystem/FileSystem.hpp"
 
 #include "distortos/assert.h"
+#include "distortos/distortosConfiguration.h"
 
 #include <cerrno>
 
+#ifdef CONFIG_ARCHITECTURE_POSIX
+
+#include <fcntl.h>
+
+#else	// !def CONFIG_ARCHITECTURE_POSIX
+
 extern "C"
 {
 
@@ -27,6 +36,8 @@ int __sflags(_reent* reent, const char* mode, int* flags);
 
 }	// extern "C"
 
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
+
 namespace distortos
 {
 
@@ -152,6 +163,50 @@ ssize_t fileWrite(void* const cookie, const char* const buffer, const size_t siz
 	return ret.second;
 }
 
+#ifdef CONFIG_ARCHITECTURE_POSIX
+
+/**
+ * \brief Converts mode string of fopen() to flags of open().
+ *
+ * Replacement for newlib's __sflags(), which is not available in host's C library.
+ *
+ * \param [in] mode is the string with mode of opening
+ *
+ * \return pair with return code (0 on success, error code otherwise) and flags; error codes:
+ * - EINVAL - \a mode is not valid;
+ */
+
+std::pair<int, int> modeToFlags(const char* const mode)
+{
+	int flags;
+	switch (*mode)
+	{
+		case 'r':
+			flags = O_RDONLY;
+			break;
+		case 'w':
+			flags = O_WRONLY | O_CREAT | O_TRUNC;
+			break;
+		case 'a':
+			flags = O_WRONLY | O_CREAT | O_APPEND;
+			break;
+		default:
+			return {EINVAL, {}};
+	}
+
+	for (auto character = mode + 1; *character != '\0'; ++character)
+		if (*character == '+')
+			flags = (flags & ~O_ACCMODE) | O_RDWR;
+		else if (*character == 'x')
+			flags |= O_EXCL;
+		else if (*character != 'b')
+			return {EINVAL, {}};
+
+	return {{}, flags};
+}
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -162,9 +217,20 @@ std::pair<int, FILE*> openFile(FileSystem& fileSystem, const char* const path, c
 {
 	int flags;
 	{
+#ifdef CONFIG_ARCHITECTURE_POSIX
+
+		int ret;
+		std::tie(ret, flags) = modeToFlags(mode);
+		if (ret != 0)
+			return {ret, {}};
+
+#else	// !def CONFIG_ARCHITECTURE_POSIX
+
 		const auto ret = __sflags(_REENT, mode, &flags);
 		if (ret == 0)
 			return {EINVAL, {}};
+
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
 	}
 
 	std::unique_ptr<File> file;
@@ -2,7 +2,7 @@
  * \file
  * \brief SysTick_Handler() for ARMv6-M and ARMv7-M
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/architecture/requestContextSwitch.hpp"
 
@@ -35,6 +36,9 @@
 
 extern "C" void SysTick_Handler()
 {
+	distortos::internal::traceEvent(distortos::trace::EventType::interruptEnter, {},
+			distortos::trace::tickInterruptNumber);
+
 	auto& scheduler = distortos::internal::getScheduler();
 
 #ifdef CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
@@ -48,4 +52,7 @@ extern "C" void SysTick_Handler()
 	const auto contextSwitchRequired = scheduler.tickInterruptHandler();
 	if (contextSwitchRequired == true)
 		distortos::architecture::requestContextSwitch();
+
+	distortos::internal::traceEvent(distortos::trace::EventType::interruptExit, {},
+			distortos::trace::tickInterruptNumber);
 }
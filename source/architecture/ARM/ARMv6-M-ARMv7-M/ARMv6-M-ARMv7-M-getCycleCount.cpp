@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \brief getCycleCount() and getCycleCountFrequency() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/getCycleCountFrequency.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if defined(CONFIG_RUN_TIME_STATISTICS_ENABLE) || defined(CONFIG_TRACE_ENABLE)
+
+#include "distortos/chip/clocks.hpp"
+#include "distortos/chip/CMSIS-proxy.h"
+
+#ifdef DWT
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+
+#else	// !def DWT
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#endif	// !def DWT
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+#ifdef DWT
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// 64-bit extension of DWT's cycle counter
+uint64_t cycleCount;
+
+/// value of DWT's cycle counter read during last call to getCycleCount()
+uint32_t lastCycleCounter;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Low-level initializer of DWT's cycle counter
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void cycleCounterLowLevelInitializer()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+BIND_LOW_LEVEL_INITIALIZER(31, cycleCounterLowLevelInitializer);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t getCycleCount()
+{
+	// 32-bit counter is extended to 64 bits - this function is called at least once per system tick, so the counter
+	// cannot overflow more than once between consecutive calls
+	const uint32_t cycleCounter {DWT->CYCCNT};
+	cycleCount += cycleCounter - lastCycleCounter;
+	lastCycleCounter = cycleCounter;
+	return cycleCount;
+}
+
+uint64_t getCycleCountFrequency()
+{
+	return chip::ahbFrequency;
+}
+
+#else	// !def DWT
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t getCycleCount()
+{
+	// there's no cycle counter in ARMv6-M, so SysTick's counter is combined with tick count - if SysTick has already
+	// reloaded, but its interrupt was not handled yet, the counter must be read again, as the first value may be from
+	// before the reload
+	const uint64_t period {SysTick->LOAD + 1};
+	auto tickCount = internal::getScheduler().getTickCount();
+	auto value = SysTick->VAL;
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+	{
+		value = SysTick->VAL;
+		++tickCount;
+	}
+
+	return tickCount * period + (period - 1 - value);
+}
+
+uint64_t getCycleCountFrequency()
+{
+	return (SysTick->CTRL & SysTick_CTRL_CLKSOURCE_Msk) != 0 ? chip::ahbFrequency : chip::ahbFrequency / 8;
+}
+
+#endif	// !def DWT
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// defined(CONFIG_RUN_TIME_STATISTICS_ENABLE) || defined(CONFIG_TRACE_ENABLE)
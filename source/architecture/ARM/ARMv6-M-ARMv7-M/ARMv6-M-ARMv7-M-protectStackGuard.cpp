@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief protectStackGuard() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/protectStackGuard.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+
+#if !defined(__MPU_PRESENT) || __MPU_PRESENT != 1
+#error "Hardware protection of stack guard requires MPU!"
+#endif	// !defined(__MPU_PRESENT) || __MPU_PRESENT != 1
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of MPU region used for protection of "stack guard"
+uint8_t regionNumber;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Low-level initializer of MPU
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ *
+ * The region with the highest number is reserved for protection of "stack guard", as it has the highest priority in
+ * case of overlap with any other region. Default memory map is enabled as background region for privileged accesses,
+ * so no other regions are required.
+ */
+
+void mpuLowLevelInitializer()
+{
+	regionNumber = ((MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos) - 1;
+
+#ifndef __ARM_ARCH_6M__
+	SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+#endif	// !def __ARM_ARCH_6M__
+	MPU->CTRL = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+	__DSB();
+	__ISB();
+}
+
+BIND_LOW_LEVEL_INITIALIZER(32, mpuLowLevelInitializer);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void protectStackGuard(void* const begin, const size_t size)
+{
+	// region is read-only for all accesses, never executable, normal memory with write-through cache policy; size of
+	// region is encoded as log2(size) - 1
+	MPU->RBAR = reinterpret_cast<uint32_t>(begin) | MPU_RBAR_VALID_Msk | regionNumber;
+	MPU->RASR = MPU_RASR_XN_Msk | 6 << MPU_RASR_AP_Pos | MPU_RASR_C_Msk |
+			(__builtin_ctz(size) - 1) << MPU_RASR_SIZE_Pos | MPU_RASR_ENABLE_Msk;
+	__DSB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
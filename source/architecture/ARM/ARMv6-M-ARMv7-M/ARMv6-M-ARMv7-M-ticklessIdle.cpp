@@ -0,0 +1,171 @@
+/**
+ * \file
+ * \brief startTicklessIdle() and stopTicklessIdle() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/startTicklessIdle.hpp"
+#include "distortos/architecture/stopTicklessIdle.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// minimal number of SysTick's counts which can be reliably programmed in restartSysTick()
+constexpr uint32_t minimalCounts {64};
+
+/// number of ticks requested in last call to startTicklessIdle(), 0 if tickless idle mode was not started
+uint64_t requestedTicks;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return period of tick, SysTick's counts
+ */
+
+uint32_t getPeriod()
+{
+	// SysTick->LOAD holds the period of tick at all times except a short moment inside restartSysTick()
+	return SysTick->LOAD + 1;
+}
+
+/**
+ * \brief Tests whether tick interrupt is pending.
+ *
+ * \return true if tick interrupt is pending, false otherwise
+ */
+
+bool isTickPending()
+{
+	return (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0;
+}
+
+/**
+ * \brief Restarts stopped SysTick, so that it generates tick interrupt after given number of counts.
+ *
+ * After this tick interrupt SysTick is reloaded with the period of tick, so periodic mode is resumed automatically. If
+ * \a counts is too small to be programmed reliably, tick interrupt is set pending immediately instead and the next one
+ * is generated after full period.
+ *
+ * \pre SysTick is stopped.
+ * \pre \a counts is not greater than SysTick_LOAD_RELOAD_Msk + 1.
+ *
+ * \param [in] counts is the number of SysTick's counts after which tick interrupt will be generated
+ * \param [in] period is the period of tick, SysTick's counts
+ */
+
+void restartSysTick(uint32_t counts, const uint32_t period)
+{
+	if (counts < minimalCounts)
+	{
+		SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+		counts = period;
+	}
+
+	SysTick->LOAD = counts - 1;
+	SysTick->VAL = 0;
+	SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+	// counter is reloaded with the first clock of SysTick - period may be restored only after that, it will be used
+	// when the counter reaches zero
+	while (SysTick->VAL == 0);
+
+	SysTick->LOAD = period - 1;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void startTicklessIdle(const uint64_t ticks)
+{
+	requestedTicks = {};
+
+	// tick which was generated before the call to this function will be handled in periodic mode
+	if (isTickPending() == true)
+		return;
+
+	const auto period = getPeriod();
+	const uint64_t maxTicks {(SysTick_LOAD_RELOAD_Msk + 1) / period};
+	if (maxTicks < 2)
+		return;
+
+	// counter is stopped while it is reprogrammed, so a few of its counts are lost on each entry to (and exit from)
+	// tickless idle mode - tick clock lags behind real time by this amount
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+	const uint32_t value {SysTick->VAL};
+
+	// tick interrupt was generated while the counter was being stopped or it is about to be generated - it will be
+	// handled in periodic mode
+	if (isTickPending() == true || value < minimalCounts)
+	{
+		restartSysTick(value, period);
+		return;
+	}
+
+	// value of the counter is the number of counts left to next periodic tick, so extending it keeps the phase of ticks
+	// unchanged
+	requestedTicks = std::min(ticks, maxTicks);
+	restartSysTick(value + static_cast<uint32_t>(requestedTicks - 1) * period, period);
+}
+
+uint64_t stopTicklessIdle()
+{
+	const auto ticks = requestedTicks;
+	requestedTicks = {};
+
+	if (ticks == 0)
+		return 0;
+
+	// one-shot timer expired, its tick interrupt is pending - counter was already reloaded with the period of tick
+	if (isTickPending() == true)
+		return ticks - 1;
+
+	const auto period = getPeriod();
+	SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+	const uint32_t value {SysTick->VAL};
+
+	// one-shot timer expired while the counter was being stopped
+	if (isTickPending() == true)
+	{
+		restartSysTick(value, period);
+		return ticks - 1;
+	}
+
+	// woken up before expiration of one-shot timer - shorten it to the number of counts left to next periodic tick
+	const auto remainingTicks = std::max<uint32_t>((value + period - 1) / period, 1);
+	restartSysTick(value - (remainingTicks - 1) * period, period);
+	return ticks - remainingTicks;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
@@ -15,10 +15,12 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-architectureLowLevelInitializer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-disableInterruptMasking.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-enableInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getCycleCount.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-getMainStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-initializeStack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-isInInterruptContext.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-PendSV_Handler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-protectStackGuard.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-requestContextSwitch.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-requestFunctionExecution.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-Reset_Handler.cpp
@@ -26,7 +28,9 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-startScheduling.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-supervisorCall.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SVC_Handler.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SysTick_Handler.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-SysTick_Handler.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-ticklessIdle.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ARMv6-M-ARMv7-M-waitForInterrupt.cpp)
 
 doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}
 		INCLUDE_PATH ${CMAKE_CURRENT_LIST_DIR}/include ${CMAKE_CURRENT_LIST_DIR}/external/CMSIS
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief enableInterruptMasking() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/enableInterruptMasking.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+#include <atomic>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+InterruptMask enableInterruptMasking()
+{
+	const InterruptMask interruptMask = interruptsMasked;
+	interruptsMasked = true;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	return interruptMask;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief getCycleCount() and getCycleCountFrequency() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/getCycleCountFrequency.hpp"
+
+#include <ctime>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint64_t getCycleCount()
+{
+	// one "cycle" of host's monotonic clock is one nanosecond
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<uint64_t>(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+uint64_t getCycleCountFrequency()
+{
+	return 1000000000;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
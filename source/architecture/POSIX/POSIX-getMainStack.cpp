@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief getMainStack() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getMainStack.hpp"
+
+#include "distortos/internal/scheduler/stackGuardSize.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+extern "C"
+{
+
+/// highest address of stack used by process' startup code - imported from glibc
+extern void* __libc_stack_end;
+
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<void*, size_t> getMainStack()
+{
+	// main thread uses the stack of the process, only the part just below the area used by startup code is reserved
+	constexpr size_t stackSize {(CONFIG_MAIN_THREAD_STACK_SIZE + CONFIG_ARCHITECTURE_STACK_OVERHEAD +
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT - 1) / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT + internal::stackGuardSize};
+	const auto stackEnd = reinterpret_cast<uintptr_t>(__libc_stack_end) / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT;
+	return {reinterpret_cast<void*>(stackEnd - stackSize), stackSize};
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
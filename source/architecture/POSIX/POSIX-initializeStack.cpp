@@ -0,0 +1,72 @@
+/**
+ * \file
+ * \brief initializeStack() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/initializeStack.hpp"
+
+#include "POSIX-makeContext.hpp"
+
+#include "distortos/internal/scheduler/threadRunner.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cerrno>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Wrapper for internal::threadRunner() which can be used with makeContext()
+ *
+ * \param [in] runnableThread is a pointer to internal::RunnableThread object that will be run
+ */
+
+void threadRunnerWrapper(void* const runnableThread, void*)
+{
+	internal::threadRunner(*static_cast<internal::RunnableThread*>(runnableThread));
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, void*> initializeStack(void* const buffer, const size_t size, internal::RunnableThread& runnableThread)
+{
+	// CONFIG_ARCHITECTURE_STACK_OVERHEAD is added to each requested stack size, so a stack which is not larger than that
+	// was requested with size 0 - it is rejected, just like on any other architecture
+	if (size <= CONFIG_ARCHITECTURE_STACK_OVERHEAD)
+		return {ENOSPC, {}};
+
+	const auto end = reinterpret_cast<uintptr_t>(buffer) + size - sizeof(ucontext_t);
+	const auto context = reinterpret_cast<ucontext_t*>(end / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT);
+	if (size < sizeof(ucontext_t) || static_cast<void*>(context) < buffer)
+		return {ENOSPC, {}};
+
+	makeContext(*context, context, threadRunnerWrapper, &runnableThread, nullptr);
+	return {{}, context};
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
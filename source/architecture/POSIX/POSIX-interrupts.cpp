@@ -0,0 +1,187 @@
+/**
+ * \file
+ * \brief Implementation of "virtual interrupt controller" for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-interrupts.hpp"
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#if defined(CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE) || \
+		defined(CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE)
+
+#include "distortos/FATAL_ERROR.h"
+
+#endif	// defined(CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE) ||
+		// defined(CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE)
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with functions requested by tick interrupt handler to be executed in the interrupted thread
+using InterruptFunctions = std::array<void(*)(), 4>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// functions requested by currently executed tick interrupt handler to be executed in the interrupted thread
+InterruptFunctions interruptFunctions;
+
+/// number of valid elements in interruptFunctions
+size_t interruptFunctionsCount;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief "Interrupt" handler which performs the context switch.
+ *
+ * Context of current thread is saved in a ucontext_t object allocated on its own stack - address of this object is
+ * the thread's "stack pointer" passed to internal::Scheduler::switchContext(). This function also checks stack pointer
+ * range when this functionality is enabled - if the check fails, FATAL_ERROR() is called.
+ *
+ * \pre Interrupts are masked.
+ */
+
+void contextSwitchHandler()
+{
+	ucontext_t context;
+	auto& scheduler = internal::getScheduler();
+
+#ifdef CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
+
+	if (scheduler.getCurrentThreadControlBlock().getStack().checkStackPointer(&context) == false)
+		FATAL_ERROR("Stack overflow detected!");
+
+#endif	// def CONFIG_CHECK_STACK_POINTER_RANGE_CONTEXT_SWITCH_ENABLE
+
+	const auto newContext = static_cast<ucontext_t*>(scheduler.switchContext(&context));
+	if (newContext != &context)
+		swapcontext(&context, newContext);
+}
+
+/**
+ * \brief Tick interrupt handler.
+ *
+ * This function also checks stack pointer range when this functionality is enabled - if the check fails, FATAL_ERROR()
+ * is called.
+ *
+ * \pre Interrupts are masked.
+ */
+
+void tickInterruptHandler()
+{
+	internal::traceEvent(trace::EventType::interruptEnter, {}, trace::tickInterruptNumber);
+
+	auto& scheduler = internal::getScheduler();
+
+#ifdef CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+	const auto stackPointer = __builtin_frame_address(0);
+	if (scheduler.getCurrentThreadControlBlock().getStack().checkStackPointer(stackPointer) == false)
+		FATAL_ERROR("Stack overflow detected!");
+
+#endif	// def CONFIG_CHECK_STACK_POINTER_RANGE_SYSTEM_TICK_ENABLE
+
+	const auto contextSwitchRequired = scheduler.tickInterruptHandler();
+	if (contextSwitchRequired == true)
+		requestContextSwitch();
+
+	internal::traceEvent(trace::EventType::interruptExit, {}, trace::tickInterruptNumber);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+volatile sig_atomic_t inInterrupt;
+volatile sig_atomic_t interruptsMasked;
+volatile sig_atomic_t contextSwitchPending;
+volatile sig_atomic_t tickInterruptPending;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void handlePendingInterrupts()
+{
+	while (tickInterruptPending != false || contextSwitchPending != false)
+	{
+		interruptsMasked = true;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+
+		// functions requested by tick interrupt handler must be executed by the interrupted thread, so they are saved
+		// on its stack - context switch (if any) is done before they are executed
+		InterruptFunctions functions;
+		size_t functionsCount {};
+
+		if (tickInterruptPending != false)
+		{
+			tickInterruptPending = false;
+			inInterrupt = true;
+			tickInterruptHandler();
+			inInterrupt = false;
+
+			functions = interruptFunctions;
+			functionsCount = interruptFunctionsCount;
+			interruptFunctionsCount = {};
+		}
+
+		if (contextSwitchPending != false)
+		{
+			contextSwitchPending = false;
+			contextSwitchHandler();
+		}
+
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		interruptsMasked = false;
+
+		for (size_t i {}; i < functionsCount; ++i)
+			functions[i]();
+	}
+}
+
+int requestFunctionExecutionAfterInterrupt(void (& function)())
+{
+	if (interruptFunctionsCount >= interruptFunctions.size())
+		return ENOSPC;
+
+	interruptFunctions[interruptFunctionsCount++] = &function;
+	return 0;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
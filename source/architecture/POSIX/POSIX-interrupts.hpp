@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \brief Declarations of "virtual interrupt controller" for POSIX
+ *
+ * The host process has only one kernel thread, which executes all distortos threads one at a time. Interrupts are
+ * emulated with signals - the tick interrupt is SIGALRM and the context switch is executed directly when it is
+ * requested and allowed, the same way PendSV would be executed on ARMv6-M and ARMv7-M. Masking of interrupts is "soft" -
+ * it is just a flag which is checked by the signal handler, all events that occur while interrupts are masked are
+ * marked as pending and handled as soon as interrupt masking is disabled.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_POSIX_INTERRUPTS_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_POSIX_INTERRUPTS_HPP_
+
+#include <csignal>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// true if tick interrupt handler is currently executed, false otherwise
+extern volatile sig_atomic_t inInterrupt;
+
+/// true if interrupts are masked, false otherwise
+extern volatile sig_atomic_t interruptsMasked;
+
+/// true if context switch is pending, false otherwise
+extern volatile sig_atomic_t contextSwitchPending;
+
+/// true if tick interrupt is pending, false otherwise
+extern volatile sig_atomic_t tickInterruptPending;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Handles all pending "interrupts".
+ *
+ * Executes tick interrupt handler (if it is pending), then context switch (if it is pending) and then all functions
+ * which were requested by tick interrupt handler to be executed in the interrupted thread. This is repeated until
+ * nothing is pending.
+ *
+ * \pre Interrupts are not masked.
+ * \pre Interrupt handler is not being executed.
+ */
+
+void handlePendingInterrupts();
+
+/**
+ * \brief Requests execution of provided function in current thread after tick interrupt handler returns.
+ *
+ * \pre Tick interrupt handler is being executed.
+ *
+ * \param [in] function is a reference to function that should be executed in current thread
+ *
+ * \return 0 on success, error code otherwise:
+ * - ENOSPC - too many functions were already requested by currently executed tick interrupt handler;
+ */
+
+int requestFunctionExecutionAfterInterrupt(void (& function)());
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_POSIX_INTERRUPTS_HPP_
@@ -0,0 +1,97 @@
+/**
+ * \file
+ * \brief Low-level initialization of the process for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getMainStack.hpp"
+
+#include "distortos/internal/BIND_LOW_LEVEL_INITIALIZER_IMPLEMENTATION.h"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+extern "C"
+{
+
+/// beginning of array with low-level preinitializers - imported from linker script
+extern LowLevelInitializer* const __low_level_preinitializers_start[];
+
+/// end of array with low-level preinitializers - imported from linker script
+extern LowLevelInitializer* const __low_level_preinitializers_end[];
+
+/// beginning of array with low-level initializers - imported from linker script
+extern LowLevelInitializer* const __low_level_initializers_start[];
+
+/// end of array with low-level initializers - imported from linker script
+extern LowLevelInitializer* const __low_level_initializers_end[];
+
+}
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Fills unused part of main stack with sentinel.
+ *
+ * Only the part of main stack which is below the stack frame of this function (and some safety margin) is filled.
+ */
+
+__attribute__ ((noinline))
+void fillMainStack()
+{
+	constexpr uint32_t stackSentinel {0xed419f25};
+	constexpr size_t safetyMargin {1024};
+
+	const auto mainStack = getMainStack();
+	const auto begin = static_cast<uint32_t*>(mainStack.first);
+	const auto end = reinterpret_cast<uint32_t*>(static_cast<uint8_t*>(__builtin_frame_address(0)) - safetyMargin);
+	if (end > begin)
+		std::fill(begin, end, stackSentinel);
+}
+
+/**
+ * \brief Low-level initialization of the process for POSIX
+ *
+ * This is an equivalent of Reset_Handler() on ARMv6-M and ARMv7-M. It is executed as the first constructor of the
+ * application - after the C library is initialized, but before constructors for global and static objects. It fills
+ * main stack with sentinel and executes all low-level preinitializers and initializers.
+ */
+
+__attribute__ ((constructor(101)))
+void lowLevelInitialization()
+{
+	fillMainStack();
+
+	std::for_each(__low_level_preinitializers_start, __low_level_preinitializers_end,
+			[](LowLevelInitializer* const lowLevelInitializer)
+			{
+				lowLevelInitializer();
+			});
+	std::for_each(__low_level_initializers_start, __low_level_initializers_end,
+			[](LowLevelInitializer* const lowLevelInitializer)
+			{
+				lowLevelInitializer();
+			});
+}
+
+}	// namespace
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,137 @@
+/**
+ * \file
+ * \brief makeContext() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-makeContext.hpp"
+
+#include "distortos/architecture/disableInterruptMasking.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Joins two halves of a pointer.
+ *
+ * \param [in] high is the upper half of the pointer
+ * \param [in] low is the lower half of the pointer
+ *
+ * \return pointer joined from \a high and \a low
+ */
+
+void* joinPointer(const int high, const int low)
+{
+	const auto value = static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32 | static_cast<uint32_t>(low);
+	return reinterpret_cast<void*>(static_cast<uintptr_t>(value));
+}
+
+/**
+ * \brief Entry function of contexts prepared by makeContext().
+ *
+ * makecontext() can pass only int arguments, so all pointers are split into two halves.
+ *
+ * \param [in] functionHigh is the upper half of pointer to function that will be executed
+ * \param [in] functionLow is the lower half of pointer to function that will be executed
+ * \param [in] argument1High is the upper half of the first argument for function
+ * \param [in] argument1Low is the lower half of the first argument for function
+ * \param [in] argument2High is the upper half of the second argument for function
+ * \param [in] argument2Low is the lower half of the second argument for function
+ */
+
+void contextEntry(const int functionHigh, const int functionLow, const int argument1High, const int argument1Low,
+		const int argument2High, const int argument2Low)
+{
+	// context was activated by context switch with interrupts masked - unmask them, just like exception return does
+	disableInterruptMasking();
+
+	const auto function = reinterpret_cast<void(*)(void*, void*)>(joinPointer(functionHigh, functionLow));
+	function(joinPointer(argument1High, argument1Low), joinPointer(argument2High, argument2Low));
+	__builtin_unreachable();
+}
+
+/**
+ * \brief Gets upper half of a pointer.
+ *
+ * \param [in] pointer is the pointer which will be split
+ *
+ * \return upper half of \a pointer
+ */
+
+int getHigh(const void* const pointer)
+{
+	return static_cast<uint32_t>(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pointer)) >> 32);
+}
+
+/**
+ * \brief Gets lower half of a pointer.
+ *
+ * \param [in] pointer is the pointer which will be split
+ *
+ * \return lower half of \a pointer
+ */
+
+int getLow(const void* const pointer)
+{
+	return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(pointer));
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* getContextStackPointer(const ucontext_t& context)
+{
+#if defined(__x86_64__)
+
+	constexpr size_t redZoneSize {128};
+	return reinterpret_cast<uint8_t*>(context.uc_mcontext.gregs[REG_RSP]) - redZoneSize;
+
+#elif defined(__aarch64__)
+
+	return reinterpret_cast<void*>(context.uc_mcontext.sp);
+
+#else
+
+#error "Host architecture is not supported!"
+
+#endif
+}
+
+void makeContext(ucontext_t& context, void* const stackEnd, void (& function)(void*, void*), void* const argument1,
+		void* const argument2)
+{
+	getcontext(&context);
+	context.uc_link = {};
+	context.uc_stack.ss_sp = stackEnd;
+	context.uc_stack.ss_size = {};
+	sigemptyset(&context.uc_sigmask);
+
+	const auto functionPointer = reinterpret_cast<const void*>(&function);
+	makecontext(&context, reinterpret_cast<void(*)()>(contextEntry), 6, getHigh(functionPointer),
+			getLow(functionPointer), getHigh(argument1), getLow(argument1), getHigh(argument2), getLow(argument2));
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
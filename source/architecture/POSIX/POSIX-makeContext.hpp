@@ -0,0 +1,61 @@
+/**
+ * \file
+ * \brief makeContext() declaration
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_POSIX_MAKECONTEXT_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_POSIX_MAKECONTEXT_HPP_
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Gets the lowest address of stack which is used by provided context.
+ *
+ * Anything below the returned address may be freely used without damaging \a context.
+ *
+ * \param [in] context is a reference to ucontext_t object which was saved by swapcontext() or prepared by
+ * makeContext()
+ *
+ * \return the lowest address of stack which is used by \a context, including the area which may be used by
+ * functions without adjusting stack pointer ("red zone")
+ */
+
+void* getContextStackPointer(const ucontext_t& context);
+
+/**
+ * \brief Prepares context which will execute provided function on provided stack.
+ *
+ * The context is prepared with interrupts enabled - \a function starts with no interrupt masking and with all signals
+ * unblocked.
+ *
+ * \note glibc's makecontext() uses only the end of stack region, so there's no need to pass its beginning.
+ *
+ * \param [out] context is a reference to ucontext_t object which will be prepared
+ * \param [in] stackEnd is a pointer to the end of stack region, usually the address of \a context itself, as the stack
+ * is descending and the object is placed directly above the part of stack that will be used
+ * \param [in] function is a reference to function that will be executed when \a context is activated, it must not
+ * return
+ * \param [in] argument1 is the first argument for \a function
+ * \param [in] argument2 is the second argument for \a function
+ */
+
+void makeContext(ucontext_t& context, void* stackEnd, void (& function)(void*, void*), void* argument1,
+		void* argument2);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_POSIX_MAKECONTEXT_HPP_
@@ -0,0 +1,141 @@
+/**
+ * \file
+ * \brief Locking of glibc's memory allocator for POSIX
+ *
+ * glibc's allocator uses pthread mutexes, which cannot be used to synchronize distortos threads - all of them are
+ * executed by the same thread of the host process. All allocation functions are wrapped and executed with interrupts
+ * masked instead.
+ *
+ * \warning Other parts of glibc which use internal locking (like stdio functions) are not protected and should not be
+ * used concurrently from multiple distortos threads.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/newlib/locking.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* __libc_calloc(size_t elements, size_t size);
+void __libc_free(void* memory);
+void* __libc_malloc(size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void* __libc_realloc(void* memory, size_t size);
+
+}	// extern "C"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of Mutex used for malloc() and free() locking
+Mutex mallocMutexInstance {Mutex::Type::recursive, Mutex::Protocol::priorityInheritance};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Wrapper for aligned_alloc() which masks interrupts
+ */
+
+void* aligned_alloc(const size_t alignment, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return __libc_memalign(alignment, size);
+}
+
+/**
+ * \brief Wrapper for calloc() which masks interrupts
+ */
+
+void* calloc(const size_t elements, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return __libc_calloc(elements, size);
+}
+
+/**
+ * \brief Wrapper for free() which masks interrupts
+ */
+
+void free(void* const memory)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	__libc_free(memory);
+}
+
+/**
+ * \brief Wrapper for malloc() which masks interrupts
+ */
+
+void* malloc(const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return __libc_malloc(size);
+}
+
+/**
+ * \brief Wrapper for memalign() which masks interrupts
+ */
+
+void* memalign(const size_t alignment, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return __libc_memalign(alignment, size);
+}
+
+/**
+ * \brief Wrapper for posix_memalign() which masks interrupts
+ */
+
+int posix_memalign(void** const memory, const size_t alignment, const size_t size)
+{
+	if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+		return EINVAL;
+
+	const auto allocatedMemory = memalign(alignment, size);
+	if (allocatedMemory == nullptr)
+		return ENOMEM;
+
+	*memory = allocatedMemory;
+	return 0;
+}
+
+/**
+ * \brief Wrapper for realloc() which masks interrupts
+ */
+
+void* realloc(void* const memory, const size_t size)
+{
+	const distortos::InterruptMaskingLock interruptMaskingLock;
+	return __libc_realloc(memory, size);
+}
+
+}	// extern "C"
@@ -0,0 +1,90 @@
+/**
+ * \file
+ * \brief protectStackGuard() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/protectStackGuard.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/FATAL_ERROR.h"
+
+#include <sys/mman.h>
+
+#include <unistd.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// beginning of currently protected region
+void* protectedBegin;
+
+/// size of currently protected region, bytes
+size_t protectedSize;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Low-level initializer of hardware protection of "stack guard"
+ *
+ * This function is called before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ *
+ * Verifies that stackGuardProtectionGranularity is a multiple of size of memory page of the host.
+ */
+
+void stackGuardProtectionLowLevelInitializer()
+{
+	const auto pageSize = sysconf(_SC_PAGESIZE);
+	if (pageSize <= 0 || stackGuardProtectionGranularity % pageSize != 0)
+		FATAL_ERROR("Size of memory page is not supported by hardware protection of stack guard!");
+}
+
+BIND_LOW_LEVEL_INITIALIZER(32, stackGuardProtectionLowLevelInitializer);
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void protectStackGuard(void* const begin, const size_t size)
+{
+	if (begin == protectedBegin)
+		return;
+
+	if (protectedBegin != nullptr && mprotect(protectedBegin, protectedSize, PROT_READ | PROT_WRITE) != 0)
+		FATAL_ERROR("Removal of stack guard protection failed!");
+
+	if (mprotect(begin, size, PROT_READ) != 0)
+		FATAL_ERROR("Stack guard protection failed!");
+
+	protectedBegin = begin;
+	protectedSize = size;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
@@ -0,0 +1,112 @@
+/**
+ * \file
+ * \brief requestFunctionExecution() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/requestFunctionExecution.hpp"
+
+#include "distortos/architecture/isInInterruptContext.hpp"
+
+#include "POSIX-interrupts.hpp"
+#include "POSIX-makeContext.hpp"
+
+#include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/getScheduler.hpp"
+
+#include "distortos/FATAL_ERROR.h"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cerrno>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Trampoline used to execute function in new context.
+ *
+ * After the function returns, previous context of the thread is restored.
+ *
+ * \param [in] function is a pointer to function that will be executed
+ * \param [in] savedContext is a pointer to context of the thread before new context was created
+ */
+
+void functionTrampoline(void* const function, void* const savedContext)
+{
+	reinterpret_cast<void(*)()>(function)();
+
+	// saved context is always restored with interrupts masked, just like it was when the context was saved
+	interruptsMasked = true;
+	setcontext(static_cast<ucontext_t*>(savedContext));
+	__builtin_unreachable();
+}
+
+/**
+ * \brief Handles request to execute provided function in non-current thread.
+ *
+ * New context - which executes \a function and then restores the previous one - is created on the stack of the
+ * thread, directly below the area used by its saved context.
+ *
+ * \param [in] threadControlBlock is a reference to internal::ThreadControlBlock of thread in which \a function should
+ * be executed
+ * \param [in] function is a reference to function that should be executed in thread associated with
+ * \a threadControlBlock
+ *
+ * \return 0 on success, error code otherwise:
+ * - ENOSPC - amount of free stack is too small to request function execution;
+ */
+
+int toNonCurrentThread(internal::ThreadControlBlock& threadControlBlock, void (& function)())
+{
+	auto& stack = threadControlBlock.getStack();
+	const auto savedContext = stack.getStackPointer();
+	const auto end = reinterpret_cast<uintptr_t>(getContextStackPointer(*static_cast<ucontext_t*>(savedContext))) -
+			sizeof(ucontext_t);
+	const auto context = reinterpret_cast<ucontext_t*>(end / CONFIG_ARCHITECTURE_STACK_ALIGNMENT *
+			CONFIG_ARCHITECTURE_STACK_ALIGNMENT);
+	if (stack.checkStackPointer(context) == false)
+		return ENOSPC;
+
+	makeContext(*context, context, functionTrampoline, reinterpret_cast<void*>(&function), savedContext);
+	stack.setStackPointer(context);
+	return 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int requestFunctionExecution(internal::ThreadControlBlock& threadControlBlock, void (& function)())
+{
+	const auto& currentThreadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+	if (&threadControlBlock != &currentThreadControlBlock)	// request to non-current thread?
+		return toNonCurrentThread(threadControlBlock, function);
+
+	if (isInInterruptContext() == true)	// interrupt is sending the request to current thread?
+		return requestFunctionExecutionAfterInterrupt(function);
+
+	FATAL_ERROR("Current thread of execution is sending the request to itself!");
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief restoreInterruptMasking() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/restoreInterruptMasking.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+#include <atomic>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void restoreInterruptMasking(const InterruptMask interruptMask)
+{
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	interruptsMasked = interruptMask;
+
+	if (interruptMask == false && inInterrupt == false)
+		handlePendingInterrupts();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,104 @@
+/**
+ * \file
+ * \brief Start of scheduling for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-interrupts.hpp"
+
+#include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
+#include "distortos/FATAL_ERROR.h"
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cerrno>
+#include <cstdlib>
+
+#include <sys/time.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Stops scheduling for POSIX
+ *
+ * Stops the tick timer and masks interrupts permanently, so that the rest of process' termination is executed only by
+ * the thread which called exit(). This function is registered with atexit().
+ */
+
+void stopScheduling()
+{
+	interruptsMasked = true;
+	const itimerval timerValue {};
+	setitimer(ITIMER_REAL, &timerValue, nullptr);
+}
+
+/**
+ * \brief Handler of SIGALRM - tick interrupt of scheduler.
+ *
+ * Marks tick interrupt as pending and handles it immediately if interrupts are not masked.
+ */
+
+void tickSignalHandler(int)
+{
+	const auto savedErrno = errno;
+
+	tickInterruptPending = true;
+	if (interruptsMasked == false && inInterrupt == false)
+		handlePendingInterrupts();
+
+	errno = savedErrno;
+}
+
+/**
+ * \brief Start of scheduling for POSIX
+ *
+ * Installs handler of SIGALRM and configures real-time interval timer as the tick timer. This function is called
+ * before constructors for global and static objects via BIND_LOW_LEVEL_INITIALIZER().
+ */
+
+void startScheduling()
+{
+	static_assert(CONFIG_TICK_FREQUENCY <= 1000000, "Tick frequency must not be higher than 1 MHz!");
+
+	// SIGALRM must not be blocked while its handler executes - the handler may never return to the code it interrupted
+	// (context switch, delivery of signals to current thread), while nesting is already prevented by inInterrupt and
+	// interruptsMasked flags
+	struct sigaction signalAction {};
+	signalAction.sa_handler = tickSignalHandler;
+	signalAction.sa_flags = SA_NODEFER | SA_RESTART;
+	sigemptyset(&signalAction.sa_mask);
+	if (sigaction(SIGALRM, &signalAction, nullptr) != 0)
+		FATAL_ERROR("Installation of SIGALRM handler failed!");
+
+	if (atexit(stopScheduling) != 0)
+		FATAL_ERROR("Registration of atexit() function failed!");
+
+	constexpr suseconds_t period {1000000 / CONFIG_TICK_FREQUENCY};
+	const itimerval timerValue {{0, period}, {0, period}};
+	if (setitimer(ITIMER_REAL, &timerValue, nullptr) != 0)
+		FATAL_ERROR("Configuration of tick timer failed!");
+}
+
+BIND_LOW_LEVEL_INITIALIZER(70, startScheduling);
+
+}	// namespace
+
+}	// namespace architecture
+
+}	// namespace distortos
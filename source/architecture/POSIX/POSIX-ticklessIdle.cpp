@@ -0,0 +1,201 @@
+/**
+ * \file
+ * \brief startTicklessIdle() and stopTicklessIdle() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/startTicklessIdle.hpp"
+#include "distortos/architecture/stopTicklessIdle.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "POSIX-interrupts.hpp"
+
+#include <algorithm>
+
+#include <sys/time.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TickSignalBlockingLock is a RAII wrapper which blocks delivery of SIGALRM
+class TickSignalBlockingLock
+{
+public:
+
+	/**
+	 * \brief TickSignalBlockingLock's constructor
+	 *
+	 * Blocks SIGALRM, saving previous signal mask.
+	 */
+
+	TickSignalBlockingLock()
+	{
+		sigset_t signalSet;
+		sigemptyset(&signalSet);
+		sigaddset(&signalSet, SIGALRM);
+		sigprocmask(SIG_BLOCK, &signalSet, &previousSignalSet_);
+	}
+
+	/**
+	 * \brief TickSignalBlockingLock's destructor
+	 *
+	 * Restores previous signal mask.
+	 */
+
+	~TickSignalBlockingLock()
+	{
+		sigprocmask(SIG_SETMASK, &previousSignalSet_, nullptr);
+	}
+
+	TickSignalBlockingLock(const TickSignalBlockingLock&) = delete;
+	TickSignalBlockingLock(TickSignalBlockingLock&&) = delete;
+	const TickSignalBlockingLock& operator=(const TickSignalBlockingLock&) = delete;
+	TickSignalBlockingLock& operator=(TickSignalBlockingLock&&) = delete;
+
+private:
+
+	/// signal mask from before SIGALRM was blocked
+	sigset_t previousSignalSet_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// period of tick, microseconds
+constexpr uint64_t tickPeriod {1000000 / CONFIG_TICK_FREQUENCY};
+
+/// maximum number of ticks in one period of tickless idle mode - one hour
+constexpr uint64_t maxTicks {3600 * static_cast<uint64_t>(CONFIG_TICK_FREQUENCY)};
+
+/// number of ticks requested in last call to startTicklessIdle(), 0 if tickless idle mode was not started
+uint64_t requestedTicks;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests whether tick interrupt is pending.
+ *
+ * \pre SIGALRM is blocked.
+ *
+ * \return true if tick interrupt is pending - either already marked as pending by SIGALRM handler or not yet delivered
+ * because SIGALRM is blocked, false otherwise
+ */
+
+bool isTickPending()
+{
+	if (tickInterruptPending != false)
+		return true;
+
+	sigset_t signalSet;
+	sigpending(&signalSet);
+	return sigismember(&signalSet, SIGALRM) == 1;
+}
+
+/**
+ * \brief Converts timeval to microseconds.
+ *
+ * \param [in] value is the timeval that will be converted
+ *
+ * \return \a value converted to microseconds
+ */
+
+uint64_t toMicroseconds(const timeval& value)
+{
+	return static_cast<uint64_t>(value.tv_sec) * 1000000 + value.tv_usec;
+}
+
+/**
+ * \brief Converts microseconds to timeval.
+ *
+ * \param [in] microseconds is the number of microseconds that will be converted
+ *
+ * \return \a microseconds converted to timeval
+ */
+
+timeval toTimeval(const uint64_t microseconds)
+{
+	return {static_cast<time_t>(microseconds / 1000000), static_cast<suseconds_t>(microseconds % 1000000)};
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void startTicklessIdle(const uint64_t ticks)
+{
+	const TickSignalBlockingLock tickSignalBlockingLock;
+
+	requestedTicks = {};
+
+	// tick which was generated before the call to this function will be handled in periodic mode
+	if (isTickPending() == true)
+		return;
+
+	requestedTicks = std::min(ticks, maxTicks);
+
+	// value of the timer is the time left to next periodic tick, so extending it keeps the phase of ticks unchanged -
+	// after expiration the timer is reloaded with the interval, so periodic mode is resumed automatically
+	itimerval timerValue;
+	getitimer(ITIMER_REAL, &timerValue);
+	timerValue.it_value = toTimeval(toMicroseconds(timerValue.it_value) + (requestedTicks - 1) * tickPeriod);
+	setitimer(ITIMER_REAL, &timerValue, nullptr);
+}
+
+uint64_t stopTicklessIdle()
+{
+	const TickSignalBlockingLock tickSignalBlockingLock;
+
+	const auto ticks = requestedTicks;
+	requestedTicks = {};
+
+	if (ticks == 0)
+		return 0;
+
+	// one-shot timer expired, its tick interrupt is pending - periodic timer is restarted with full period, as wakeup of
+	// the process may be delayed and the next tick generated with original phase could follow the pending one almost
+	// immediately
+	if (isTickPending() == true)
+	{
+		const itimerval timerValue {toTimeval(tickPeriod), toTimeval(tickPeriod)};
+		setitimer(ITIMER_REAL, &timerValue, nullptr);
+		return ticks - 1;
+	}
+
+	// woken up before expiration of one-shot timer - shorten it to the time left to next periodic tick
+	itimerval timerValue;
+	getitimer(ITIMER_REAL, &timerValue);
+	const auto remaining = toMicroseconds(timerValue.it_value);
+	const auto remainingTicks = std::max<uint64_t>((remaining + tickPeriod - 1) / tickPeriod, 1);
+	timerValue.it_value = toTimeval(remaining - (remainingTicks - 1) * tickPeriod);
+	setitimer(ITIMER_REAL, &timerValue, nullptr);
+	return ticks - remainingTicks;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief waitForInterrupt() implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void waitForInterrupt()
+{
+	// SIGALRM is blocked while the flags are checked, so it cannot be lost between the check and sigsuspend()
+	sigset_t signalSet;
+	sigemptyset(&signalSet);
+	sigaddset(&signalSet, SIGALRM);
+	sigset_t previousSignalSet;
+	sigprocmask(SIG_BLOCK, &signalSet, &previousSignalSet);
+
+	while (tickInterruptPending == false && contextSwitchPending == false)
+		sigsuspend(&previousSignalSet);
+
+	sigprocmask(SIG_SETMASK, &previousSignalSet, nullptr);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
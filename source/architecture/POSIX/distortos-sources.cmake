@@ -0,0 +1,32 @@
+#
+# file: distortos-sources.cmake
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+target_include_directories(distortos PUBLIC
+		${CMAKE_CURRENT_LIST_DIR}/include)
+
+target_sources(distortos PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-disableInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-enableInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-getCycleCount.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-getMainStack.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-initializeStack.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-interrupts.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-isInInterruptContext.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-lowLevelInitialization.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-makeContext.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-mallocLocking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-protectStackGuard.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-requestContextSwitch.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-requestFunctionExecution.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-restoreInterruptMasking.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-startScheduling.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-ticklessIdle.cpp
+		${CMAKE_CURRENT_LIST_DIR}/POSIX-waitForInterrupt.cpp)
+
+doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR} INCLUDE_PATH ${CMAKE_CURRENT_LIST_DIR}/include)
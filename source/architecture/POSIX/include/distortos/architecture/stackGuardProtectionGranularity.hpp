@@ -0,0 +1,30 @@
+/**
+ * \file
+ * \brief stackGuardProtectionGranularity constant
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_STACKGUARDPROTECTIONGRANULARITY_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_STACKGUARDPROTECTIONGRANULARITY_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// minimal size (and alignment) of region with hardware protection, bytes - size of memory page
+constexpr size_t stackGuardProtectionGranularity {4096};
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_STACKGUARDPROTECTIONGRANULARITY_HPP_
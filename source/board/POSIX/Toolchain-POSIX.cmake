@@ -0,0 +1,74 @@
+#
+# file: Toolchain-POSIX.cmake
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+if(SOURCE_BOARD_POSIX_TOOLCHAIN_POSIX_CMAKE_)
+	return()
+endif()
+set(SOURCE_BOARD_POSIX_TOOLCHAIN_POSIX_CMAKE_ 1)
+
+list(APPEND CMAKE_MODULE_PATH "${CMAKE_CURRENT_LIST_DIR}/../../../cmake")
+
+include(distortos-utilities)
+
+# native compilers of the host are used, so CMAKE_SYSTEM_NAME, CMAKE_C_COMPILER and CMAKE_CXX_COMPILER are not set
+set(CMAKE_SIZE "size")
+
+set(CMAKE_C_FLAGS
+		"-ffunction-sections -fdata-sections -Wall -Wextra -Wshadow"
+		CACHE STRING "Flags used by the C compiler during all build types.")
+# distortos threads are executed by a single thread of the host process, so pthread-based guards of local static
+# objects would deadlock
+set(CMAKE_CXX_FLAGS
+		"-fno-rtti -fno-exceptions -fno-threadsafe-statics -ffunction-sections -fdata-sections -Wall -Wextra -Wshadow"
+		CACHE STRING "Flags used by the CXX compiler during all build types.")
+# lazy binding is disabled, as dynamic linker would have to be executed with interrupts enabled
+set(CMAKE_EXE_LINKER_FLAGS
+		"-Wl,--gc-sections -Wl,-z,now"
+		CACHE STRING "Flags used by the linker during all build types.")
+
+set(CMAKE_C_FLAGS_DEBUG
+		"-Og -g -ggdb3"
+		CACHE STRING "Flags used by the C compiler during DEBUG builds.")
+set(CMAKE_C_FLAGS_MINSIZEREL
+		"-Os -DNDEBUG"
+		CACHE STRING "Flags used by the C compiler during MINSIZEREL builds.")
+set(CMAKE_C_FLAGS_RELEASE
+		"-O2 -DNDEBUG"
+		CACHE STRING "Flags used by the C compiler during RELEASE builds.")
+set(CMAKE_C_FLAGS_RELWITHDEBINFO
+		"-O2 -g -ggdb3 -DNDEBUG"
+		CACHE STRING "Flags used by the C compiler during RELWITHDEBINFO builds.")
+
+set(CMAKE_CXX_FLAGS_DEBUG
+		"-Og -g -ggdb3" CACHE STRING
+		"Flags used by the CXX compiler during DEBUG builds.")
+set(CMAKE_CXX_FLAGS_MINSIZEREL
+		"-Os -DNDEBUG" CACHE STRING
+		"Flags used by the CXX compiler during MINSIZEREL builds.")
+set(CMAKE_CXX_FLAGS_RELEASE
+		"-O2 -DNDEBUG" CACHE STRING
+		"Flags used by the CXX compiler during RELEASE builds.")
+set(CMAKE_CXX_FLAGS_RELWITHDEBINFO
+		"-O2 -g -ggdb3 -DNDEBUG" CACHE STRING
+		"Flags used by the CXX compiler during RELWITHDEBINFO builds.")
+
+set(CMAKE_EXE_LINKER_FLAGS_DEBUG
+		"" CACHE STRING
+		"Flags used by the linker during DEBUG builds.")
+set(CMAKE_EXE_LINKER_FLAGS_MINSIZEREL
+		"" CACHE STRING
+		"Flags used by the linker during MINSIZEREL builds.")
+set(CMAKE_EXE_LINKER_FLAGS_RELEASE
+		"" CACHE STRING
+		"Flags used by the linker during RELEASE builds.")
+set(CMAKE_EXE_LINKER_FLAGS_RELWITHDEBINFO
+		"" CACHE STRING
+		"Flags used by the linker during RELWITHDEBINFO builds.")
+
+set(DISTORTOS_BOARD_PATH "source/board/POSIX")
@@ -0,0 +1,55 @@
+#
+# file: cmake/90-POSIX.cmake
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+set(DISTORTOS_RAW_LINKER_SCRIPT "source/board/POSIX/POSIX.ld")
+
+distortosSetConfiguration(BOOLEAN
+		CONFIG_ARCHITECTURE_ASCENDING_STACK
+		OFF
+		INTERNAL)
+
+distortosSetConfiguration(BOOLEAN
+		CONFIG_ARCHITECTURE_EMPTY_STACK
+		OFF
+		INTERNAL)
+
+distortosSetConfiguration(INTEGER
+		CONFIG_ARCHITECTURE_STACK_ALIGNMENT
+		16
+		INTERNAL)
+
+distortosSetConfiguration(BOOLEAN
+		CONFIG_ARCHITECTURE_POSIX
+		ON
+		INTERNAL)
+
+distortosSetConfiguration(INTEGER
+		distortos_Architecture_00_Stack_overhead
+		16384
+		MIN 0
+		HELP "Size (in bytes) added to stack of each thread.
+
+		Code compiled for the host uses much more stack than code compiled for a microcontroller. Context of each thread
+		(ucontext_t), stack frames of signal handlers and stack frames of C library functions are also stored on the
+		thread's stack. This value is added to stack size of each thread (including main thread), so that stack sizes
+		selected for microcontrollers can be used without changes."
+		OUTPUT_NAME CONFIG_ARCHITECTURE_STACK_OVERHEAD)
+
+distortosSetConfiguration(BOOLEAN
+		distortos_Architecture_01_Tickless_idle
+		ON
+		HELP "Enable tickless idle mode.
+
+		When idle thread is executed, periodic tick interrupt is replaced with a one-shot timer which expires at the
+		nearest event known to the scheduler - expiration of software timer or end of round-robin quantum of idle
+		thread. The process sleeps until this timer expires, instead of spinning in idle thread's loop. After wakeup
+		the tick count is advanced by the number of skipped ticks."
+		OUTPUT_NAME CONFIG_TICKLESS_IDLE_ENABLE)
+
+include("${CMAKE_CURRENT_SOURCE_DIR}/source/architecture/POSIX/distortos-sources.cmake")
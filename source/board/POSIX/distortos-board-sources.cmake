@@ -0,0 +1,21 @@
+#
+# file: distortos-board-sources.cmake
+#
+# author: Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+distortosSetConfiguration(STRING
+		CONFIG_BOARD
+		"POSIX"
+		INTERNAL)
+
+doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR})
+
+include(${CMAKE_CURRENT_LIST_DIR}/cmake/90-POSIX.cmake)
+
+include(${CMAKE_CURRENT_LIST_DIR}/distortos-board-sources.extension.cmake OPTIONAL)
+
+set(DISTORTOS_BOARD_VERSION 3)
@@ -72,6 +72,20 @@ distortosSetConfiguration(INTEGER
 		HardFault and NMI) are disabled during critical sections, so they may use system's functions."
 		OUTPUT_NAME CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI)
 
+distortosSetConfiguration(BOOLEAN
+		distortos_Architecture_02_Tickless_idle
+		OFF
+		HELP "Enable tickless idle mode.
+
+		When idle thread is executed, periodic tick interrupt of SysTick is replaced with a one-shot interrupt, which is
+		generated at the nearest event known to the scheduler - expiration of software timer or end of round-robin
+		quantum of idle thread. The core sleeps (WFI) until this interrupt or any other interrupt is generated, instead
+		of spinning in idle thread's loop. After wakeup the tick count is advanced by the number of skipped ticks.
+
+		Length of one-shot interval is limited by 24-bit counter of SysTick. SysTick is stopped for a few cycles
+		whenever it is reprogrammed, so tick clock lags behind real time by a small amount on each wakeup."
+		OUTPUT_NAME CONFIG_TICKLESS_IDLE_ENABLE)
+
 distortosSetConfiguration(STRING
 		distortos_Memory_regions_00_text_vectorTable
 		"flash"
@@ -14,17 +14,20 @@ doxygen(INPUT ${CMAKE_CURRENT_LIST_DIR}/fatalErrorHandler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/C-API
 		${CMAKE_CURRENT_LIST_DIR}/clocks
 		${CMAKE_CURRENT_LIST_DIR}/devices
+		${CMAKE_CURRENT_LIST_DIR}/executors
 		${CMAKE_CURRENT_LIST_DIR}/FileSystem
 		${CMAKE_CURRENT_LIST_DIR}/gcc
 		${CMAKE_CURRENT_LIST_DIR}/memory
 		${CMAKE_CURRENT_LIST_DIR}/newlib
 		${CMAKE_CURRENT_LIST_DIR}/scheduler
 		${CMAKE_CURRENT_LIST_DIR}/synchronization
-		${CMAKE_CURRENT_LIST_DIR}/threads)
+		${CMAKE_CURRENT_LIST_DIR}/threads
+		${CMAKE_CURRENT_LIST_DIR}/workQueues)
 
 include(${CMAKE_CURRENT_LIST_DIR}/C-API/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/clocks/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/devices/distortos-sources.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/executors/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/FileSystem/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/gcc/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/memory/distortos-sources.cmake)
@@ -32,3 +35,4 @@ include(${CMAKE_CURRENT_LIST_DIR}/newlib/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/scheduler/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/synchronization/distortos-sources.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/threads/distortos-sources.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/workQueues/distortos-sources.cmake)
@@ -0,0 +1,130 @@
+/**
+ * \file
+ * \brief Executor class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/Executor.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cassert>
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+Executor::~Executor()
+{
+	assert(activeTasks_ == 0 && "Tasks of executor are still active!");
+}
+
+int Executor::add(ExecutorTask& task)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (task.executor_ != nullptr)
+		return EBUSY;
+
+	task.executor_ = this;
+	task.resumePoint_ = {};
+	++activeTasks_;
+	makeReadyInternal(task);
+	return 0;
+}
+
+void Executor::run()
+{
+	while (1)
+	{
+		ExecutorTask* task {};
+		TickClock::time_point wakeUpTimePoint {};
+		bool sleeping {};
+
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+
+			const auto now = TickClock::now();
+			while (sleepingList_.empty() == false && sleepingList_.front().wakeUpTimePoint_ <= now)
+				makeReadyInternal(sleepingList_.front());
+
+			if (activeTasks_ == 0)
+				return;
+
+			if (readyList_.empty() == false)
+			{
+				task = &readyList_.front();
+				readyList_.pop_front();
+			}
+			else if (sleepingList_.empty() == false)
+			{
+				wakeUpTimePoint = sleepingList_.front().wakeUpTimePoint_;
+				sleeping = true;
+			}
+		}
+
+		if (task != nullptr)
+			resume(*task);
+		// only this thread puts tasks to sleep, so the earliest wake up time point cannot get any earlier
+		else if (sleeping == true)
+			semaphore_.tryWaitUntil(wakeUpTimePoint);
+		else
+			semaphore_.wait();
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void Executor::makeReadyInternal(ExecutorTask& task)
+{
+	if (task.node_.isLinked() == true)
+	{
+		if (task.sleeping_ == false)	// already ready?
+			return;
+
+		task.node_.unlink();
+		task.sleeping_ = false;
+	}
+
+	const auto wasEmpty = readyList_.empty();
+	readyList_.push_back(task);
+	// executor checks the list of ready tasks before it waits for the semaphore, so post is needed only for first task
+	if (wasEmpty == true)
+		semaphore_.post();
+}
+
+void Executor::resume(ExecutorTask& task)
+{
+	const auto finished = task.run();
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (finished == true)
+	{
+		task.detach();
+		if (task.node_.isLinked() == true)
+			task.node_.unlink();
+		task.sleeping_ = false;
+		task.resumePoint_ = {};
+		task.executor_ = {};
+		--activeTasks_;
+		return;
+	}
+
+	// task was suspended without any registration for resumption - it yielded or it awaits a plain condition
+	if (task.node_.isLinked() == false && task.isAttached() == false)
+		makeReadyInternal(task);
+}
+
+}	// namespace distortos
@@ -0,0 +1,152 @@
+/**
+ * \file
+ * \brief ExecutorTask class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/ExecutorTask.hpp"
+
+#include "distortos/devices/communication/SerialPort.hpp"
+
+#include "distortos/Executor.hpp"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cassert>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+ExecutorTask::~ExecutorTask()
+{
+	assert(executor_ == nullptr && "Executor task is still active!");
+}
+
+bool ExecutorTask::isActive() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return executor_ != nullptr;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| protected functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ExecutorTask::deadlineReached()
+{
+	if (TickClock::now() >= deadline_)
+		return true;
+
+	scheduleWakeUp(deadline_);
+	return false;
+}
+
+void ExecutorTask::finishAwait()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	detach();
+	if (node_.isLinked() == true)
+		node_.unlink();
+	sleeping_ = false;
+}
+
+bool ExecutorTask::pop(RawFifoQueue& rawFifoQueue, void* const buffer, const size_t size, int& ret)
+{
+	return tryOperation(rawFifoQueue.fifoQueueBase_.getPopSemaphore(),
+			[&rawFifoQueue, buffer, size]()
+			{
+				return rawFifoQueue.tryPop(buffer, size);
+			}, ret);
+}
+
+bool ExecutorTask::pop(RawMessageQueue& rawMessageQueue, uint8_t& priority, void* const buffer, const size_t size,
+		int& ret)
+{
+	return tryOperation(rawMessageQueue.messageQueueBase_.getPopSemaphore(),
+			[&rawMessageQueue, &priority, buffer, size]()
+			{
+				return rawMessageQueue.tryPop(priority, buffer, size);
+			}, ret);
+}
+
+bool ExecutorTask::push(RawFifoQueue& rawFifoQueue, const void* const data, const size_t size, int& ret)
+{
+	return tryOperation(rawFifoQueue.fifoQueueBase_.getPushSemaphore(),
+			[&rawFifoQueue, data, size]()
+			{
+				return rawFifoQueue.tryPush(data, size);
+			}, ret);
+}
+
+bool ExecutorTask::push(RawMessageQueue& rawMessageQueue, const uint8_t priority, const void* const data,
+		const size_t size, int& ret)
+{
+	return tryOperation(rawMessageQueue.messageQueueBase_.getPushSemaphore(),
+			[&rawMessageQueue, priority, data, size]()
+			{
+				return rawMessageQueue.tryPush(priority, data, size);
+			}, ret);
+}
+
+bool ExecutorTask::read(devices::SerialPort& serialPort, void* const buffer, const size_t size,
+		std::pair<int, size_t>& result)
+{
+	result = serialPort.read(buffer, size, 0);
+	if (result.first != EAGAIN)
+		return true;
+
+	// serial port gives no notification about data which was received without a blocking read, so poll it every tick
+	scheduleWakeUp(TickClock::now() + TickClock::duration{1});
+	return false;
+}
+
+void ExecutorTask::setDeadlineAfter(const TickClock::duration duration)
+{
+	deadline_ = TickClock::now() + duration + TickClock::duration{1};
+}
+
+bool ExecutorTask::wait(Semaphore& semaphore)
+{
+	return tryOperation(semaphore,
+			[&semaphore]()
+			{
+				return semaphore.tryWait();
+			});
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ExecutorTask::notify()
+{
+	executor_->makeReadyInternal(*this);
+}
+
+void ExecutorTask::scheduleWakeUp(const TickClock::time_point timePoint)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (node_.isLinked() == true)
+	{
+		if (sleeping_ == false || wakeUpTimePoint_ <= timePoint)	// already ready or scheduled earlier?
+			return;
+
+		node_.unlink();
+	}
+
+	wakeUpTimePoint_ = timePoint;
+	sleeping_ = true;
+	executor_->sleepingList_.insert(*this);
+}
+
+}	// namespace distortos
@@ -0,0 +1,32 @@
+/**
+ * \file
+ * \brief DynamicStackPool class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicStackPool.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+#include "distortos/internal/scheduler/DynamicThreadBase.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicStackPool::DynamicStackPool(const size_t stackSize, const size_t blocks) :
+		StackPool{{new uint8_t[getBlockStorageSize(internal::DynamicThreadBase::getStackPoolBlockSize(stackSize)) *
+				blocks], internal::storageDeleter<uint8_t>}, stackSize, blocks}
+{
+
+}
+
+}	// namespace distortos
@@ -0,0 +1,215 @@
+/**
+ * \file
+ * \brief MemoryPool class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/MemoryPool.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreTryWaitForFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/assert.h"
+#include "distortos/FATAL_ERROR.h"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+#if CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// value used to fill contents of allocated blocks
+constexpr uint8_t allocatedBlockPoison {0xcd};
+
+/// value used to fill contents of free blocks
+constexpr uint8_t freeBlockPoison {0xdd};
+
+#endif	// CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MemoryPool::MemoryPool(StorageUniquePointer&& storageUniquePointer, const size_t blockSize, const size_t blocks) :
+		semaphore_{static_cast<Semaphore::Value>(blocks), static_cast<Semaphore::Value>(blocks)},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		freeList_{},
+		allocatedBlocksMap_{},
+		blockSize_{blockSize},
+		blocks_{blocks},
+		usedBlocks_{},
+		maxUsedBlocks_{},
+		failures_{}
+{
+	const auto blockStorageSize = getBlockStorageSize(blockSize_);
+	const auto storage = static_cast<uint8_t*>(storageUniquePointer_.get());
+
+	// map of allocated blocks follows the blocks, initially all blocks are free
+	allocatedBlocksMap_ = reinterpret_cast<MapWord*>(storage + blockStorageSize * blocks_);
+	std::fill_n(allocatedBlocksMap_, (blocks_ + bitsPerMapWord - 1) / bitsPerMapWord, MapWord{});
+
+#if CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+	std::fill_n(storage, blockStorageSize * blocks_, freeBlockPoison);
+
+#endif	// CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+	// link the blocks in reverse order, so that the first block in the storage is the first free block
+	for (size_t i {blocks}; i > 0; --i)
+	{
+		const auto freeBlock = new (storage + (i - 1) * blockStorageSize) FreeBlock{freeList_};
+		freeList_ = freeBlock;
+	}
+}
+
+MemoryPool::~MemoryPool()
+{
+	assert(usedBlocks_ == 0 && "Blocks of memory pool are still in use!");
+}
+
+std::pair<int, void*> MemoryPool::allocate()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return allocateInternal(semaphoreWaitFunctor);
+}
+
+int MemoryPool::deallocate(void* const block)
+{
+	if (block == nullptr)
+		return EINVAL;
+
+	const auto blockStorageSize = getBlockStorageSize(blockSize_);
+	const auto blockAddress = reinterpret_cast<uintptr_t>(block);
+	const auto storageAddress = reinterpret_cast<uintptr_t>(storageUniquePointer_.get());
+	if (blockAddress < storageAddress || blockAddress - storageAddress >= blockStorageSize * blocks_ ||
+			(blockAddress - storageAddress) % blockStorageSize != 0)
+		return EINVAL;
+
+	const auto index = (blockAddress - storageAddress) / blockStorageSize;
+	auto& mapWord = allocatedBlocksMap_[index / bitsPerMapWord];
+	const auto mask = MapWord{1} << index % bitsPerMapWord;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		// block which is not allocated (for example already deallocated) is rejected before it is touched
+		if ((mapWord & mask) == 0)
+			return EINVAL;
+
+		// clearing the bit claims the block - it is not yet in the list of free blocks, so it cannot be allocated
+		// again, while another attempt to deallocate it will be rejected
+		mapWord &= ~mask;
+	}
+
+#if CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+	std::fill_n(static_cast<uint8_t*>(block), blockStorageSize, freeBlockPoison);
+
+#endif	// CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		const auto freeBlock = new (block) FreeBlock{freeList_};
+		freeList_ = freeBlock;
+		--usedBlocks_;
+	}
+
+	return semaphore_.post();
+}
+
+std::pair<int, void*> MemoryPool::tryAllocate()
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return allocateInternal(semaphoreTryWaitFunctor);
+}
+
+std::pair<int, void*> MemoryPool::tryAllocateFor(const TickClock::duration duration)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return allocateInternal(semaphoreTryWaitForFunctor);
+}
+
+std::pair<int, void*> MemoryPool::tryAllocateUntil(const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return allocateInternal(semaphoreTryWaitUntilFunctor);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, void*> MemoryPool::allocateInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor)
+{
+	const auto ret = waitSemaphoreFunctor(semaphore_);
+	if (ret != 0)
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+		++failures_;
+		return {ret, nullptr};
+	}
+
+	FreeBlock* freeBlock;
+
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+
+		// value of semaphore is never greater than the number of free blocks, so the list cannot be empty here
+		freeBlock = freeList_;
+		freeList_ = freeBlock->next;
+		const auto index = (reinterpret_cast<uintptr_t>(freeBlock) -
+				reinterpret_cast<uintptr_t>(storageUniquePointer_.get())) / getBlockStorageSize(blockSize_);
+		allocatedBlocksMap_[index / bitsPerMapWord] |= MapWord{1} << index % bitsPerMapWord;
+		++usedBlocks_;
+		if (usedBlocks_ > maxUsedBlocks_)
+			maxUsedBlocks_ = usedBlocks_;
+	}
+
+	const auto block = reinterpret_cast<uint8_t*>(freeBlock);
+
+#if CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+	const auto blockStorageSize = getBlockStorageSize(blockSize_);
+	const auto poisonBegin = block + sizeof(FreeBlock);
+	const auto poisonEnd = block + blockStorageSize;
+	if (std::all_of(poisonBegin, poisonEnd, [](const uint8_t value){ return value == freeBlockPoison; }) == false)
+		FATAL_ERROR("Block of memory pool was modified after it was deallocated!");
+
+	std::fill_n(block, blockStorageSize, allocatedBlockPoison);
+
+#endif	// CONFIG_MEMORY_POOL_POISONING_ENABLE == 1
+
+	return {{}, block};
+}
+
+}	// namespace distortos
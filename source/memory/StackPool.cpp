@@ -0,0 +1,121 @@
+/**
+ * \file
+ * \brief StackPool class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/StackPool.hpp"
+
+#include "distortos/internal/scheduler/DynamicThreadBase.hpp"
+
+#include "distortos/assert.h"
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <new>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets header of block.
+ *
+ * \param [in] block is a pointer to storage of block
+ *
+ * \return reference to header of \a block
+ */
+
+StackPool::BlockHeader& getBlockHeader(void* const block)
+{
+	return *reinterpret_cast<StackPool::BlockHeader*>(static_cast<uint8_t*>(block) - StackPool::blockHeaderSize);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+StackPool::StackPool(StorageUniquePointer&& storageUniquePointer, const size_t stackSize, const size_t blocks) :
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		freeList_{},
+		blockSize_{internal::DynamicThreadBase::getStackPoolBlockSize(stackSize)},
+		blocks_{blocks},
+		freeBlocks_{blocks},
+		stackSize_{stackSize}
+{
+	const auto blockStorageSize = getBlockStorageSize(blockSize_);
+	const auto storage = static_cast<uint8_t*>(storageUniquePointer_.get());
+	// link the blocks in reverse order, so that the first block in the storage is the first free block
+	for (size_t i {blocks}; i > 0; --i)
+	{
+		const auto blockHeader = new (storage + (i - 1) * blockStorageSize) BlockHeader{this, freeList_};
+		freeList_ = blockHeader;
+	}
+}
+
+StackPool::~StackPool()
+{
+	assert(freeBlocks_ == blocks_ && "Blocks of stack pool are still in use!");
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* StackPool::allocate()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (freeList_ == nullptr)
+		return nullptr;
+
+	const auto blockHeader = freeList_;
+	freeList_ = blockHeader->next;
+	--freeBlocks_;
+	blockHeader->owner = this;
+	return reinterpret_cast<uint8_t*>(blockHeader) + blockHeaderSize;
+}
+
+void* StackPool::allocateFromHeap(const size_t size)
+{
+	const auto storage = static_cast<uint8_t*>(::operator new(blockHeaderSize + size, std::nothrow));
+	if (storage == nullptr)
+		return nullptr;
+
+	new (storage) BlockHeader{nullptr, nullptr};
+	return storage + blockHeaderSize;
+}
+
+void StackPool::deallocate(void* const block)
+{
+	if (block == nullptr)
+		return;
+
+	auto& blockHeader = getBlockHeader(block);
+	const auto owner = blockHeader.owner;
+	if (owner == nullptr)	// block was allocated from the heap?
+	{
+		::operator delete(&blockHeader);
+		return;
+	}
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	blockHeader.next = owner->freeList_;
+	owner->freeList_ = &blockHeader;
+	++owner->freeBlocks_;
+}
+
+}	// namespace distortos
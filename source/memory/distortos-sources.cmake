@@ -9,4 +9,8 @@
 
 target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/DeferredThreadDeleter.cpp
-		${CMAKE_CURRENT_LIST_DIR}/getDeferredThreadDeleter.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/DynamicMemoryPool.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicStackPool.cpp
+		${CMAKE_CURRENT_LIST_DIR}/getDeferredThreadDeleter.cpp
+		${CMAKE_CURRENT_LIST_DIR}/MemoryPool.cpp
+		${CMAKE_CURRENT_LIST_DIR}/StackPool.cpp)
@@ -7,8 +7,12 @@
 # distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
 
-target_sources(distortos PRIVATE
-		${CMAKE_CURRENT_LIST_DIR}/assert_func.cpp
-		${CMAKE_CURRENT_LIST_DIR}/locking.cpp
-		${CMAKE_CURRENT_LIST_DIR}/sbrk_r.cpp
-		${CMAKE_CURRENT_LIST_DIR}/syscallsStubs.cpp)
+if(NOT CONFIG_ARCHITECTURE_POSIX)
+
+	target_sources(distortos PRIVATE
+			${CMAKE_CURRENT_LIST_DIR}/assert_func.cpp
+			${CMAKE_CURRENT_LIST_DIR}/locking.cpp
+			${CMAKE_CURRENT_LIST_DIR}/sbrk_r.cpp
+			${CMAKE_CURRENT_LIST_DIR}/syscallsStubs.cpp)
+
+endif()
@@ -15,6 +15,13 @@
 #include "distortos/BIND_LOW_LEVEL_INITIALIZER.h"
 #include "distortos/StaticThread.hpp"
 
+#if defined(CONFIG_TICKLESS_IDLE_ENABLE) || defined(CONFIG_RUN_TIME_STATISTICS_ENABLE)
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#endif	// defined(CONFIG_TICKLESS_IDLE_ENABLE) || defined(CONFIG_RUN_TIME_STATISTICS_ENABLE)
+
 namespace distortos
 {
 
@@ -53,17 +60,25 @@ std::aligned_storage<sizeof(IdleThread), alignof(IdleThread)>::type idleThreadSt
 
 void idleThreadFunction()
 {
-	volatile uint64_t i {};
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	getScheduler().registerIdleThread();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
 
 	while (1)
 	{
-		++i;
-
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 		getDeferredThreadDeleter().tryCleanup();	/// \todo error handling?
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+		getScheduler().ticklessIdle();
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
 	}
 }
 
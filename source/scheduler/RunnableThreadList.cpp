@@ -0,0 +1,86 @@
+/**
+ * \file
+ * \brief RunnableThreadList class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void RunnableThreadList::erase(const iterator position)
+{
+	auto& threadControlBlock = *position;
+	const size_t index = threadControlBlock.getList() - buckets_.data();
+	ThreadList::erase(position);
+
+	if (buckets_[index].empty() == false)
+		return;
+
+	auto& word = bitmap_[index / 32];
+	word &= ~(1u << index % 32);
+	if (word == 0)
+		summary_ &= ~(1u << index / 32);
+}
+
+void RunnableThreadList::insert(ThreadControlBlock& threadControlBlock, const bool front)
+{
+	const auto priority = threadControlBlock.getEffectivePriority();
+	const size_t index = priority / prioritiesPerBucket;
+	auto& bucket = buckets_[index];
+
+	auto position = front == true ? bucket.begin() : bucket.end();
+	if (threadControlBlock.getSchedulingPolicy() == SchedulingPolicy::earliestDeadlineFirst)
+	{
+		// thread is placed before threads with lower priority and before threads with equal priority which also use
+		// earliest-deadline-first scheduling policy, but have later deadline
+		const auto deadline = threadControlBlock.getDeadline();
+		position = std::find_if(bucket.begin(), bucket.end(),
+				[priority, deadline](const ThreadControlBlock& other)
+				{
+					return other.getEffectivePriority() < priority || (other.getEffectivePriority() == priority &&
+							other.getSchedulingPolicy() == SchedulingPolicy::earliestDeadlineFirst &&
+							other.getDeadline() > deadline);
+				});
+	}
+	else if (prioritiesPerBucket != 1)
+		position = std::find_if(bucket.begin(), bucket.end(),
+				[front, priority](const ThreadControlBlock& other)
+				{
+					return front == true ? other.getEffectivePriority() <= priority :
+							other.getEffectivePriority() < priority;
+				});
+
+	ThreadList::UnsortedIntrusiveList::splice(position, iterator{threadControlBlock});
+	threadControlBlock.setList(&bucket);
+
+	bitmap_[index / 32] |= 1u << index % 32;
+	summary_ |= 1u << index / 32;
+}
+
+void RunnableThreadList::reposition(const iterator position, const bool front)
+{
+	erase(position);
+	insert(*position, front);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -13,12 +13,30 @@
 
 #include "distortos/architecture/requestContextSwitch.hpp"
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/getCycleCountFrequency.hpp"
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "distortos/architecture/startTicklessIdle.hpp"
+#include "distortos/architecture/stopTicklessIdle.hpp"
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
-#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <algorithm>
 
 #include <cerrno>
 
@@ -80,6 +98,38 @@ private:
 	UnblockReason& unblockReason_;
 };
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration of CPU load window, ticks
+constexpr uint64_t cpuLoadWindowDuration {std::max<uint64_t>(static_cast<uint64_t>(CONFIG_CPU_LOAD_WINDOW_DURATION) *
+		CONFIG_TICK_FREQUENCY / 1000, 1)};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts number of cycles of architecture::getCycleCount() to nanoseconds.
+ *
+ * \param [in] cycles is the number of cycles that will be converted
+ *
+ * \return \a cycles converted to nanoseconds
+ */
+
+std::chrono::nanoseconds toNanoseconds(const uint64_t cycles)
+{
+	// integer and fractional parts of seconds are converted separately to prevent overflow
+	const auto frequency = architecture::getCycleCountFrequency();
+	return std::chrono::nanoseconds{static_cast<std::chrono::nanoseconds::rep>(cycles / frequency * 1000000000 +
+			cycles % frequency * 1000000000 / frequency)};
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -159,17 +209,10 @@ int Scheduler::blockUntil(ThreadList& container, const ThreadState state, const
 		return ETIMEDOUT;
 	}
 
-	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
-	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
-	// UnblockReason::timeout.
-	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
-			{
-				if (iterator->getList() != &runnableList_)
-					unblockInternal(iterator, UnblockReason::timeout);
-			});
-	softwareTimer.start(timePoint);
-
-	return block(container, state, unblockFunctor);
+	iterator->startTimeout(timePoint);
+	const auto ret = block(container, state, unblockFunctor);
+	iterator->cancelTimeout();
+	return ret;
 }
 
 uint64_t Scheduler::getContextSwitchCount() const
@@ -178,6 +221,39 @@ uint64_t Scheduler::getContextSwitchCount() const
 	return contextSwitchCount_;
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+uint16_t Scheduler::getCpuLoad() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return cpuLoad_;
+}
+
+std::chrono::nanoseconds Scheduler::getIdleTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return idleThreadControlBlock_ != nullptr ? getRunTime(*idleThreadControlBlock_) : std::chrono::nanoseconds{};
+}
+
+std::chrono::nanoseconds Scheduler::getInterruptTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return toNanoseconds(interruptRunTime_);
+}
+
+std::chrono::nanoseconds Scheduler::getRunTime(const ThreadControlBlock& threadControlBlock) const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto runTime = threadControlBlock.getRunTime();
+	if (&threadControlBlock == &getCurrentThreadControlBlock())
+		runTime += architecture::getCycleCount() - cycleCount_;
+
+	return toNanoseconds(runTime);
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 uint64_t Scheduler::getTickCount() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -192,6 +268,20 @@ int Scheduler::initialize(ThreadControlBlock& mainThreadControlBlock)
 
 	currentThreadControlBlock_ = runnableList_.begin();
 
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+	getCurrentThreadControlBlock().getStack().protectStackGuard();
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	cycleCount_ = architecture::getCycleCount();
+	cpuLoadWindowCycleCount_ = cycleCount_;
+	cpuLoadWindowEnd_ = tickCount_ + cpuLoadWindowDuration;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	return 0;
 }
 
@@ -201,6 +291,16 @@ void Scheduler::maybeRequestContextSwitch() const
 		architecture::requestContextSwitch();
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+void Scheduler::registerIdleThread()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	idleThreadControlBlock_ = &getCurrentThreadControlBlock();
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 int Scheduler::remove()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -215,6 +315,21 @@ int Scheduler::remove()
 	return 0;
 }
 
+void Scheduler::reposition(const ThreadList::iterator iterator, const bool loweringBefore)
+{
+	runnableList_.reposition(iterator, loweringBefore);
+}
+
+void Scheduler::requeue(ThreadList& container, const ThreadList::iterator iterator, const ThreadState state)
+{
+	auto& threadControlBlock = *iterator;
+	container.splice(iterator);
+	threadControlBlock.setList(&container);
+	threadControlBlock.setState(state);
+	threadControlBlock.cancelTimeout();
+	traceEvent(trace::EventType::block, &threadControlBlock, static_cast<uint16_t>(state));
+}
+
 int Scheduler::resume(const ThreadList::iterator iterator)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -242,6 +357,12 @@ void* Scheduler::switchContext(void* const stackPointer)
 {
 	++contextSwitchCount_;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	updateRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	auto& stack = getCurrentThreadControlBlock().getStack();
 
 #ifdef CONFIG_CHECK_STACK_GUARD_CONTEXT_SWITCH_ENABLE
@@ -253,7 +374,16 @@ void* Scheduler::switchContext(void* const stackPointer)
 
 	stack.setStackPointer(stackPointer);
 	currentThreadControlBlock_ = runnableList_.begin();
+	traceEvent(trace::EventType::contextSwitch, &getCurrentThreadControlBlock(),
+			getCurrentThreadControlBlock().getEffectivePriority());
 	getCurrentThreadControlBlock().switchedToHook();
+
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+	getCurrentThreadControlBlock().getStack().protectStackGuard();
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
 }
 
@@ -270,24 +400,99 @@ bool Scheduler::tickInterruptHandler()
 
 	++tickCount_;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	updateRunTime();
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
 	// if the object is on the "runnable" list, it uses SchedulingPolicy::roundRobin and it used its round-robin
 	// quantum, then do the "rotation": move current thread to the end of same-priority group to implement round-robin
 	// scheduling
-	if (getCurrentThreadControlBlock().getList() == &runnableList_ &&
+	if (getCurrentThreadControlBlock().getState() == ThreadState::runnable &&
 			getCurrentThreadControlBlock().getSchedulingPolicy() == SchedulingPolicy::roundRobin &&
 			getCurrentThreadControlBlock().getRoundRobinQuantum().isZero() == true)
 	{
 		getCurrentThreadControlBlock().getRoundRobinQuantum().reset();
-		runnableList_.splice(currentThreadControlBlock_);
+		runnableList_.reposition(currentThreadControlBlock_);
 	}
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	getCurrentThreadControlBlock().getThreadGroupControlBlock()->consumeBudget(
+			TickClock::time_point{TickClock::duration{tickCount_}});
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 	softwareTimerSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount_}});
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+	// time spent in this handler is not accounted to interrupted thread
+	const auto cycleCount = architecture::getCycleCount();
+	interruptRunTime_ += cycleCount - cycleCount_;
+	cycleCount_ = cycleCount;
+
+	if (tickCount_ >= cpuLoadWindowEnd_)
+	{
+		const auto idleRunTime = idleThreadControlBlock_ != nullptr ? idleThreadControlBlock_->getRunTime() : 0;
+		const auto windowCycles = cycleCount_ - cpuLoadWindowCycleCount_;
+		const auto idleCycles = idleRunTime - cpuLoadWindowIdleRunTime_;
+		cpuLoad_ = idleCycles < windowCycles ? 10000 - idleCycles * 10000 / windowCycles : 0;
+		cpuLoadWindowCycleCount_ = cycleCount_;
+		cpuLoadWindowIdleRunTime_ = idleRunTime;
+		cpuLoadWindowEnd_ = tickCount_ + cpuLoadWindowDuration;
+	}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 	return isContextSwitchRequired();
 }
 
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+void Scheduler::ticklessIdle()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (isContextSwitchRequired() == true)
+		return;
+
+	// timers left running by lazily cancelled timeouts would wake the core up before the real nearest event
+	while (staleTimeoutList_.empty() == false)
+		staleTimeoutList_.front().synchronizeTimeout();
+
+	const TickClock::time_point now {TickClock::duration{tickCount_}};
+	const auto nextTimePoint = softwareTimerSupervisor_.getNextTimePoint();
+	if (nextTimePoint <= now)
+		return;
+
+	uint64_t ticks = (nextTimePoint - now).count();
+
+	// end of round-robin quantum is an event only if there is another runnable thread with the same priority
+	auto& currentThreadControlBlock = getCurrentThreadControlBlock();
+	const auto nextThreadControlBlock = std::next(currentThreadControlBlock_);
+	if (currentThreadControlBlock.getSchedulingPolicy() == SchedulingPolicy::roundRobin &&
+			nextThreadControlBlock != currentThreadControlBlock.getList()->end() &&
+			nextThreadControlBlock->getEffectivePriority() == currentThreadControlBlock.getEffectivePriority())
+		ticks = std::min<uint64_t>(ticks, currentThreadControlBlock.getRoundRobinQuantum().get().count());
+
+	if (ticks <= 1)
+		return;
+
+	architecture::startTicklessIdle(ticks);
+	architecture::waitForInterrupt();
+	const auto elapsedTicks = architecture::stopTicklessIdle();
+
+	// tick interrupt generated by the one-shot timer (if any) is handled when interrupt masking is restored
+	tickCount_ += elapsedTicks;
+	currentThreadControlBlock.getRoundRobinQuantum().decrement(TickClock::duration{elapsedTicks});
+}
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 void Scheduler::unblock(const ThreadList::iterator iterator, const UnblockReason unblockReason)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -300,7 +505,7 @@ void Scheduler::yield()
 {
 	const InterruptMaskingLock interruptMaskingLock;
 
-	runnableList_.splice(currentThreadControlBlock_);
+	runnableList_.reposition(currentThreadControlBlock_);
 	maybeRequestContextSwitch();
 }
 
@@ -315,7 +520,6 @@ int Scheduler::addInternal(ThreadControlBlock& threadControlBlock)
 		return ret;
 
 	runnableList_.insert(threadControlBlock);
-	threadControlBlock.setList(&runnableList_);
 	threadControlBlock.setState(ThreadState::runnable);
 
 	return 0;
@@ -326,20 +530,22 @@ int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator i
 {
 	auto& threadControlBlock = *iterator;
 
-	if (threadControlBlock.getList() != &runnableList_)
+	if (threadControlBlock.getState() != ThreadState::runnable)
 		return EINVAL;
 
+	runnableList_.erase(iterator);
 	container.splice(iterator);
 	threadControlBlock.setList(&container);
 	threadControlBlock.setState(state);
 	threadControlBlock.blockHook(unblockFunctor);
+	traceEvent(trace::EventType::block, &threadControlBlock, static_cast<uint16_t>(state));
 
 	return 0;
 }
 
 bool Scheduler::isContextSwitchRequired() const
 {
-	if (getCurrentThreadControlBlock().getList() != &runnableList_)
+	if (getCurrentThreadControlBlock().getState() != ThreadState::runnable)
 		return true;
 
 	if (runnableList_.begin() != currentThreadControlBlock_)	// is there a higher-priority thread available?
@@ -352,11 +558,22 @@ void Scheduler::unblockInternal(const ThreadList::iterator iterator, const Unblo
 {
 	auto& threadControlBlock = *iterator;
 	runnableList_.splice(iterator);
-	threadControlBlock.setList(&runnableList_);
 	threadControlBlock.setState(ThreadState::runnable);
 	threadControlBlock.unblockHook(unblockReason);
+	traceEvent(trace::EventType::unblock, &threadControlBlock, static_cast<uint16_t>(unblockReason));
+}
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+void Scheduler::updateRunTime()
+{
+	const auto cycleCount = architecture::getCycleCount();
+	getCurrentThreadControlBlock().addRunTime(cycleCount - cycleCount_);
+	cycleCount_ = cycleCount;
 }
 
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
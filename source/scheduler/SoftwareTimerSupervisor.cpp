@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerSupervisor class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,7 @@
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
 #include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/InterruptMaskingLock.hpp"
 
@@ -27,21 +28,50 @@ namespace internal
 
 void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
 {
-	activeList_.insert(softwareTimerControlBlock);
+	activeTimers_.insert(softwareTimerControlBlock);
+}
+
+#ifdef CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	return activeTimers_.getNextTimePoint();
+}
+
+void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
+{
+	// execute all software timers that reached their time point
+	SoftwareTimerControlBlock* softwareTimer;
+	while ((softwareTimer = activeTimers_.pop(timePoint)) != nullptr)
+	{
+		traceEvent(trace::EventType::softwareTimerExpiry, softwareTimer);
+		softwareTimer->run(*this);
+	}
+}
+
+#else	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	const auto iterator = activeTimers_.begin();
+	return iterator != activeTimers_.end() ? iterator->getTimePoint() : TickClock::time_point::max();
 }
 
 void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
 	// execute all software timers that reached their time point
-	decltype(activeList_.begin()) iterator;
-	while (iterator = activeList_.begin(), iterator != activeList_.end() && iterator->getTimePoint() <= timePoint)
+	decltype(activeTimers_.begin()) iterator;
+	while (iterator = activeTimers_.begin(), iterator != activeTimers_.end() && iterator->getTimePoint() <= timePoint)
 	{
 		auto& softwareTimer = *iterator;
 		SoftwareTimerList::erase(iterator);
+		traceEvent(trace::EventType::softwareTimerExpiry, &softwareTimer);
 		softwareTimer.run(*this);
 	}
 }
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_WHEEL_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
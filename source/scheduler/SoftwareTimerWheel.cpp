@@ -0,0 +1,158 @@
+/**
+ * \file
+ * \brief SoftwareTimerWheel class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/SoftwareTimerWheel.hpp"
+
+#include "distortos/internal/scheduler/SoftwareTimerControlBlock.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TickClock::time_point SoftwareTimerWheel::getNextTimePoint() const
+{
+	if (expiredList_.empty() == false)
+		return expiredList_.front().getTimePoint();
+
+	size_t level;
+	const auto slot = findNextSlot(level);
+	if (slot == slotsPerLevel)
+		return TickClock::time_point::max();
+
+	// all timers in a slot of level 0 expire at the same tick, slots of other levels cover a range of ticks
+	if (level == 0)
+		return TickClock::time_point{TickClock::duration{static_cast<TickClock::rep>(getSlotTick(level, slot))}};
+
+	const auto& list = level < levelCount ? slots_[level][slot] : overflowList_;
+	return std::min_element(list.begin(), list.end(),
+			[](const SoftwareTimerControlBlock& left, const SoftwareTimerControlBlock& right)
+			{
+				return left.getTimePoint() < right.getTimePoint();
+			})->getTimePoint();
+}
+
+void SoftwareTimerWheel::insert(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	const auto timePoint = softwareTimerControlBlock.getTimePoint().time_since_epoch().count();
+	if (timePoint <= static_cast<TickClock::rep>(tick_))
+	{
+		expiredList_.push_back(softwareTimerControlBlock);
+		return;
+	}
+
+	// the most significant bit in which expiration time point differs from current time point selects the level
+	const auto tick = static_cast<uint64_t>(timePoint);
+	const size_t level = (63 - __builtin_clzll(tick ^ tick_)) / bitsPerLevel;
+	if (level >= levelCount)
+	{
+		overflowList_.push_back(softwareTimerControlBlock);
+		nextTick_ = std::min(nextTick_, getSlotTick(levelCount, {}));
+		return;
+	}
+
+	const size_t slot = (tick >> (bitsPerLevel * level)) % slotsPerLevel;
+	slots_[level][slot].push_back(softwareTimerControlBlock);
+	bitmaps_[level] |= 1u << slot;
+	nextTick_ = std::min(nextTick_, getSlotTick(level, slot));
+}
+
+SoftwareTimerControlBlock* SoftwareTimerWheel::pop(const TickClock::time_point timePoint)
+{
+	const auto limit = static_cast<uint64_t>(timePoint.time_since_epoch().count());
+
+	while (expiredList_.empty() == true)
+	{
+		if (nextTick_ > limit)
+		{
+			tick_ = std::max(tick_, limit);
+			return nullptr;
+		}
+
+		size_t level;
+		const auto slot = findNextSlot(level);
+		const auto tick = slot != slotsPerLevel ? getSlotTick(level, slot) : UINT64_MAX;
+		nextTick_ = tick;
+		if (tick > limit)
+			continue;
+
+		// advance to the beginning of the slot and cascade its timers - the ones which expire at this tick are moved
+		// to the list of expired timers, all others are moved to lower levels
+		tick_ = tick;
+		List list;
+		if (level < levelCount)
+		{
+			list.swap(slots_[level][slot]);
+			bitmaps_[level] &= ~(1u << slot);
+		}
+		else
+			list.swap(overflowList_);
+
+		while (list.empty() == false)
+		{
+			auto& softwareTimerControlBlock = list.front();
+			list.pop_front();
+			insert(softwareTimerControlBlock);
+		}
+
+		nextTick_ = tick_;	// force search for the next slot
+	}
+
+	auto& softwareTimerControlBlock = expiredList_.front();
+	expiredList_.pop_front();
+	return &softwareTimerControlBlock;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t SoftwareTimerWheel::findNextSlot(size_t& level) const
+{
+	// all timers in level n expire before all timers in level n + 1, and in each level only slots following the
+	// current one may be occupied
+	for (level = 0; level < levelCount; ++level)
+	{
+		const size_t currentSlot = (tick_ >> (bitsPerLevel * level)) % slotsPerLevel;
+		auto bitmap = currentSlot + 1 < slotsPerLevel ? bitmaps_[level] & (UINT32_MAX << (currentSlot + 1)) : 0;
+		while (bitmap != 0)
+		{
+			const size_t slot = __builtin_ctz(bitmap);
+			// bit in the bitmap is not cleared when the timer is stopped, so the slot may be empty
+			if (slots_[level][slot].empty() == false)
+				return slot;
+
+			bitmap &= bitmap - 1;
+		}
+	}
+
+	return overflowList_.empty() == false ? 0 : slotsPerLevel;
+}
+
+uint64_t SoftwareTimerWheel::getSlotTick(const size_t level, const size_t slot) const
+{
+	const auto shift = bitsPerLevel * level;
+	if (level == levelCount)	// overflow list is cascaded when the whole wheel wraps around
+		return ((tick_ >> shift) + 1) << shift;
+
+	return ((tick_ >> shift >> bitsPerLevel << bitsPerLevel) + slot) << shift;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
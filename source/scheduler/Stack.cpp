@@ -12,6 +12,7 @@
 #include "distortos/internal/scheduler/Stack.hpp"
 
 #include "distortos/architecture/initializeStack.hpp"
+#include "distortos/architecture/protectStackGuard.hpp"
 
 #include "distortos/internal/memory/dummyDeleter.hpp"
 
@@ -139,6 +140,20 @@ int Stack::initialize(RunnableThread& runnableThread)
 	return ret;
 }
 
+#ifdef CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
+void Stack::protectStackGuard() const
+{
+	// protected part must be aligned to its size - the highest such part is used, so that the unprotected part of
+	// "stack guard" between it and the stack is as small as possible
+	const auto stackGuardEnd = reinterpret_cast<uintptr_t>(adjustedStorage_) + stackGuardSize;
+	const auto protectedEnd = stackGuardEnd / stackGuardProtectionSize * stackGuardProtectionSize;
+	architecture::protectStackGuard(reinterpret_cast<void*>(protectedEnd - stackGuardProtectionSize),
+			stackGuardProtectionSize);
+}
+
+#endif	// def CONFIG_STACK_GUARD_PROTECTION_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -20,6 +20,7 @@
 
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/SignalsReceiver.hpp"
+#include "distortos/ThreadGroup.hpp"
 
 #include <cerrno>
 #include <cstring>
@@ -57,6 +58,11 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				list_{},
 				owner_{owner},
 				priorityInheritanceMutexControlBlock_{},
+				deadline_{TickClock::time_point::max()},
+				deadlineMissCount_{},
+				timeoutTimer_{*this},
+				timeoutTimerTimePoint_{},
+				timeoutTimePoint_{TickClock::time_point::max()},
 				signalsReceiverControlBlock_{signalsReceiver != nullptr ?
 						&signalsReceiver->signalsReceiverControlBlock_ : nullptr},
 				threadGroupControlBlock_{threadGroupControlBlock},
@@ -65,7 +71,13 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
 {
+#ifndef CONFIG_ARCHITECTURE_POSIX
 	_REENT_INIT_PTR(&reent_);
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+	runTime_ = {};
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
 
 	const InterruptMaskingLock interruptMaskingLock;
 	sequenceNumber_ = nextSequenceNumber++;
@@ -82,13 +94,24 @@ ThreadControlBlock::ThreadControlBlock(internal::Stack&& stack, const uint8_t pr
 				list_{},
 				owner_{owner},
 				priorityInheritanceMutexControlBlock_{},
+				deadline_{TickClock::time_point::max()},
+				deadlineMissCount_{},
+				timeoutTimer_{*this},
+				timeoutTimerTimePoint_{},
+				timeoutTimePoint_{TickClock::time_point::max()},
 				threadGroupControlBlock_{threadGroupControlBlock},
 				unblockFunctor_{},
 				roundRobinQuantum_{},
 				schedulingPolicy_{schedulingPolicy},
 				state_{ThreadState::created}
 {
+#ifndef CONFIG_ARCHITECTURE_POSIX
 	_REENT_INIT_PTR(&reent_);
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
+
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+	runTime_ = {};
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
 
 	const InterruptMaskingLock interruptMaskingLock;
 	sequenceNumber_ = nextSequenceNumber++;
@@ -100,9 +123,13 @@ ThreadControlBlock::~ThreadControlBlock()
 {
 	sequenceNumber_ = ~sequenceNumber_;
 
+#ifndef CONFIG_ARCHITECTURE_POSIX
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	_reclaim_reent(&reent_);
+
+#endif	// !def CONFIG_ARCHITECTURE_POSIX
 }
 
 int ThreadControlBlock::addHook()
@@ -119,6 +146,56 @@ int ThreadControlBlock::addHook()
 	return 0;
 }
 
+void ThreadControlBlock::cancelTimeout()
+{
+	timeoutTimePoint_ = TickClock::time_point::max();
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	if (timeoutTimer_.isRunning() == true)
+		getScheduler().addStaleTimeout(*this);
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+}
+
+void ThreadControlBlock::setDeadline(const TickClock::time_point deadline)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (deadline_ != TickClock::time_point::max() && TickClock::now() > deadline_)
+		++deadlineMissCount_;
+
+	deadline_ = deadline;
+
+	if (schedulingPolicy_ == SchedulingPolicy::earliestDeadlineFirst && state_ == ThreadState::runnable)
+	{
+		getScheduler().reposition(ThreadList::iterator{*this}, false);
+		getScheduler().maybeRequestContextSwitch();
+	}
+}
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+void ThreadControlBlock::setDemoted(const bool demoted)
+{
+	if (demoted_ == demoted)
+		return;
+
+	const auto previousEffectivePriority = getEffectivePriority();
+	demoted_ = demoted;
+
+	if (previousEffectivePriority == getEffectivePriority() || threadListNode.isLinked() == false)
+		return;
+
+	reposition(false);
+
+	if (priorityInheritanceMutexControlBlock_ != nullptr &&
+			priorityInheritanceMutexControlBlock_->updateBoostedPriority() == true)
+		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+}
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -137,7 +214,8 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 
 	reposition(loweringBefore);
 
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
+	if (priorityInheritanceMutexControlBlock_ != nullptr &&
+			priorityInheritanceMutexControlBlock_->updateBoostedPriority() == true)
 		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
 }
 
@@ -145,10 +223,70 @@ void ThreadControlBlock::setSchedulingPolicy(const SchedulingPolicy schedulingPo
 {
 	const InterruptMaskingLock interruptMaskingLock;
 
+	const auto earliestDeadlineFirst = schedulingPolicy_ == SchedulingPolicy::earliestDeadlineFirst ||
+			schedulingPolicy == SchedulingPolicy::earliestDeadlineFirst;
 	schedulingPolicy_ = schedulingPolicy;
 	roundRobinQuantum_.reset();
+
+	// order of threads using earliest-deadline-first scheduling policy depends on their deadlines
+	if (earliestDeadlineFirst == true && state_ == ThreadState::runnable)
+	{
+		getScheduler().reposition(ThreadList::iterator{*this}, false);
+		getScheduler().maybeRequestContextSwitch();
+	}
 }
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+void ThreadControlBlock::setThreadGroup(ThreadGroup& threadGroup)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	threadGroupControlBlock_ = &threadGroup.threadGroupControlBlock_;
+	threadGroupControlBlock_->add(*this);
+}
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+void ThreadControlBlock::startTimeout(const TickClock::time_point timePoint)
+{
+	timeoutTimePoint_ = timePoint;
+
+	// timer left running by lazily cancelled timeout will be restarted when it expires
+	if (timeoutTimer_.isRunning() == true && timeoutTimerTimePoint_ <= timePoint)
+		return;
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	staleTimeoutNode.unlink();
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+	timeoutTimerTimePoint_ = timePoint;
+	timeoutTimer_.start(timePoint);
+}
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+void ThreadControlBlock::synchronizeTimeout()
+{
+	staleTimeoutNode.unlink();
+
+	if (timeoutTimePoint_ == TickClock::time_point::max())	// timeout was cancelled?
+	{
+		timeoutTimer_.stop();
+		return;
+	}
+
+	if (timeoutTimePoint_ == timeoutTimerTimePoint_)
+		return;
+
+	timeoutTimerTimePoint_ = timeoutTimePoint_;
+	timeoutTimer_.start(timeoutTimePoint_);
+}
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
 void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
 {
 	roundRobinQuantum_.reset();
@@ -158,43 +296,77 @@ void ThreadControlBlock::unblockHook(const UnblockReason unblockReason)
 		(*unblockFunctor)(*this, unblockReason);
 }
 
-void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
+void ThreadControlBlock::updateBoostedPriority()
 {
-	decltype(boostedPriority_) newBoostedPriority {boostedPriority};
-
-	for (const auto& mutexControlBlock : ownedProtocolMutexList_)
+	// propagation along the chain of priority inheritance is done in a loop instead of recursion, so stack usage does
+	// not depend on the length of the chain
+	auto threadControlBlock = this;
+	do
 	{
-		const auto mutexBoostedPriority = mutexControlBlock.getBoostedPriority();
-		newBoostedPriority = std::max(newBoostedPriority, mutexBoostedPriority);
-	}
+		auto& ownedProtocolMutexList = threadControlBlock->ownedProtocolMutexList_;
+		// owned mutexes are sorted by their boosted priorities, so the first one has the highest
+		const auto newBoostedPriority = ownedProtocolMutexList.empty() == false ?
+				ownedProtocolMutexList.front().getBoostedPriority() : uint8_t{};
 
-	if (boostedPriority_ == newBoostedPriority)
-		return;
+		if (threadControlBlock->boostedPriority_ == newBoostedPriority)
+			return;
 
-	const auto oldEffectivePriority = getEffectivePriority();
-	boostedPriority_ = newBoostedPriority;
-	const auto newEffectivePriority = getEffectivePriority();
+		const auto oldEffectivePriority = threadControlBlock->getEffectivePriority();
+		threadControlBlock->boostedPriority_ = newBoostedPriority;
+		const auto newEffectivePriority = threadControlBlock->getEffectivePriority();
 
-	if (oldEffectivePriority == newEffectivePriority || threadListNode.isLinked() == false)
-		return;
+		if (oldEffectivePriority == newEffectivePriority || threadControlBlock->threadListNode.isLinked() == false)
+			return;
 
-	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
+		const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
 
-	reposition(loweringBefore);
+		threadControlBlock->reposition(loweringBefore);
 
-	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
-	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
-	// memory usage of threads.
-	if (priorityInheritanceMutexControlBlock_ != nullptr)
-		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
+		const auto priorityInheritanceMutexControlBlock = threadControlBlock->priorityInheritanceMutexControlBlock_;
+		if (priorityInheritanceMutexControlBlock == nullptr ||
+				priorityInheritanceMutexControlBlock->updateBoostedPriority() == false)
+			return;
+
+		threadControlBlock = priorityInheritanceMutexControlBlock->getOwner();
+	} while (1);
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void ThreadControlBlock::handleTimeout()
+{
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	staleTimeoutNode.unlink();
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+	if (timeoutTimePoint_ == TickClock::time_point::max())	// timeout was cancelled?
+		return;
+
+	if (timeoutTimePoint_ > timeoutTimerTimePoint_)	// timeout was started after the timer?
+	{
+		timeoutTimerTimePoint_ = timeoutTimePoint_;
+		timeoutTimer_.start(timeoutTimePoint_);
+		return;
+	}
+
+	// double unblock should be avoided (it could mess the order of threads of the same priority)
+	if (state_ != ThreadState::runnable)
+		getScheduler().unblock(ThreadList::iterator{*this}, UnblockReason::timeout);
+}
+
 void ThreadControlBlock::reposition(const bool loweringBefore)
 {
+	if (state_ == ThreadState::runnable)
+	{
+		getScheduler().reposition(ThreadList::iterator{*this}, loweringBefore);
+		getScheduler().maybeRequestContextSwitch();
+		return;
+	}
+
 	const auto oldPriority = priority_;
 
 	if (loweringBefore == true)
@@ -208,6 +380,11 @@ void ThreadControlBlock::reposition(const bool loweringBefore)
 	getScheduler().maybeRequestContextSwitch();
 }
 
+void ThreadControlBlock::TimeoutTimer::run()
+{
+	owner_.handleTimeout();
+}
+
 }	// namespace internal
 
 }	// namespace distortos
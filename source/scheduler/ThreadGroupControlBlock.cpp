@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadGroupControlBlock class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,14 @@
 
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 namespace distortos
 {
 
@@ -26,8 +34,88 @@ namespace internal
 void ThreadGroupControlBlock::add(ThreadControlBlock& threadControlBlock)
 {
 	threadList_.push_back(threadControlBlock);
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+	threadControlBlock.setDemoted(budget_ != TickClock::duration{} && remainingBudget_ == TickClock::duration{});
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+}
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+void ThreadGroupControlBlock::consumeBudget(const TickClock::time_point timePoint)
+{
+	if (budget_ == TickClock::duration{} || remainingBudget_ == TickClock::duration{})
+		return;
+
+	// consumption of full budget started in the tick which just ended - replenishment is scheduled one period later
+	if (remainingBudget_ == budget_)
+		replenishmentTimer_.start(timePoint - TickClock::duration{1} + period_);
+
+	--remainingBudget_;
+	if (remainingBudget_ != TickClock::duration{})
+		return;
+
+	++exhaustionCount_;
+	setDemoted(true);
+}
+
+uint32_t ThreadGroupControlBlock::getExhaustionCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return exhaustionCount_;
+}
+
+TickClock::duration ThreadGroupControlBlock::getRemainingBudget() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return remainingBudget_;
 }
 
+int ThreadGroupControlBlock::setBudget(const TickClock::duration budget, const TickClock::duration period)
+{
+	if (budget < TickClock::duration{} ||
+			(budget != TickClock::duration{} && (period <= TickClock::duration{} || budget > period)))
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	replenishmentTimer_.stop();
+	budget_ = budget;
+	period_ = period;
+	remainingBudget_ = budget;
+	setDemoted(false);
+	return 0;
+}
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+void ThreadGroupControlBlock::replenish()
+{
+	remainingBudget_ = budget_;
+	setDemoted(false);
+}
+
+void ThreadGroupControlBlock::setDemoted(const bool demoted)
+{
+	for (auto& threadControlBlock : threadList_)
+		threadControlBlock.setDemoted(demoted);
+}
+
+void ThreadGroupControlBlock::ReplenishmentTimer::run()
+{
+	owner_.replenish();
+}
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -14,12 +14,15 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/IdleThread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MainThread.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RoundRobinQuantum.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RunnableThreadList.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Scheduler.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerCommon.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerControlBlock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimer.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerSupervisor.cpp
+		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerWheel.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Stack.cpp
 		${CMAKE_CURRENT_LIST_DIR}/statistics.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadControlBlock.cpp
-		${CMAKE_CURRENT_LIST_DIR}/ThreadGroupControlBlock.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/ThreadGroupControlBlock.cpp
+		${CMAKE_CURRENT_LIST_DIR}/trace.cpp)
@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,25 @@ uint64_t getContextSwitchCount()
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+uint16_t getCpuLoad()
+{
+	return internal::getScheduler().getCpuLoad();
+}
+
+std::chrono::nanoseconds getIdleTime()
+{
+	return internal::getScheduler().getIdleTime();
+}
+
+std::chrono::nanoseconds getInterruptTime()
+{
+	return internal::getScheduler().getInterruptTime();
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 }	// namespace statistics
 
 }	// namespace distortos
@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \brief trace namespace implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#include "distortos/architecture/getCycleCount.hpp"
+#include "distortos/architecture/getCycleCountFrequency.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ring buffer with records
+std::array<trace::Record, CONFIG_TRACE_BUFFER_SIZE> records;
+
+/// total number of records written to ring buffer since last call to trace::clear()
+uint64_t recordCount;
+
+}	// namespace
+
+namespace trace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void clear()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	recordCount = {};
+}
+
+size_t dump(void* const buffer, const size_t size)
+{
+	if (size < sizeof(DumpHeader))
+		return {};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto availableRecords = std::min<uint64_t>(recordCount, records.size());
+	const auto dumpedRecords = std::min<uint64_t>(availableRecords, (size - sizeof(DumpHeader)) / sizeof(Record));
+
+	DumpHeader header {};
+	header.magic = dumpMagic;
+	header.version = dumpVersion;
+	header.recordSize = sizeof(Record);
+	header.recordCount = dumpedRecords;
+#if CONFIG_SIGNALS_ENABLE == 1
+	header.flags = DumpFlags::signalsEnabled;
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+	header.frequency = architecture::getCycleCountFrequency();
+	header.lostRecords = recordCount - dumpedRecords;
+	memcpy(buffer, &header, sizeof(header));
+
+	// newest records are dumped, oldest first - ring buffer may need to be copied in two chunks
+	auto output = static_cast<uint8_t*>(buffer) + sizeof(header);
+	auto index = (recordCount - dumpedRecords) % records.size();
+	auto remaining = dumpedRecords;
+	while (remaining != 0)
+	{
+		const auto chunk = std::min<uint64_t>(remaining, records.size() - index);
+		memcpy(output, &records[index], chunk * sizeof(Record));
+		output += chunk * sizeof(Record);
+		index = 0;
+		remaining -= chunk;
+	}
+
+	return output - static_cast<uint8_t*>(buffer);
+}
+
+void interruptEnter(const uint16_t number)
+{
+	internal::traceEvent(EventType::interruptEnter, {}, number);
+}
+
+void interruptExit(const uint16_t number)
+{
+	internal::traceEvent(EventType::interruptExit, {}, number);
+}
+
+}	// namespace trace
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void traceEvent(const trace::EventType type, const void* const object, const uint16_t argument)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto& record = records[recordCount % records.size()];
+	record.timestamp = architecture::getCycleCount();
+	record.object = reinterpret_cast<uintptr_t>(object);
+	record.argument = argument;
+	record.type = type;
+	record.reserved = {};
+	++recordCount;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TRACE_ENABLE
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -31,7 +31,7 @@ void ConditionVariable::notifyAll()
 	const InterruptMaskingLock interruptMaskingLock;
 
 	while (blockedList_.empty() == false)
-		internal::getScheduler().unblock(blockedList_.begin());
+		notifyFirst();
 }
 
 void ConditionVariable::notifyOne()
@@ -39,7 +39,7 @@ void ConditionVariable::notifyOne()
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (blockedList_.empty() == false)
-		internal::getScheduler().unblock(blockedList_.begin());
+		notifyFirst();
 }
 
 int ConditionVariable::wait(Mutex& mutex)
@@ -51,7 +51,16 @@ int ConditionVariable::wait(Mutex& mutex)
 		if (ret != 0)
 			return ret;
 
-		internal::getScheduler().block(blockedList_, ThreadState::blockedOnConditionVariable);
+		auto& scheduler = internal::getScheduler();
+		const auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+		// recursive mutex may still be locked by current thread, in that case lock is never passed to it
+		const auto unlocked = mutex.getOwner() != &currentThreadControlBlock;
+		mutex_ = blockedList_.empty() == true || mutex_ == &mutex ? &mutex : nullptr;
+
+		scheduler.block(blockedList_, ThreadState::blockedOnConditionVariable);
+
+		if (unlocked == true && mutex.getOwner() == &currentThreadControlBlock)	// lock passed by notify?
+			return 0;
 	}
 
 	return mutex.lock();
@@ -73,12 +82,33 @@ int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timeP
 		if (ret != 0)
 			return ret;
 
-		blockUntilRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnConditionVariable,
-				timePoint);
+		auto& scheduler = internal::getScheduler();
+		const auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+		// recursive mutex may still be locked by current thread, in that case lock is never passed to it
+		const auto unlocked = mutex.getOwner() != &currentThreadControlBlock;
+		mutex_ = blockedList_.empty() == true || mutex_ == &mutex ? &mutex : nullptr;
+
+		blockUntilRet = scheduler.blockUntil(blockedList_, ThreadState::blockedOnConditionVariable, timePoint);
+
+		if (unlocked == true && mutex.getOwner() == &currentThreadControlBlock)	// lock passed by notify?
+			return 0;
 	}
 
 	const auto ret = mutex.lock();
 	return ret != 0 ? ret : blockUntilRet != EINTR ? blockUntilRet : 0;	// don't return EINTR in case of spurious wakeup
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void ConditionVariable::notifyFirst()
+{
+	auto& threadControlBlock = blockedList_.front();
+	if (mutex_ != nullptr && mutex_->doTakeOverWaiter(threadControlBlock) == true)
+		return;
+
+	internal::getScheduler().unblock(blockedList_.begin());
+}
+
 }	// namespace distortos
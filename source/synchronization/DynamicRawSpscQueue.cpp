@@ -0,0 +1,31 @@
+/**
+ * \file
+ * \brief DynamicRawSpscQueue class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicRawSpscQueue.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicRawSpscQueue::DynamicRawSpscQueue(const size_t elementSize, const size_t queueSize,
+		const size_t wakeThreshold) :
+		RawSpscQueue{{new uint8_t[elementSize * queueSize], internal::storageDeleter<uint8_t>}, elementSize, queueSize,
+				wakeThreshold}
+{
+
+}
+
+}	// namespace distortos
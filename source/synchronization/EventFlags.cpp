@@ -0,0 +1,220 @@
+/**
+ * \file
+ * \brief EventFlags class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/EventFlags.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// EventFlagsWaitUnblockFunctor is a functor executed when unblocking a thread that is waiting for event flags
+class EventFlagsWaitUnblockFunctor : public internal::UnblockFunctor
+{
+public:
+
+	/**
+	 * \brief EventFlagsWaitUnblockFunctor's constructor
+	 *
+	 * \param [in] node is a reference to node of waiter on the list of waiters
+	 */
+
+	constexpr explicit EventFlagsWaitUnblockFunctor(estd::IntrusiveListNode& node) :
+			node_{node}
+	{
+
+	}
+
+	/**
+	 * \brief EventFlagsWaitUnblockFunctor's function call operator
+	 *
+	 * Unlinks the waiter from the list of waiters, so it will not be considered by EventFlags::set() when the thread is
+	 * unblocked for any other reason (timeout or signal).
+	 */
+
+	void operator()(internal::ThreadControlBlock&, internal::UnblockReason) const override
+	{
+		node_.unlink();
+	}
+
+private:
+
+	/// reference to node of waiter on the list of waiters
+	estd::IntrusiveListNode& node_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether wait is satisfied by given value of flags.
+ *
+ * \param [in] value is the value of flags
+ * \param [in] bitmask is the bitmask with flags that are waited for
+ * \param [in] waitMode is the mode of wait
+ *
+ * \return true if wait is satisfied, false otherwise
+ */
+
+bool isSatisfied(const EventFlags::Value value, const EventFlags::Value bitmask, const EventFlags::WaitMode waitMode)
+{
+	const auto all = waitMode == EventFlags::WaitMode::all || waitMode == EventFlags::WaitMode::allClear;
+	return all == true ? (value & bitmask) == bitmask : (value & bitmask) != 0;
+}
+
+/**
+ * \param [in] waitMode is the mode of wait
+ *
+ * \return true if flags should be cleared when the wait is satisfied, false otherwise
+ */
+
+bool isClearing(const EventFlags::WaitMode waitMode)
+{
+	return waitMode == EventFlags::WaitMode::anyClear || waitMode == EventFlags::WaitMode::allClear;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void EventFlags::attach(internal::SemaphoreObserver& observer)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	observer.detach();
+	observerList_.push_back(observer);
+}
+
+EventFlags::Value EventFlags::clear(const Value bitmask)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousValue = value_;
+	value_ &= ~bitmask;
+	return previousValue;
+}
+
+EventFlags::Value EventFlags::set(const Value bitmask)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousValue = value_;
+	value_ |= bitmask;
+
+	auto& scheduler = internal::getScheduler();
+	Value clearBitmask {};
+	auto iterator = waiterList_.begin();
+	while (iterator != waiterList_.end())
+	{
+		auto& waiter = *iterator;
+		++iterator;	// unblocking unlinks the waiter from the list
+
+		if (isSatisfied(value_, waiter.bitmask, waiter.waitMode) == false)
+			continue;
+
+		waiter.value = value_;
+		if (isClearing(waiter.waitMode) == true)
+			clearBitmask |= waiter.bitmask;
+		scheduler.unblock(internal::ThreadList::iterator{waiter.threadControlBlock});
+	}
+
+	value_ &= ~clearBitmask;
+
+	while (observerList_.empty() == false)
+	{
+		auto& observer = observerList_.front();
+		observerList_.pop_front();
+		observer.notify();
+	}
+
+	return previousValue;
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWait(const Value bitmask, const WaitMode waitMode)
+{
+	return waitImplementation(bitmask, waitMode, true, nullptr);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitFor(const TickClock::duration duration, const Value bitmask,
+		const WaitMode waitMode)
+{
+	return tryWaitUntil(TickClock::now() + duration + TickClock::duration{1}, bitmask, waitMode);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitUntil(const TickClock::time_point timePoint, const Value bitmask,
+		const WaitMode waitMode)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return waitImplementation(bitmask, waitMode, false, &timePoint);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::wait(const Value bitmask, const WaitMode waitMode)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return waitImplementation(bitmask, waitMode, false, nullptr);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, EventFlags::Value> EventFlags::waitImplementation(const Value bitmask, const WaitMode waitMode,
+		const bool nonBlocking, const TickClock::time_point* const timePoint)
+{
+	if (bitmask == 0)
+		return {EINVAL, value_};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (isSatisfied(value_, bitmask, waitMode) == true)
+	{
+		const auto value = value_;
+		if (isClearing(waitMode) == true)
+			value_ &= ~bitmask;
+		return {{}, value};
+	}
+
+	if (nonBlocking == true)
+		return {EAGAIN, value_};
+
+	auto& scheduler = internal::getScheduler();
+	Waiter waiter {scheduler.getCurrentThreadControlBlock(), bitmask, waitMode};
+	waiterList_.push_back(waiter);
+
+	internal::ThreadList waitingList;
+	const EventFlagsWaitUnblockFunctor eventFlagsWaitUnblockFunctor {waiter.node};
+	const auto ret = timePoint == nullptr ?
+			scheduler.block(waitingList, ThreadState::blockedOnEventFlags, &eventFlagsWaitUnblockFunctor) :
+			scheduler.blockUntil(waitingList, ThreadState::blockedOnEventFlags, *timePoint,
+					&eventFlagsWaitUnblockFunctor);
+	return {ret, ret == 0 ? waiter.value : value_};
+}
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,14 @@
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
 
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
 #include "distortos/InterruptMaskingLock.hpp"
 
+#include <algorithm>
+
+#include <cerrno>
+
 namespace distortos
 {
 
@@ -25,13 +31,17 @@ namespace internal
 
 FifoQueueBase::FifoQueueBase(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
 		const size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, static_cast<Semaphore::Value>(maxElements)},
+		pushSemaphore_{static_cast<Semaphore::Value>(maxElements), static_cast<Semaphore::Value>(maxElements)},
 		storageUniquePointer_{std::move(storageUniquePointer)},
 		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + elementSize * maxElements},
 		readPosition_{storageUniquePointer_.get()},
 		writePosition_{storageUniquePointer_.get()},
-		elementSize_{elementSize}
+		elementSize_{elementSize},
+		peekedSlots_{},
+		releasedSlots_{},
+		reservedSlots_{},
+		committedSlots_{}
 {
 
 }
@@ -41,10 +51,70 @@ FifoQueueBase::~FifoQueueBase()
 
 }
 
+int FifoQueueBase::commit()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = complete(popSemaphore_);
+	traceEvent(trace::EventType::queuePush, this, popSemaphore_.getValue());
+	return ret;
+}
+
+int FifoQueueBase::peek(const SemaphoreFunctor& waitSemaphoreFunctor, const void*& storage)
+{
+	void* slot {};
+	const auto ret = claim(waitSemaphoreFunctor, popSemaphore_, readPosition_, peekedSlots_, slot);
+	storage = slot;
+	return ret;
+}
+
+int FifoQueueBase::release()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = complete(pushSemaphore_);
+	traceEvent(trace::EventType::queuePop, this, popSemaphore_.getValue());
+	return ret;
+}
+
+int FifoQueueBase::reserve(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage)
+{
+	return claim(waitSemaphoreFunctor, pushSemaphore_, writePosition_, reservedSlots_, storage);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+int FifoQueueBase::claim(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore, void*& position,
+		size_t& pendingSlots, void*& storage)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return ret;
+
+	storage = position;
+
+	position = static_cast<uint8_t*>(position) + elementSize_;
+	if (position >= storageEnd_)
+		position = storageUniquePointer_.get();
+
+	++pendingSlots;
+	return 0;
+}
+
+int FifoQueueBase::complete(Semaphore& postSemaphore)
+{
+	auto& pendingSlots = &postSemaphore == &popSemaphore_ ? reservedSlots_ : peekedSlots_;
+	if (pendingSlots == 0)
+		return EPERM;
+
+	--pendingSlots;
+	return publish(postSemaphore, 1);
+}
+
 int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
 		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage)
 {
@@ -60,7 +130,75 @@ int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const Q
 	if (storage >= storageEnd_)
 		storage = storageUniquePointer_.get();
 
-	return postSemaphore.post();
+	const auto postRet = publish(postSemaphore, 1);
+	traceEvent(&waitSemaphore == &pushSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this,
+			popSemaphore_.getValue());
+	return postRet;
+}
+
+std::pair<int, size_t> FifoQueueBase::popPushMany(const SemaphoreFunctor& waitSemaphoreFunctor,
+		const BulkQueueFunctor& functor, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage,
+		const size_t count)
+{
+	if (count == 0)
+		return {{}, {}};
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return {ret, {}};
+
+	size_t transferred {1};
+	while (transferred < count && waitSemaphore.tryWait() == 0)
+		++transferred;
+
+	const auto storageBegin = storageUniquePointer_.get();
+	const size_t untilWrap = (static_cast<const uint8_t*>(storageEnd_) - static_cast<uint8_t*>(storage)) /
+			elementSize_;
+	const auto firstRun = std::min(transferred, untilWrap);
+	functor(storage, 0, firstRun);
+	if (firstRun != transferred)
+	{
+		functor(storageBegin, firstRun, transferred - firstRun);
+		storage = static_cast<uint8_t*>(storageBegin) + (transferred - firstRun) * elementSize_;
+	}
+	else
+	{
+		storage = static_cast<uint8_t*>(storage) + transferred * elementSize_;
+		if (storage >= storageEnd_)
+			storage = storageBegin;
+	}
+
+	const auto postRet = publish(postSemaphore, transferred);
+	traceEvent(&waitSemaphore == &pushSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this,
+			popSemaphore_.getValue());
+	return {postRet, transferred};
+}
+
+int FifoQueueBase::publish(Semaphore& postSemaphore, size_t count)
+{
+	const auto pendingSlots = &postSemaphore == &popSemaphore_ ? reservedSlots_ : peekedSlots_;
+	auto& completedSlots = &postSemaphore == &popSemaphore_ ? committedSlots_ : releasedSlots_;
+	// slots are published in order, so slots which follow a pending slot must wait until it is completed
+	if (pendingSlots != 0)
+	{
+		completedSlots += count;
+		return 0;
+	}
+
+	count += completedSlots;
+	completedSlots = 0;
+
+	int ret {};
+	for (size_t i {}; i < count; ++i)
+	{
+		const auto postRet = postSemaphore.post();
+		if (ret == 0)
+			ret = postRet;
+	}
+
+	return ret;
 }
 
 }	// namespace internal
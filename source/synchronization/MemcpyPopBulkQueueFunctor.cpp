@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief MemcpyPopBulkQueueFunctor class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/MemcpyPopBulkQueueFunctor.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MemcpyPopBulkQueueFunctor::operator()(void* const storage, const size_t index, const size_t count) const
+{
+	memcpy(static_cast<uint8_t*>(buffer_) + index * elementSize_, storage, count * elementSize_);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
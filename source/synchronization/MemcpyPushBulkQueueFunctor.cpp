@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief MemcpyPushBulkQueueFunctor class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/synchronization/MemcpyPushBulkQueueFunctor.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MemcpyPushBulkQueueFunctor::operator()(void* const storage, const size_t index, const size_t count) const
+{
+	memcpy(storage, static_cast<const uint8_t*>(data_) + index * elementSize_, count * elementSize_);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,12 @@
 
 #include "distortos/internal/synchronization/MessageQueueBase.hpp"
 
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
 #include "distortos/InterruptMaskingLock.hpp"
 
+#include <cerrno>
+
 namespace distortos
 {
 
@@ -49,7 +53,7 @@ public:
 	/**
 	 * \brief PushInternalFunctor's function call operator
 	 *
-	 * Gets oldest entry with highest priority from \a entryList, passes the storage to \a functor_ and splices this
+	 * Gets oldest entry with highest priority from \a entryList, passes the storage to \a functor_ and moves this
 	 * (now free) entry to \a freeEntryList.
 	 *
 	 * \param [in] entryList is a reference to EntryList of MessageQueueBase
@@ -59,12 +63,13 @@ public:
 	void operator()(MessageQueueBase::EntryList& entryList, MessageQueueBase::FreeEntryList& freeEntryList) const
 			override
 	{
-		const auto& entry = entryList.front();
+		auto& entry = entryList.front();
 		priority_ = entry.priority;
 
 		functor_(entry.storage);
 
-		MessageQueueBase::FreeEntryList::splice_after(freeEntryList.before_begin(), entryList.before_begin());
+		entryList.pop_front();
+		freeEntryList.push_front(entry);
 	}
 
 private:
@@ -99,7 +104,7 @@ public:
 	/**
 	 * \brief PushInternalFunctor's function call operator
 	 *
-	 * Gets one entry from \a freeEntryList, passes the storage to \a functor_ and splices this entry to \a entryList.
+	 * Gets one entry from \a freeEntryList, passes the storage to \a functor_ and moves this entry to \a entryList.
 	 *
 	 * \param [in] entryList is a reference to EntryList of MessageQueueBase
 	 * \param [in] freeEntryList is a reference to FreeEntryList of MessageQueueBase
@@ -114,7 +119,8 @@ public:
 
 		functor_(entry.storage);
 
-		entryList.splice_after(freeEntryList.before_begin());
+		freeEntryList.pop_front();
+		entryList.insert(entry);
 	}
 
 private:
@@ -128,18 +134,79 @@ private:
 
 }	// namespace
 
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BUCKETS_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void MessageQueueBase::EntryList::insert(Entry& entry)
+{
+	const auto priority = entry.priority;
+	auto& tail = tails_[priority];
+	const auto previous = tail != nullptr ? tail : findHigherTail(priority);
+	using Iterator = decltype(list_)::iterator;
+	list_.insert_after(previous != nullptr ? Iterator{*previous} : list_.before_begin(), entry);
+	tail = &entry;
+
+	const auto word = priority / 32;
+	bitmap_[word] |= 1u << priority % 32;
+	summary_ |= 1u << word;
+}
+
+void MessageQueueBase::EntryList::pop_front()
+{
+	auto& entry = list_.front();
+	list_.pop_front();
+
+	const auto priority = entry.priority;
+	auto& tail = tails_[priority];
+	if (tail != &entry)	// bucket is not empty yet
+		return;
+
+	tail = {};
+	const auto word = priority / 32;
+	bitmap_[word] &= ~(1u << priority % 32);
+	if (bitmap_[word] == 0)
+		summary_ &= ~(1u << word);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MessageQueueBase::Entry* MessageQueueBase::EntryList::findHigherTail(const uint8_t priority) const
+{
+	// masks with all bits above given bit set - for bit 31 the shift wraps to 0, so the mask is also 0
+	const auto word = priority / 32;
+	const auto bitmapWord = bitmap_[word] & ~((2u << priority % 32) - 1);
+	if (bitmapWord != 0)
+		return tails_[word * 32 + __builtin_ctz(bitmapWord)];
+
+	const auto summary = summary_ & ~((2u << word) - 1);
+	if (summary == 0)
+		return {};
+
+	const auto higherWord = __builtin_ctz(summary);
+	return tails_[higherWord * 32 + __builtin_ctz(bitmap_[higherWord])];
+}
+
+#endif	// def CONFIG_MESSAGE_QUEUE_PRIORITY_BUCKETS_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
 MessageQueueBase::MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
 		ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, static_cast<Semaphore::Value>(maxElements)},
+		pushSemaphore_{static_cast<Semaphore::Value>(maxElements), static_cast<Semaphore::Value>(maxElements)},
 		entryStorageUniquePointer_{std::move(entryStorageUniquePointer)},
 		valueStorageUniquePointer_{std::move(valueStorageUniquePointer)},
 		entryList_{},
-		freeEntryList_{}
+		freeEntryList_{},
+		elementSize_{elementSize},
+		maxElements_{maxElements}
 {
 	for (size_t i = 0; i < maxElements; ++i)
 	{
@@ -154,6 +221,42 @@ MessageQueueBase::~MessageQueueBase()
 
 }
 
+int MessageQueueBase::commit(const uint8_t priority, void* const storage)
+{
+	const auto entry = getEntry(storage);
+	if (entry == nullptr)
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (entry->access != Entry::Access::reserved)
+		return EPERM;
+
+	entry->access = Entry::Access::none;
+	entry->priority = priority;
+	entryList_.insert(*entry);
+
+	const auto ret = popSemaphore_.post();
+	traceEvent(trace::EventType::queuePush, this, popSemaphore_.getValue());
+	return ret;
+}
+
+int MessageQueueBase::peek(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const void*& storage)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(popSemaphore_);
+	if (ret != 0)
+		return ret;
+
+	auto& entry = entryList_.front();
+	entry.access = Entry::Access::peeked;
+	priority = entry.priority;
+	storage = entry.storage;
+	entryList_.pop_front();
+	return 0;
+}
+
 int MessageQueueBase::pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const QueueFunctor& functor)
 {
 	const PopInternalFunctor popInternalFunctor {priority, functor};
@@ -167,10 +270,58 @@ int MessageQueueBase::push(const SemaphoreFunctor& waitSemaphoreFunctor, const u
 	return popPush(waitSemaphoreFunctor, pushInternalFunctor, pushSemaphore_, popSemaphore_);
 }
 
+int MessageQueueBase::release(const void* const storage)
+{
+	const auto entry = getEntry(storage);
+	if (entry == nullptr)
+		return EINVAL;
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (entry->access != Entry::Access::peeked)
+		return EPERM;
+
+	entry->access = Entry::Access::none;
+	freeEntryList_.push_front(*entry);
+
+	const auto ret = pushSemaphore_.post();
+	traceEvent(trace::EventType::queuePop, this, popSemaphore_.getValue());
+	return ret;
+}
+
+int MessageQueueBase::reserve(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(pushSemaphore_);
+	if (ret != 0)
+		return ret;
+
+	auto& entry = freeEntryList_.front();
+	entry.access = Entry::Access::reserved;
+	storage = entry.storage;
+	freeEntryList_.pop_front();
+	return 0;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+MessageQueueBase::Entry* MessageQueueBase::getEntry(const void* const storage) const
+{
+	const auto address = reinterpret_cast<uintptr_t>(storage);
+	const auto begin = reinterpret_cast<uintptr_t>(valueStorageUniquePointer_.get());
+	if (address < begin || (address - begin) % elementSize_ != 0)
+		return {};
+
+	const auto index = (address - begin) / elementSize_;
+	if (index >= maxElements_)
+		return {};
+
+	return reinterpret_cast<Entry*>(&entryStorageUniquePointer_[index]);
+}
+
 int MessageQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const InternalFunctor& internalFunctor,
 		Semaphore& waitSemaphore, Semaphore& postSemaphore)
 {
@@ -182,7 +333,10 @@ int MessageQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, cons
 
 	internalFunctor(entryList_, freeEntryList_);
 
-	return postSemaphore.post();
+	const auto postRet = postSemaphore.post();
+	traceEvent(&waitSemaphore == &pushSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this,
+			popSemaphore_.getValue());
+	return postRet;
 }
 
 }	// namespace internal
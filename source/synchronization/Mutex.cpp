@@ -2,7 +2,7 @@
  * \file
  * \brief Mutex class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -29,6 +29,11 @@ namespace distortos
 
 int Mutex::lock()
 {
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryLockFast(internal::getScheduler().getCurrentThreadControlBlock()) == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -41,6 +46,11 @@ int Mutex::lock()
 
 int Mutex::tryLock()
 {
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryLockFast(internal::getScheduler().getCurrentThreadControlBlock()) == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 	const auto ret = tryLockInternal();
 	return ret != EDEADLK ? ret : EBUSY;
@@ -53,6 +63,11 @@ int Mutex::tryLockFor(const TickClock::duration duration)
 
 int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 {
+	CHECK_FUNCTION_CONTEXT();
+
+	if (tryLockFast(internal::getScheduler().getCurrentThreadControlBlock()) == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -68,6 +83,9 @@ int Mutex::unlock()
 {
 	CHECK_FUNCTION_CONTEXT();
 
+	if (tryUnlockFast(internal::getScheduler().getCurrentThreadControlBlock()) == true)
+		return 0;
+
 	const InterruptMaskingLock interruptMaskingLock;
 
 	if (getType() != Type::normal)
@@ -93,8 +111,6 @@ int Mutex::unlock()
 
 int Mutex::tryLockInternal()
 {
-	CHECK_FUNCTION_CONTEXT();
-
 	if (getProtocol() == Protocol::priorityProtect &&
 			internal::getScheduler().getCurrentThreadControlBlock().getPriority() > getPriorityCeiling())
 		return EINVAL;
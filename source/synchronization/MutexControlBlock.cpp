@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,10 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
+#include <algorithm>
+#include <iterator>
 
 namespace distortos
 {
@@ -39,7 +43,7 @@ public:
 	 * \param [in] mutexControlBlock is a reference to MutexControlBlock that blocked the thread
 	 */
 
-	constexpr explicit PriorityInheritanceMutexControlBlockUnblockFunctor(const MutexControlBlock& mutexControlBlock) :
+	constexpr explicit PriorityInheritanceMutexControlBlockUnblockFunctor(MutexControlBlock& mutexControlBlock) :
 			mutexControlBlock_{mutexControlBlock}
 	{
 
@@ -48,8 +52,9 @@ public:
 	/**
 	 * \brief PriorityInheritanceMutexControlBlockUnblockFunctor's function call operator
 	 *
-	 * If the wait for mutex was interrupted, requests update of boosted priority of current owner of the mutex. Pointer
-	 * to MutexControlBlock with priorityInheritance protocol which caused the thread to block is reset to nullptr.
+	 * If the wait for mutex was interrupted, requests update of boosted priority of the mutex and of its current owner.
+	 * Pointer to MutexControlBlock with priorityInheritance protocol which caused the thread to block is reset to
+	 * nullptr.
 	 *
 	 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
 	 * \param [in] unblockReason is the reason of thread unblocking
@@ -57,11 +62,9 @@ public:
 
 	void operator()(ThreadControlBlock& threadControlBlock, const UnblockReason unblockReason) const override
 	{
-		const auto owner = mutexControlBlock_.getOwner();
-
-		// waiting for mutex was interrupted and some thread still holds it?
-		if (unblockReason != UnblockReason::unblockRequest && owner != nullptr)
-			owner->updateBoostedPriority();
+		// waiting for mutex was interrupted and boosted priority of some thread which still holds it must be updated?
+		if (unblockReason != UnblockReason::unblockRequest && mutexControlBlock_.updateBoostedPriority() == true)
+			mutexControlBlock_.getOwner()->updateBoostedPriority();
 
 		threadControlBlock.setPriorityInheritanceMutexControlBlock(nullptr);
 	}
@@ -69,7 +72,7 @@ public:
 private:
 
 	/// reference to MutexControlBlock that blocked the thread
-	const MutexControlBlock& mutexControlBlock_;
+	MutexControlBlock& mutexControlBlock_;
 };
 
 }	// namespace
@@ -78,19 +81,20 @@ private:
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-uint8_t MutexControlBlock::getBoostedPriority() const
+bool MutexControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 {
-	if (getProtocol() == Protocol::priorityInheritance)
-	{
-		if (blockedList_.empty() == true)
-			return 0;
-		return blockedList_.front().getEffectivePriority();
-	}
+	const auto newBoostedPriority = std::max(boostedPriority,
+			blockedList_.empty() == false ? blockedList_.front().getEffectivePriority() : uint8_t{});
+	if (boostedPriority_ == newBoostedPriority)
+		return false;
 
-	if (getProtocol() == Protocol::priorityProtect)
-		return getPriorityCeiling();
+	boostedPriority_ = newBoostedPriority;
 
-	return 0;
+	if (getOwner() == nullptr)
+		return false;
+
+	repositionInOwnerList();
+	return true;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -118,17 +122,41 @@ int MutexControlBlock::doBlockUntil(const TickClock::time_point timePoint)
 void MutexControlBlock::doLock()
 {
 	auto& scheduler = getScheduler();
-	owner_ = &scheduler.getCurrentThreadControlBlock();
+	setOwner(&scheduler.getCurrentThreadControlBlock(), false);
+	traceEvent(trace::EventType::mutexLock, this);
 
 	if (getProtocol() == Protocol::none)
 		return;
 
-	getOwner()->getOwnedProtocolMutexList().push_front(*this);
+	repositionInOwnerList();
 
 	if (getProtocol() == Protocol::priorityProtect)
 		getOwner()->updateBoostedPriority();
 }
 
+bool MutexControlBlock::doTakeOverWaiter(ThreadControlBlock& threadControlBlock)
+{
+	const auto owner = getOwner();
+	// recursive mutex may be still locked by the thread which waits for condition variable
+	if (getProtocol() != Protocol::none || owner == &threadControlBlock)
+		return false;
+
+	auto& scheduler = getScheduler();
+	const ThreadList::iterator iterator {threadControlBlock};
+
+	if (owner == nullptr)
+	{
+		setOwner(&threadControlBlock, false);
+		traceEvent(trace::EventType::mutexLock, this);
+		scheduler.unblock(iterator);
+		return true;
+	}
+
+	setOwner(owner, true);
+	scheduler.requeue(blockedList_, iterator, ThreadState::blockedOnMutex);
+	return true;
+}
+
 void MutexControlBlock::doUnlockOrTransferLock()
 {
 	auto& oldOwner = *getOwner();
@@ -153,8 +181,10 @@ void MutexControlBlock::doUnlockOrTransferLock()
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-void MutexControlBlock::beforeBlock() const
+void MutexControlBlock::beforeBlock()
 {
+	setOwner(getOwner(), true);
+
 	if (getProtocol() != Protocol::priorityInheritance)
 		return;
 
@@ -163,26 +193,41 @@ void MutexControlBlock::beforeBlock() const
 	currentThreadControlBlock.setPriorityInheritanceMutexControlBlock(this);
 
 	// calling thread is not yet on the blocked list, that's why it's effective priority is given explicitly
-	getOwner()->updateBoostedPriority(currentThreadControlBlock.getEffectivePriority());
+	if (updateBoostedPriority(currentThreadControlBlock.getEffectivePriority()) == true)
+		getOwner()->updateBoostedPriority();
 }
 
 void MutexControlBlock::doTransferLock()
 {
-	owner_ = &blockedList_.front();	// pass ownership to the unblocked thread
+	auto& newOwner = blockedList_.front();
+	setOwner(&newOwner, true);	// pass ownership to the unblocked thread
+	traceEvent(trace::EventType::mutexTransfer, this);
+
+	// mutex is still on the list of previous owner, its position there is meaningless for the new owner
+	if (getProtocol() != Protocol::none)
+		node.unlink();
+
 	getScheduler().unblock(blockedList_.begin());
 
-	if (node.isLinked() == false)
-		return;
+	if (blockedList_.empty() == true)
+		setOwner(&newOwner, false);
 
-	MutexList::splice(getOwner()->getOwnedProtocolMutexList().begin(), MutexList::iterator{*this});
+	if (getProtocol() == Protocol::none)
+		return;
 
 	if (getProtocol() == Protocol::priorityInheritance)
+	{
+		boostedPriority_ = blockedList_.empty() == false ? blockedList_.front().getEffectivePriority() : uint8_t{};
 		getOwner()->setPriorityInheritanceMutexControlBlock(nullptr);
+	}
+
+	repositionInOwnerList();
 }
 
 void MutexControlBlock::doUnlock()
 {
-	owner_ = nullptr;
+	setOwner(nullptr, false);
+	traceEvent(trace::EventType::mutexUnlock, this);
 
 	if (node.isLinked() == false)
 		return;
@@ -190,6 +235,47 @@ void MutexControlBlock::doUnlock()
 	node.unlink();
 }
 
+void MutexControlBlock::repositionInOwnerList()
+{
+	auto& ownedProtocolMutexList = getOwner()->getOwnedProtocolMutexList();
+	const auto begin = ownedProtocolMutexList.begin();
+	const auto end = ownedProtocolMutexList.end();
+	const MutexList::iterator iterator {*this};
+
+	// mutex without boost can always be placed at the end, this also avoids searching in the most common case of
+	// locking of a mutex with priorityInheritance protocol
+	if (boostedPriority_ == 0)
+	{
+		MutexList::splice(end, iterator);
+		return;
+	}
+
+	// mutex which is not on the list starts at the end, mutex which is on the list starts at its current position - it
+	// is moved towards the end past all mutexes with higher boost...
+	auto position = end;
+	if (node.isLinked() == true)
+	{
+		position = std::next(iterator);
+		while (position != end && position->getBoostedPriority() > boostedPriority_)
+			++position;
+
+		if (position != std::next(iterator))
+		{
+			MutexList::splice(position, iterator);
+			return;
+		}
+
+		position = iterator;
+	}
+
+	// ... or towards the beginning past all mutexes with equal or lower boost, so the cost is the distance moved
+	while (position != begin && std::prev(position)->getBoostedPriority() <= boostedPriority_)
+		--position;
+
+	if (position != iterator)
+		MutexList::splice(position, iterator);
+}
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class implementation
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,7 +11,9 @@
 
 #include "distortos/RawFifoQueue.hpp"
 
+#include "distortos/internal/synchronization/MemcpyPopBulkQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
+#include "distortos/internal/synchronization/MemcpyPushBulkQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
@@ -37,6 +39,19 @@ RawFifoQueue::RawFifoQueue(StorageUniquePointer&& storageUniquePointer, const si
 
 }
 
+int RawFifoQueue::commit()
+{
+	return fifoQueueBase_.commit();
+}
+
+int RawFifoQueue::peek(const void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.peek(semaphoreWaitFunctor, storage);
+}
+
 int RawFifoQueue::pop(void* const buffer, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -45,6 +60,14 @@ int RawFifoQueue::pop(void* const buffer, const size_t size)
 	return popInternal(semaphoreWaitFunctor, buffer, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::popMany(void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popManyInternal(semaphoreWaitFunctor, buffer, size);
+}
+
 int RawFifoQueue::push(const void* const data, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -53,6 +76,49 @@ int RawFifoQueue::push(const void* const data, const size_t size)
 	return pushInternal(semaphoreWaitFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::pushMany(const void* const data, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushManyInternal(semaphoreWaitFunctor, data, size);
+}
+
+int RawFifoQueue::release()
+{
+	return fifoQueueBase_.release();
+}
+
+int RawFifoQueue::reserve(void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.reserve(semaphoreWaitFunctor, storage);
+}
+
+int RawFifoQueue::tryPeek(const void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.peek(semaphoreTryWaitFunctor, storage);
+}
+
+int RawFifoQueue::tryPeekFor(const TickClock::duration duration, const void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.peek(semaphoreTryWaitForFunctor, storage);
+}
+
+int RawFifoQueue::tryPeekUntil(const TickClock::time_point timePoint, const void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.peek(semaphoreTryWaitUntilFunctor, storage);
+}
+
 int RawFifoQueue::tryPop(void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -67,6 +133,30 @@ int RawFifoQueue::tryPopFor(const TickClock::duration duration, void* const buff
 	return popInternal(semaphoreTryWaitForFunctor, buffer, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::tryPopMany(void* const buffer, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popManyInternal(semaphoreTryWaitFunctor, buffer, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopManyFor(const TickClock::duration duration, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popManyInternal(semaphoreTryWaitForFunctor, buffer, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPopManyUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popManyInternal(semaphoreTryWaitUntilFunctor, buffer, size);
+}
+
 int RawFifoQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -89,6 +179,30 @@ int RawFifoQueue::tryPushFor(const TickClock::duration duration, const void* con
 	return pushInternal(semaphoreTryWaitForFunctor, data, size);
 }
 
+std::pair<int, size_t> RawFifoQueue::tryPushMany(const void* const data, const size_t size)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushManyInternal(semaphoreTryWaitFunctor, data, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushManyFor(const TickClock::duration duration, const void* const data,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return pushManyInternal(semaphoreTryWaitForFunctor, data, size);
+}
+
+std::pair<int, size_t> RawFifoQueue::tryPushManyUntil(const TickClock::time_point timePoint, const void* const data,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushManyInternal(semaphoreTryWaitUntilFunctor, data, size);
+}
+
 int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void* const data, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -97,6 +211,28 @@ int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void
 	return pushInternal(semaphoreTryWaitUntilFunctor, data, size);
 }
 
+int RawFifoQueue::tryReserve(void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.reserve(semaphoreTryWaitFunctor, storage);
+}
+
+int RawFifoQueue::tryReserveFor(const TickClock::duration duration, void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.reserve(semaphoreTryWaitForFunctor, storage);
+}
+
+int RawFifoQueue::tryReserveUntil(const TickClock::time_point timePoint, void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.reserve(semaphoreTryWaitUntilFunctor, storage);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -111,6 +247,17 @@ int RawFifoQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, memcpyPopQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::popManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t size)
+{
+	const auto elementSize = fifoQueueBase_.getElementSize();
+	if (size % elementSize != 0)
+		return {EMSGSIZE, {}};
+
+	const internal::MemcpyPopBulkQueueFunctor memcpyPopBulkQueueFunctor {buffer, elementSize};
+	return fifoQueueBase_.popMany(waitSemaphoreFunctor, memcpyPopBulkQueueFunctor, size / elementSize);
+}
+
 int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* const data,
 		const size_t size)
 {
@@ -121,4 +268,15 @@ int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, memcpyPushQueueFunctor);
 }
 
+std::pair<int, size_t> RawFifoQueue::pushManyInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		const void* const data, const size_t size)
+{
+	const auto elementSize = fifoQueueBase_.getElementSize();
+	if (size % elementSize != 0)
+		return {EMSGSIZE, {}};
+
+	const internal::MemcpyPushBulkQueueFunctor memcpyPushBulkQueueFunctor {data, elementSize};
+	return fifoQueueBase_.pushMany(waitSemaphoreFunctor, memcpyPushBulkQueueFunctor, size / elementSize);
+}
+
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class implementation
  *
- * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -39,6 +39,19 @@ RawMessageQueue::RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniqueP
 
 }
 
+int RawMessageQueue::commit(const uint8_t priority, void* const storage)
+{
+	return messageQueueBase_.commit(priority, storage);
+}
+
+int RawMessageQueue::peek(uint8_t& priority, const void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return messageQueueBase_.peek(semaphoreWaitFunctor, priority, storage);
+}
+
 int RawMessageQueue::pop(uint8_t& priority, void* const buffer, const size_t size)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -55,6 +68,41 @@ int RawMessageQueue::push(const uint8_t priority, const void* const data, const
 	return pushInternal(semaphoreWaitFunctor, priority, data, size);
 }
 
+int RawMessageQueue::release(const void* const storage)
+{
+	return messageQueueBase_.release(storage);
+}
+
+int RawMessageQueue::reserve(void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return messageQueueBase_.reserve(semaphoreWaitFunctor, storage);
+}
+
+int RawMessageQueue::tryPeek(uint8_t& priority, const void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return messageQueueBase_.peek(semaphoreTryWaitFunctor, priority, storage);
+}
+
+int RawMessageQueue::tryPeekFor(const TickClock::duration duration, uint8_t& priority, const void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return messageQueueBase_.peek(semaphoreTryWaitForFunctor, priority, storage);
+}
+
+int RawMessageQueue::tryPeekUntil(const TickClock::time_point timePoint, uint8_t& priority, const void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return messageQueueBase_.peek(semaphoreTryWaitUntilFunctor, priority, storage);
+}
+
 int RawMessageQueue::tryPop(uint8_t& priority, void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -103,6 +151,28 @@ int RawMessageQueue::tryPushUntil(const TickClock::time_point timePoint, const u
 	return pushInternal(semaphoreTryWaitUntilFunctor, priority, data, size);
 }
 
+int RawMessageQueue::tryReserve(void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return messageQueueBase_.reserve(semaphoreTryWaitFunctor, storage);
+}
+
+int RawMessageQueue::tryReserveFor(const TickClock::duration duration, void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return messageQueueBase_.reserve(semaphoreTryWaitForFunctor, storage);
+}
+
+int RawMessageQueue::tryReserveUntil(const TickClock::time_point timePoint, void*& storage)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return messageQueueBase_.reserve(semaphoreTryWaitUntilFunctor, storage);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -0,0 +1,218 @@
+/**
+ * \file
+ * \brief RawSpscQueue class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RawSpscQueue.hpp"
+
+#include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitFunctor.hpp"
+#include "distortos/internal/synchronization/SemaphoreTryWaitUntilFunctor.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include <algorithm>
+
+#include <cstring>
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RawSpscQueue::RawSpscQueue(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
+		const size_t maxElements, const size_t wakeThreshold) :
+		semaphore_{0, 1},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		readPosition_{},
+		writePosition_{},
+		elementSize_{elementSize},
+		maxElements_{maxElements},
+		wakeThreshold_{std::min(std::max(wakeThreshold, size_t{1}), maxElements)},
+		waiting_{}
+{
+
+}
+
+int RawSpscQueue::pop(void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popInternal(semaphoreWaitFunctor, buffer, 1).first;
+}
+
+std::pair<int, size_t> RawSpscQueue::popMany(void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (size % elementSize_ != 0)
+		return {EMSGSIZE, {}};
+
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popInternal(semaphoreWaitFunctor, buffer, size / elementSize_);
+}
+
+int RawSpscQueue::tryPop(void* const buffer, const size_t size)
+{
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popInternal(semaphoreTryWaitFunctor, buffer, 1).first;
+}
+
+int RawSpscQueue::tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size)
+{
+	return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size);
+}
+
+std::pair<int, size_t> RawSpscQueue::tryPopMany(void* const buffer, const size_t size)
+{
+	if (size % elementSize_ != 0)
+		return {EMSGSIZE, {}};
+
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popInternal(semaphoreTryWaitFunctor, buffer, size / elementSize_);
+}
+
+std::pair<int, size_t> RawSpscQueue::tryPopManyFor(const TickClock::duration duration, void* const buffer,
+		const size_t size)
+{
+	return tryPopManyUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size);
+}
+
+std::pair<int, size_t> RawSpscQueue::tryPopManyUntil(const TickClock::time_point timePoint, void* const buffer,
+		const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (size % elementSize_ != 0)
+		return {EMSGSIZE, {}};
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popInternal(semaphoreTryWaitUntilFunctor, buffer, size / elementSize_);
+}
+
+int RawSpscQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popInternal(semaphoreTryWaitUntilFunctor, buffer, 1).first;
+}
+
+int RawSpscQueue::tryPush(const void* const data, const size_t size)
+{
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	return pushInternal(data, 1).first;
+}
+
+std::pair<int, size_t> RawSpscQueue::tryPushMany(const void* const data, const size_t size)
+{
+	if (size % elementSize_ != 0)
+		return {EMSGSIZE, {}};
+
+	return pushInternal(data, size / elementSize_);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t RawSpscQueue::advance(size_t position, const size_t count) const
+{
+	position += count;
+	return position < 2 * maxElements_ ? position : position - 2 * maxElements_;
+}
+
+size_t RawSpscQueue::getIndex(const size_t position) const
+{
+	return position < maxElements_ ? position : position - maxElements_;
+}
+
+size_t RawSpscQueue::getSize(const size_t readPosition, const size_t writePosition) const
+{
+	return writePosition >= readPosition ? writePosition - readPosition :
+			writePosition + 2 * maxElements_ - readPosition;
+}
+
+std::pair<int, size_t> RawSpscQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor,
+		void* const buffer, const size_t maxCount)
+{
+	if (maxCount == 0)
+		return {{}, {}};
+
+	const auto readPosition = readPosition_.load(std::memory_order_relaxed);
+	auto size = getSize(readPosition, writePosition_.load(std::memory_order_acquire));
+	while (size == 0)
+	{
+		waiting_.store(true);
+		// elements pushed before producer noticed the request would not wake consumer, so the queue is checked again
+		const auto ret = getSize(readPosition, writePosition_.load()) < wakeThreshold_ ?
+				waitSemaphoreFunctor(semaphore_) : 0;
+		waiting_.store(false, std::memory_order_relaxed);
+		size = getSize(readPosition, writePosition_.load(std::memory_order_acquire));
+		// even if the wait failed (e.g. timed out), elements which are already available are popped
+		if (ret != 0 && size == 0)
+			return {ret, {}};
+	}
+
+	const auto count = std::min(size, maxCount);
+	const auto index = getIndex(readPosition);
+	const auto firstCount = std::min(count, maxElements_ - index);
+	const auto storage = static_cast<const uint8_t*>(storageUniquePointer_.get());
+	memcpy(buffer, storage + index * elementSize_, firstCount * elementSize_);
+	memcpy(static_cast<uint8_t*>(buffer) + firstCount * elementSize_, storage, (count - firstCount) * elementSize_);
+	readPosition_.store(advance(readPosition, count), std::memory_order_release);
+	return {{}, count};
+}
+
+std::pair<int, size_t> RawSpscQueue::pushInternal(const void* const data, const size_t maxCount)
+{
+	if (maxCount == 0)
+		return {{}, {}};
+
+	const auto writePosition = writePosition_.load(std::memory_order_relaxed);
+	const auto count = std::min(maxElements_ - getSize(readPosition_.load(std::memory_order_acquire), writePosition),
+			maxCount);
+	if (count == 0)
+		return {EAGAIN, {}};
+
+	const auto index = getIndex(writePosition);
+	const auto firstCount = std::min(count, maxElements_ - index);
+	const auto storage = static_cast<uint8_t*>(storageUniquePointer_.get());
+	memcpy(storage + index * elementSize_, data, firstCount * elementSize_);
+	memcpy(storage, static_cast<const uint8_t*>(data) + firstCount * elementSize_, (count - firstCount) * elementSize_);
+	const auto newWritePosition = advance(writePosition, count);
+	writePosition_.store(newWritePosition);
+
+	// semaphore is posted only for consumer waiting for enough elements, so interrupts are masked once per batch
+	if (waiting_.load() == true &&
+			getSize(readPosition_.load(std::memory_order_relaxed), newWritePosition) >= wakeThreshold_)
+	{
+		waiting_.store(false, std::memory_order_relaxed);
+		semaphore_.post();	// EOVERFLOW only means that consumer will already be woken
+	}
+
+	return {{}, count};
+}
+
+}	// namespace distortos
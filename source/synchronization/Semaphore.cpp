@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -27,28 +27,71 @@ namespace distortos
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-int Semaphore::post()
+void Semaphore::attach(internal::SemaphoreObserver& observer)
 {
 	const InterruptMaskingLock interruptMaskingLock;
 
-	if (value_ == maxValue_)
-		return EOVERFLOW;
+	observer.detach();
+	observerList_.push_back(observer);
+	waiting_.store(true, std::memory_order_relaxed);
+}
 
-	if (blockedList_.empty() == false)
+int Semaphore::post()
+{
+#if ATOMIC_INT_LOCK_FREE == 2
+
+	if (waiting_.load() == false)
 	{
-		internal::getScheduler().unblock(blockedList_.begin());
+		auto value = value_.load(std::memory_order_relaxed);
+		do
+		{
+			if (value == maxValue_)
+				return EOVERFLOW;
+		} while (value_.compare_exchange_weak(value, value + 1) == false);
+
+		// some thread may have started waiting between the check of waiting_ and the increment of value_ (possible only
+		// if post() is called from thread context) - it must not be left blocked with positive value of semaphore
+		if (waiting_.load() == false)
+			return 0;
+
+		const InterruptMaskingLock interruptMaskingLock;
+		handOver();
 		return 0;
 	}
 
-	++value_;
+#endif	// ATOMIC_INT_LOCK_FREE == 2
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto value = value_.load(std::memory_order_relaxed);
+	if (value == maxValue_)
+		return EOVERFLOW;
 
+	value_.store(value + 1, std::memory_order_relaxed);
+	handOver();
 	return 0;
 }
 
 int Semaphore::tryWait()
 {
+#if ATOMIC_INT_LOCK_FREE == 2
+
+	auto value = value_.load(std::memory_order_relaxed);
+	do
+	{
+		if (value == 0)	// lock not possible?
+			return EAGAIN;
+	} while (value_.compare_exchange_weak(value, value - 1, std::memory_order_acquire, std::memory_order_relaxed) ==
+			false);
+
+	return 0;
+
+#else	// ATOMIC_INT_LOCK_FREE != 2
+
 	const InterruptMaskingLock interruptMaskingLock;
 	return tryWaitInternal();
+
+#endif	// ATOMIC_INT_LOCK_FREE != 2
 }
 
 int Semaphore::tryWaitFor(const TickClock::duration duration)
@@ -66,6 +109,7 @@ int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
 	if (ret != EAGAIN)	// lock successful?
 		return ret;
 
+	waiting_.store(true, std::memory_order_relaxed);
 	return internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
 }
 
@@ -79,6 +123,7 @@ int Semaphore::wait()
 	if (ret != EAGAIN)	// lock successful?
 		return ret;
 
+	waiting_.store(true, std::memory_order_relaxed);
 	return internal::getScheduler().block(blockedList_, ThreadState::blockedOnSemaphore);
 }
 
@@ -86,12 +131,36 @@ int Semaphore::wait()
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void Semaphore::handOver()
+{
+	if (blockedList_.empty() == false)
+	{
+		// value may be already taken by tryWait() executed after fast path of post() but before this function
+		const auto value = value_.load(std::memory_order_relaxed);
+		if (value != 0)
+		{
+			value_.store(value - 1, std::memory_order_relaxed);
+			internal::getScheduler().unblock(blockedList_.begin());
+		}
+	}
+	else
+		while (observerList_.empty() == false)
+		{
+			auto& observer = observerList_.front();
+			observerList_.pop_front();
+			observer.notify();
+		}
+
+	waiting_.store(blockedList_.empty() == false || observerList_.empty() == false, std::memory_order_relaxed);
+}
+
 int Semaphore::tryWaitInternal()
 {
-	if (value_ == 0)	// lock not possible?
+	const auto value = value_.load(std::memory_order_relaxed);
+	if (value == 0)	// lock not possible?
 		return EAGAIN;
 
-	--value_;
+	value_.store(value - 1, std::memory_order_relaxed);
 
 	return 0;
 }
@@ -61,8 +61,8 @@ std::pair<int, SignalInformation> acceptPendingUnblockedSignal(SignalsReceiverCo
 		return {EAGAIN, SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
 
 	const auto pendingUnblockedValue = pendingUnblockedBitset.to_ulong();
-	static_assert(sizeof(pendingUnblockedValue) == pendingUnblockedBitset.size() / 8,
-			"Size of pendingUnblockedValue doesn't match size of pendingUnblockedBitset!");
+	static_assert(sizeof(pendingUnblockedValue) >= pendingUnblockedBitset.size() / 8,
+			"Size of pendingUnblockedValue is too small for pendingUnblockedBitset!");
 	// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 	const auto signalNumber = __builtin_ffsl(pendingUnblockedValue) - 1;
 
@@ -130,8 +130,8 @@ std::pair<int, SignalInformation> waitImplementation(const SignalSet& signalSet,
 	}
 
 	const auto intersectionValue = intersection.to_ulong();
-	static_assert(sizeof(intersectionValue) == intersection.size() / 8,
-			"Size of intersectionValue doesn't match size of intersection!");
+	static_assert(sizeof(intersectionValue) >= intersection.size() / 8,
+			"Size of intersectionValue is too small for intersection!");
 	// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 	const auto signalNumber = __builtin_ffsl(intersectionValue) - 1;
 	return signalsReceiverControlBlock->acceptPendingSignal(signalNumber);
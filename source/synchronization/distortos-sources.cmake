@@ -11,15 +11,22 @@ target_sources(distortos PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ConditionVariable.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicRawFifoQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicRawMessageQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/DynamicRawSpscQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/DynamicSignalsReceiver.cpp
+		${CMAKE_CURRENT_LIST_DIR}/EventFlags.cpp
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueueBase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/MemcpyPopBulkQueueFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MemcpyPopQueueFunctor.cpp
+		${CMAKE_CURRENT_LIST_DIR}/MemcpyPushBulkQueueFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MemcpyPushQueueFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MessageQueueBase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MutexControlBlock.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Mutex.cpp
+		${CMAKE_CURRENT_LIST_DIR}/PollEntry.cpp
+		${CMAKE_CURRENT_LIST_DIR}/poll.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RawFifoQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/RawMessageQueue.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RawSpscQueue.cpp
 		${CMAKE_CURRENT_LIST_DIR}/Semaphore.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreTryWaitForFunctor.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SemaphoreTryWaitFunctor.cpp
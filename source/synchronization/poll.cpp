@@ -0,0 +1,274 @@
+/**
+ * \file
+ * \brief poll() definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/poll.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/internal/synchronization/SignalsReceiverControlBlock.hpp"
+
+#include "distortos/internal/CHECK_FUNCTION_CONTEXT.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/SignalSet.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/// PollImplementation class has implementation of poll(), tryPoll() and tryPollUntil()
+class PollImplementation
+{
+public:
+
+	/**
+	 * \brief Implementation of poll(), tryPoll() and tryPollUntil().
+	 *
+	 * \param [in] pollEntriesRange is the range of entries with objects that will be waited for
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated without success, used only
+	 * if blocking mode is selected, nullptr to block without timeout
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and number of ready entries; error codes:
+	 * - EAGAIN - none of objects is ready and non-blocking mode was selected;
+	 * - EINVAL - \a pollEntriesRange is empty or one of EventFlags entries has zero bitmask;
+	 * - ENOTSUP - range contains entry with signals and reception of signals is disabled for current thread;
+	 * - error codes returned by Scheduler::block() (for blocking mode without timeout) / Scheduler::blockUntil() (for
+	 * blocking mode with timeout);
+	 */
+
+	static std::pair<int, size_t> poll(PollEntriesRange pollEntriesRange, bool nonBlocking,
+			const TickClock::time_point* timePoint);
+
+private:
+
+	/// PollUnblockFunctor is a functor executed when unblocking a thread that is blocked in poll()
+	class PollUnblockFunctor : public UnblockFunctor
+	{
+	public:
+
+		/**
+		 * \brief PollUnblockFunctor's constructor
+		 *
+		 * \param [in] pollEntriesRange is the range of entries with objects that are waited for
+		 */
+
+		constexpr explicit PollUnblockFunctor(const PollEntriesRange pollEntriesRange) :
+				pollEntriesRange_{pollEntriesRange}
+		{
+
+		}
+
+		/**
+		 * \brief PollUnblockFunctor's function call operator
+		 *
+		 * Detaches all entries from their objects and clears pointer to set of signals that were "waited for", so no
+		 * other object will try to unblock the thread when it is unblocked for any reason.
+		 *
+		 * \param [in] threadControlBlock is a reference to ThreadControlBlock that is being unblocked
+		 */
+
+		void operator()(ThreadControlBlock& threadControlBlock, UnblockReason) const override;
+
+	private:
+
+		/// range of entries with objects that are waited for
+		PollEntriesRange pollEntriesRange_;
+	};
+
+	/**
+	 * \brief Checks whether object selected by entry is ready.
+	 *
+	 * \note Interrupts must be masked when this function is called.
+	 *
+	 * \param [in] pollEntry is a reference to checked entry
+	 * \param [in] pendingSignalSet is the set of signals pending for current thread
+	 *
+	 * \return true if object selected by \a pollEntry is ready, false otherwise
+	 */
+
+	static bool isReady(const PollEntry& pollEntry, const SignalSet& pendingSignalSet);
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| PollImplementation's public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> PollImplementation::poll(const PollEntriesRange pollEntriesRange, const bool nonBlocking,
+		const TickClock::time_point* const timePoint)
+{
+	if (pollEntriesRange.size() == 0)
+		return {EINVAL, {}};
+
+	auto& scheduler = getScheduler();
+	auto& threadControlBlock = scheduler.getCurrentThreadControlBlock();
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+	const auto signalsReceiverControlBlock = threadControlBlock.getSignalsReceiverControlBlock();
+	SignalSet::Bitset waitingSignalBitset {};
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+
+	for (const auto& pollEntry : pollEntriesRange)
+	{
+		if (pollEntry.type_ == PollEntry::Type::eventFlags && pollEntry.bitmask_ == 0)
+			return {EINVAL, {}};
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+		if (pollEntry.type_ == PollEntry::Type::signals)
+		{
+			if (signalsReceiverControlBlock == nullptr)
+				return {ENOTSUP, {}};
+
+			waitingSignalBitset |= pollEntry.signalSet_->getBitset();
+		}
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+	}
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+	const SignalSet waitingSignalSet {waitingSignalBitset};
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (1)
+	{
+#if CONFIG_SIGNALS_ENABLE == 1
+		const auto pendingSignalSet = signalsReceiverControlBlock != nullptr ?
+				signalsReceiverControlBlock->getPendingSignalSet() : SignalSet{SignalSet::empty};
+#else	// CONFIG_SIGNALS_ENABLE != 1
+		const SignalSet pendingSignalSet {SignalSet::empty};
+#endif	// CONFIG_SIGNALS_ENABLE != 1
+
+		size_t readyEntries {};
+		for (auto& pollEntry : pollEntriesRange)
+		{
+			pollEntry.ready_ = isReady(pollEntry, pendingSignalSet);
+			if (pollEntry.ready_ == true)
+				++readyEntries;
+		}
+
+		if (readyEntries != 0)
+			return {{}, readyEntries};
+
+		if (nonBlocking == true)
+			return {EAGAIN, {}};
+
+		for (auto& pollEntry : pollEntriesRange)
+		{
+			pollEntry.threadControlBlock_ = &threadControlBlock;
+			if (pollEntry.type_ == PollEntry::Type::semaphore)
+				pollEntry.semaphore_->attach(pollEntry);
+			else if (pollEntry.type_ == PollEntry::Type::eventFlags)
+				pollEntry.eventFlags_->attach(pollEntry);
+		}
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+		if (waitingSignalBitset.none() == false)
+			signalsReceiverControlBlock->setWaitingSignalSet(&waitingSignalSet);
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1
+
+		ThreadList waitingList;
+		const PollUnblockFunctor pollUnblockFunctor {pollEntriesRange};
+		const auto ret = timePoint == nullptr ?
+				scheduler.block(waitingList, ThreadState::blockedOnPoll, &pollUnblockFunctor) :
+				scheduler.blockUntil(waitingList, ThreadState::blockedOnPoll, *timePoint, &pollUnblockFunctor);
+		if (ret != 0)
+			return {ret, {}};
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| PollImplementation's private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool PollImplementation::isReady(const PollEntry& pollEntry, const SignalSet& pendingSignalSet)
+{
+	if (pollEntry.type_ == PollEntry::Type::semaphore)
+		return pollEntry.semaphore_->getValue() != 0;
+
+	if (pollEntry.type_ == PollEntry::Type::eventFlags)
+	{
+		const auto value = pollEntry.eventFlags_->get() & pollEntry.bitmask_;
+		const auto all = pollEntry.waitMode_ == EventFlags::WaitMode::all ||
+				pollEntry.waitMode_ == EventFlags::WaitMode::allClear;
+		return all == true ? value == pollEntry.bitmask_ : value != 0;
+	}
+
+	return (pendingSignalSet.getBitset() & pollEntry.signalSet_->getBitset()).none() == false;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| PollImplementation::PollUnblockFunctor's public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void PollImplementation::PollUnblockFunctor::operator()(ThreadControlBlock& threadControlBlock, UnblockReason) const
+{
+	for (auto& pollEntry : pollEntriesRange_)
+		pollEntry.detach();
+
+#if CONFIG_SIGNALS_ENABLE == 1
+
+	const auto signalsReceiverControlBlock = threadControlBlock.getSignalsReceiverControlBlock();
+	if (signalsReceiverControlBlock != nullptr)
+		signalsReceiverControlBlock->setWaitingSignalSet(nullptr);
+
+#else	// CONFIG_SIGNALS_ENABLE != 1
+
+	static_cast<void>(threadControlBlock);	// suppress warning
+
+#endif	// CONFIG_SIGNALS_ENABLE != 1
+}
+
+}	// namespace internal
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, size_t> poll(const PollEntriesRange pollEntriesRange)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::PollImplementation::poll(pollEntriesRange, false, nullptr);
+}
+
+std::pair<int, size_t> tryPoll(const PollEntriesRange pollEntriesRange)
+{
+	return internal::PollImplementation::poll(pollEntriesRange, true, nullptr);
+}
+
+std::pair<int, size_t> tryPollFor(const PollEntriesRange pollEntriesRange, const TickClock::duration duration)
+{
+	return tryPollUntil(pollEntriesRange, TickClock::now() + duration + TickClock::duration{1});
+}
+
+std::pair<int, size_t> tryPollUntil(const PollEntriesRange pollEntriesRange, const TickClock::time_point timePoint)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::PollImplementation::poll(pollEntriesRange, false, &timePoint);
+}
+
+}	// namespace distortos
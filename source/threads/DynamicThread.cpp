@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicThread class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -72,6 +72,16 @@ int DynamicThread::generateSignal(const uint8_t signalNumber)
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+uint32_t DynamicThread::getDeadlineMissCount() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getDeadlineMissCount();
+}
+
 uint8_t DynamicThread::getEffectivePriority() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
@@ -116,6 +126,20 @@ uint8_t DynamicThread::getPriority() const
 	return detachableThread_->getPriority();
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+std::chrono::nanoseconds DynamicThread::getRunTime() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getRunTime();
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 SchedulingPolicy DynamicThread::getSchedulingPolicy() const
 {
 	const InterruptMaskingLock interruptMaskingLock;
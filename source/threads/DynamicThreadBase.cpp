@@ -11,11 +11,14 @@
 
 #include "distortos/internal/scheduler/DynamicThreadBase.hpp"
 
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
 #if CONFIG_THREAD_DETACH_ENABLE == 1
 
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 
+#include "distortos/assert.h"
 #include "distortos/DynamicThread.hpp"
 #include "distortos/InterruptMaskingLock.hpp"
 
@@ -49,6 +52,25 @@ int DynamicThreadBase::detach()
 	return ret == EINVAL ? 0 : ret;
 }
 
+void* DynamicThreadBase::operator new(const size_t size, StackPool* const stackPool) noexcept
+{
+	if (stackPool == nullptr)
+		return StackPool::allocateFromHeap(size);
+
+	assert(size <= getPooledObjectSize() && "Internal thread object does not fit in block of stack pool!");
+	return stackPool->allocate();
+}
+
+void DynamicThreadBase::operator delete(void* const storage)
+{
+	StackPool::deallocate(storage);
+}
+
+void DynamicThreadBase::operator delete(void* const storage, StackPool*)
+{
+	StackPool::deallocate(storage);
+}
+
 #endif	// CONFIG_THREAD_DETACH_ENABLE == 1
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -81,6 +103,40 @@ void DynamicThreadBase::run()
 	boundFunction_ = {};
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#if CONFIG_THREAD_DETACH_ENABLE == 1
+
+Stack DynamicThreadBase::makeStack(const DynamicThreadParameters& parameters, void* const object)
+{
+	if (parameters.stackPool == nullptr)
+		return makeStack(parameters.stackSize);
+
+	// the rest of the block in which internal thread object was placed is used for stack
+	const auto storageSize = parameters.stackPool->getBlockSize() - getPooledObjectSize();
+	if (adjustStackSize(parameters.stackSize) + stackGuardSize > storageSize)
+		return {{nullptr, dummyDeleter<uint8_t>}, {}};
+
+	return {{static_cast<uint8_t*>(object) + getPooledObjectSize(), dummyDeleter<uint8_t>}, storageSize};
+}
+
+#else	// CONFIG_THREAD_DETACH_ENABLE != 1
+
+Stack DynamicThreadBase::makeStack(const DynamicThreadParameters& parameters)
+{
+	if (parameters.stackPool == nullptr)
+		return makeStack(parameters.stackSize);
+
+	const auto storageSize = parameters.stackPool->getBlockSize();
+	const auto storage = adjustStackSize(parameters.stackSize) + stackGuardSize <= storageSize ?
+			parameters.stackPool->allocate() : nullptr;
+	return {{storage, StackPool::deallocate}, storage != nullptr ? storageSize : 0};
+}
+
+#endif	// CONFIG_THREAD_DETACH_ENABLE != 1
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread namespace implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -55,6 +55,20 @@ Thread& get()
 	return internal::getScheduler().getCurrentThreadControlBlock().getOwner();
 }
 
+TickClock::time_point getDeadline()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getDeadline();
+}
+
+uint32_t getDeadlineMissCount()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	return internal::getScheduler().getCurrentThreadControlBlock().getDeadlineMissCount();
+}
+
 uint8_t getEffectivePriority()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -77,6 +91,18 @@ uint8_t getPriority()
 	return internal::getScheduler().getCurrentThreadControlBlock().getPriority();
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+std::chrono::nanoseconds getRunTime()
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	auto& scheduler = internal::getScheduler();
+	return scheduler.getRunTime(scheduler.getCurrentThreadControlBlock());
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 SchedulingPolicy getSchedulingPolicy()
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -94,6 +120,13 @@ size_t getStackSize()
 	return get().getStackSize();
 }
 
+void setDeadline(const TickClock::time_point deadline)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	internal::getScheduler().getCurrentThreadControlBlock().setDeadline(deadline);
+}
+
 void setPriority(const uint8_t priority, const bool alwaysBehind)
 {
 	CHECK_FUNCTION_CONTEXT();
@@ -108,6 +141,17 @@ void setSchedulingPolicy(const SchedulingPolicy schedulingPolicy)
 	internal::getScheduler().getCurrentThreadControlBlock().setSchedulingPolicy(schedulingPolicy);
 }
 
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+void setThreadGroup(ThreadGroup& threadGroup)
+{
+	CHECK_FUNCTION_CONTEXT();
+
+	internal::getScheduler().getCurrentThreadControlBlock().setThreadGroup(threadGroup);
+}
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
 int sleepFor(const TickClock::duration duration)
 {
 	return sleepUntil(TickClock::now() + duration + TickClock::duration{1});
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadCommon class header
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -61,6 +61,11 @@ int ThreadCommon::generateSignal(const uint8_t signalNumber)
 
 #endif	// CONFIG_SIGNALS_ENABLE == 1
 
+uint32_t ThreadCommon::getDeadlineMissCount() const
+{
+	return getThreadControlBlock().getDeadlineMissCount();
+}
+
 uint8_t ThreadCommon::getEffectivePriority() const
 {
 	return getThreadControlBlock().getEffectivePriority();
@@ -91,6 +96,15 @@ uint8_t ThreadCommon::getPriority() const
 	return getThreadControlBlock().getPriority();
 }
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+std::chrono::nanoseconds ThreadCommon::getRunTime() const
+{
+	return getScheduler().getRunTime(getThreadControlBlock());
+}
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
 SchedulingPolicy ThreadCommon::getSchedulingPolicy() const
 {
 	return getThreadControlBlock().getSchedulingPolicy();
@@ -0,0 +1,56 @@
+/**
+ * \file
+ * \brief WorkItem class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/WorkItem.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+#include "distortos/WorkQueue.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WorkItem::~WorkItem()
+{
+	cancel();
+}
+
+int WorkItem::cancel()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	if (workQueue_ == nullptr)
+		return EALREADY;
+
+	return workQueue_->cancelInternal(*this);
+}
+
+bool WorkItem::isPending() const
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return node_.isLinked() == true || delayTimer_.isRunning() == true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void WorkItem::DelayTimer::run()
+{
+	owner_.workQueue_->submitInternal(owner_);
+}
+
+}	// namespace distortos
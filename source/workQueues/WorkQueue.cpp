@@ -0,0 +1,148 @@
+/**
+ * \file
+ * \brief WorkQueue class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/WorkQueue.hpp"
+
+#include "distortos/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+WorkQueue::~WorkQueue()
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	while (pendingList_.empty() == false)
+		pendingList_.pop_front();
+}
+
+int WorkQueue::submit(WorkItem& workItem)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+	return submitInternal(workItem);
+}
+
+int WorkQueue::submitAfter(WorkItem& workItem, const TickClock::duration duration)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = prepareDelayedSubmissionInternal(workItem);
+	if (ret != 0)
+		return ret;
+
+	return workItem.delayTimer_.start(duration);
+}
+
+int WorkQueue::submitAt(WorkItem& workItem, const TickClock::time_point timePoint)
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = prepareDelayedSubmissionInternal(workItem);
+	if (ret != 0)
+		return ret;
+
+	return workItem.delayTimer_.start(timePoint);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| protected functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void WorkQueue::requestStop(const size_t workers)
+{
+	{
+		const InterruptMaskingLock interruptMaskingLock;
+		stopRequested_ = true;
+	}
+
+	for (size_t i {}; i < workers; ++i)
+		semaphore_.post();
+}
+
+void WorkQueue::run()
+{
+	while (1)
+	{
+		semaphore_.wait();
+
+		WorkItem* workItem;
+
+		{
+			const InterruptMaskingLock interruptMaskingLock;
+
+			if (stopRequested_ == true)
+				return;
+
+			// work item was cancelled after the semaphore was posted, but before this thread could take its token?
+			if (pendingList_.empty() == true)
+				continue;
+
+			workItem = &pendingList_.front();
+			pendingList_.pop_front();
+		}
+
+		workItem->run();
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int WorkQueue::cancelInternal(WorkItem& workItem)
+{
+	const auto delayed = workItem.delayTimer_.isRunning();
+	if (delayed == true)
+		workItem.delayTimer_.stop();
+
+	if (workItem.node_.isLinked() == false)
+		return delayed == true ? 0 : EALREADY;
+
+	workItem.node_.unlink();
+	// if the token was already taken by worker thread, it will find the list empty and wait again
+	semaphore_.tryWait();
+	return 0;
+}
+
+int WorkQueue::prepareDelayedSubmissionInternal(WorkItem& workItem)
+{
+	if (workItem.workQueue_ != nullptr && workItem.workQueue_ != this &&
+			(workItem.node_.isLinked() == true || workItem.delayTimer_.isRunning() == true))
+		return EBUSY;
+
+	cancelInternal(workItem);
+	workItem.workQueue_ = this;
+	return 0;
+}
+
+int WorkQueue::submitInternal(WorkItem& workItem)
+{
+	if (workItem.workQueue_ != nullptr && workItem.workQueue_ != this &&
+			(workItem.node_.isLinked() == true || workItem.delayTimer_.isRunning() == true))
+		return EBUSY;
+
+	if (workItem.node_.isLinked() == true)	// already pending in this queue?
+		return 0;
+
+	workItem.delayTimer_.stop();
+	workItem.workQueue_ = this;
+	pendingList_.push_back(workItem);
+	semaphore_.post();
+	return 0;
+}
+
+}	// namespace distortos
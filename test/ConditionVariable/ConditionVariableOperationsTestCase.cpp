@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariableOperationsTestCase class implementation
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -67,6 +67,22 @@ constexpr decltype(statistics::getContextSwitchCount()) phase2ThreadContextSwitc
 /// interrupt (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase3SoftwareTimerContextSwitchCount {2};
 
+/// number of test threads in phase4
+constexpr size_t phase4Threads {3};
+
+/// expected number of context switches in phase4 caused by start of each test thread: 1 - test thread starts (main ->
+/// test), 2 - test thread blocks on condition variable (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4ThreadStartContextSwitchCount {2};
+
+/// expected number of context switches in phase4 caused by notifyAll() executed with mutex locked by main thread - all
+/// test threads are moved to the list of threads blocked on the mutex, none of them wakes up
+constexpr decltype(statistics::getContextSwitchCount()) phase4NotifyAllContextSwitchCount {0};
+
+/// expected number of context switches in phase4 caused by unlocking of the mutex: 1 - first test thread gets the lock
+/// (main -> test), 2, 3 - first and second test threads terminate after passing the lock to next one (test -> test),
+/// 4 - last test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4UnlockContextSwitchCount {phase4Threads + 1};
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -353,6 +369,97 @@ bool phase3(Mutex& mutex)
 	return true;
 }
 
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests "wait morphing" for mutexes with MutexProtocol::none. Test threads with higher priority wait for condition
+ * variable notification. Main (current) thread locks the mutex and notifies all waiters - this must not cause any
+ * context switch, as the waiters are moved directly to the list of threads blocked on the mutex. After main thread
+ * unlocks the mutex, the lock is passed from one test thread to another.
+ *
+ * \param [in] mutex is a reference to mutex used with condition variable, must be unlocked, must use
+ * MutexProtocol::none
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4(Mutex& mutex)
+{
+	constexpr size_t testThreadStackSize {512};
+
+	ConditionVariable conditionVariable;
+	bool notified {};
+	size_t lockCount {};
+	int rets[phase4Threads] {-1, -1, -1};
+
+	const auto waitFunctor = [&conditionVariable, &mutex, &notified, &lockCount](int& ret)
+			{
+				ret = mutex.lock();
+				if (ret != 0)
+					return;
+
+				ret = conditionVariable.wait(mutex,
+						[&notified]()
+						{
+							return notified;
+						});
+				++lockCount;
+				const auto unlockRet = mutex.unlock();
+				if (ret == 0)
+					ret = unlockRet;
+			};
+
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	auto thread0 = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, waitFunctor, std::ref(rets[0]));
+	auto thread1 = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, waitFunctor, std::ref(rets[1]));
+	auto thread2 = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, waitFunctor, std::ref(rets[2]));
+
+	const auto startContextSwitches = statistics::getContextSwitchCount() - contextSwitchCount;
+
+	bool result {true};
+
+	{
+		const auto ret = mutex.lock();
+		if (ret != 0)
+			result = false;
+	}
+
+	{
+		const auto notifyContextSwitchCount = statistics::getContextSwitchCount();
+		notified = true;
+		conditionVariable.notifyAll();
+		// no test thread may get the lock before main thread unlocks the mutex
+		if (statistics::getContextSwitchCount() - notifyContextSwitchCount != phase4NotifyAllContextSwitchCount ||
+				lockCount != 0)
+			result = false;
+	}
+
+	{
+		const auto unlockContextSwitchCount = statistics::getContextSwitchCount();
+		const auto ret = mutex.unlock();
+		if (ret != 0 || statistics::getContextSwitchCount() - unlockContextSwitchCount !=
+				phase4UnlockContextSwitchCount)
+			result = false;
+	}
+
+	thread0.join();
+	thread1.join();
+	thread2.join();
+
+	if (result != true || startContextSwitches != phase4Threads * phase4ThreadStartContextSwitchCount ||
+			lockCount != phase4Threads)
+		return false;
+
+	for (const auto ret : rets)
+		if (ret != 0)
+			return false;
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -381,8 +488,13 @@ bool ConditionVariableOperationsTestCase::run_() const
 			phase2ThreadContextSwitchCount + testMutexAndUnlockContextSwitchCount);
 	constexpr auto phase3ExpectedContextSwitchCount = 3 * (waitForNextTickContextSwitchCount +
 			phase3SoftwareTimerContextSwitchCount + testMutexAndUnlockContextSwitchCount);
+	constexpr auto phase4ExpectedContextSwitchCount = waitForNextTickContextSwitchCount +
+			phase4Threads * phase4ThreadStartContextSwitchCount + phase4NotifyAllContextSwitchCount +
+			phase4UnlockContextSwitchCount;
+	constexpr Mutex::Type phase4Types[] {Mutex::Type::normal, Mutex::Type::errorChecking, Mutex::Type::recursive};
 	constexpr auto expectedContextSwitchCount = parametersArray.size() * (phase1ExpectedContextSwitchCount +
-			phase2ExpectedContextSwitchCount + phase3ExpectedContextSwitchCount);
+			phase2ExpectedContextSwitchCount + phase3ExpectedContextSwitchCount) +
+			sizeof(phase4Types) / sizeof(*phase4Types) * phase4ExpectedContextSwitchCount;
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
@@ -395,6 +507,13 @@ bool ConditionVariableOperationsTestCase::run_() const
 				return ret;
 		}
 
+	for (const auto type : phase4Types)
+	{
+		Mutex mutex {type, Mutex::Protocol::none};
+		if (phase4(mutex) != true)
+			return false;
+	}
+
 	if (statistics::getContextSwitchCount() - contextSwitchCount != expectedContextSwitchCount)
 		return false;
 
@@ -0,0 +1,308 @@
+/**
+ * \file
+ * \brief EventFlagsOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "EventFlagsOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/EventFlags.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// result of wait for event flags
+using WaitResult = std::pair<int, EventFlags::Value>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread - higher than priority of test case
+constexpr uint8_t testThreadPriority {UINT8_MAX};
+
+/// expected number of context switches in phase1 block involving tryWaitFor() or tryWaitUntil(): 1 - main thread
+/// blocks on event flags (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase1TryWaitForUntilContextSwitchCount {2};
+
+/// expected number of context switches in phase2 caused by single set() which satisfies two waiting threads: 1 - first
+/// test thread is unblocked (main -> test), 2 - first test thread terminates (test -> test), 3 - second test thread
+/// terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2SetContextSwitchCount {3};
+
+/// expected number of context switches in phase3 block involving software timers (excluding waitForNextTick()): 1 -
+/// main thread blocks on event flags (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3SoftwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests EventFlags::clear(), EventFlags::set() and EventFlags::tryWait() in all modes of wait, then tests whether
+ * EventFlags::tryWaitFor() and EventFlags::tryWaitUntil() time-out at expected time when the wait is not satisfied.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	EventFlags eventFlags {0b0101};
+
+	if (eventFlags.tryWait(0, EventFlags::WaitMode::any) != WaitResult{EINVAL, 0b0101})
+		return false;
+
+	if (eventFlags.tryWait(0b1010, EventFlags::WaitMode::any) != WaitResult{EAGAIN, 0b0101} ||
+			eventFlags.tryWait(0b0011, EventFlags::WaitMode::all) != WaitResult{EAGAIN, 0b0101} ||
+			eventFlags.tryWait(0b0011, EventFlags::WaitMode::allClear) != WaitResult{EAGAIN, 0b0101} ||
+			eventFlags.get() != 0b0101)
+		return false;
+
+	if (eventFlags.tryWait(0b0011, EventFlags::WaitMode::any) != WaitResult{0, 0b0101} ||
+			eventFlags.tryWait(0b0101, EventFlags::WaitMode::all) != WaitResult{0, 0b0101} ||
+			eventFlags.get() != 0b0101)
+		return false;
+
+	// flags which satisfied the wait are returned, only flags selected by bitmask are cleared
+	if (eventFlags.tryWait(0b0011, EventFlags::WaitMode::anyClear) != WaitResult{0, 0b0101} ||
+			eventFlags.get() != 0b0100)
+		return false;
+
+	if (eventFlags.set(0b0011) != 0b0100 || eventFlags.get() != 0b0111)
+		return false;
+
+	if (eventFlags.tryWait(0b0110, EventFlags::WaitMode::allClear) != WaitResult{0, 0b0111} ||
+			eventFlags.get() != 0b0001)
+		return false;
+
+	if (eventFlags.clear(0b0011) != 0b0001 || eventFlags.get() != 0)
+		return false;
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// flags are not set, so tryWaitFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = eventFlags.tryWaitFor(singleDuration, 0b0001, EventFlags::WaitMode::any);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != WaitResult{ETIMEDOUT, 0} || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// flags are not set, so tryWaitUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = eventFlags.tryWaitUntil(requestedTimePoint, 0b0001, EventFlags::WaitMode::any);
+		if (ret != WaitResult{ETIMEDOUT, 0} || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase1TryWaitForUntilContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether single EventFlags::set() unblocks all waiting threads whose wait is satisfied - and only them - in one
+ * pass. All satisfied threads must get the same value of flags, flags cleared on exit must be cleared after all waiting
+ * threads were checked.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	EventFlags eventFlags;
+	WaitResult results[3] {{-1, {}}, {-1, {}}, {-1, {}}};
+
+	auto thread0 = makeAndStartStaticThread<testThreadStackSize>(testThreadPriority,
+			[&eventFlags, &results]()
+			{
+				results[0] = eventFlags.wait(0b001, EventFlags::WaitMode::any);
+			});
+	auto thread1 = makeAndStartStaticThread<testThreadStackSize>(testThreadPriority,
+			[&eventFlags, &results]()
+			{
+				results[1] = eventFlags.wait(0b011, EventFlags::WaitMode::allClear);
+			});
+	auto thread2 = makeAndStartStaticThread<testThreadStackSize>(testThreadPriority,
+			[&eventFlags, &results]()
+			{
+				results[2] = eventFlags.wait(0b100, EventFlags::WaitMode::anyClear);
+			});
+
+	bool result {true};
+
+	{
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto ret = eventFlags.set(0b011);
+		// both satisfied test threads have higher priority, so they must be already done when set() returns
+		if (ret != 0 || results[0] != WaitResult{0, 0b011} || results[1] != WaitResult{0, 0b011} ||
+				results[2] != WaitResult{-1, {}} || eventFlags.get() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != phase2SetContextSwitchCount)
+			result = false;
+	}
+
+	// unblock remaining test thread, so it can be joined
+	eventFlags.set(0b110);
+	thread0.join();
+	thread1.join();
+	thread2.join();
+
+	if (result != true || results[2] != WaitResult{0, 0b110} || eventFlags.get() != 0b010)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests interrupt-thread signaling scenario.
+ *
+ * Main (current) thread waits for all flags selected by two bitmasks. Two software timers are used to set these flags
+ * from interrupt context at two different time points, main thread is expected to be unblocked at the second one.
+ *
+ * \tparam Function is the type of function used to wait for flags
+ *
+ * \param [in] eventFlags is a reference to tested event flags
+ * \param [in] firstSoftwareTimer is a reference to software timer which sets flags selected by first bitmask
+ * \param [in] secondSoftwareTimer is a reference to software timer which sets flags selected by second bitmask
+ * \param [in] bitmask is the bitmask with all flags set by both software timers
+ * \param [in] function is the function used to wait for flags, it is called with time point at which the wait should
+ * be terminated without success
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Function>
+bool testSetFromInterrupt(EventFlags& eventFlags, SoftwareTimer& firstSoftwareTimer,
+		SoftwareTimer& secondSoftwareTimer, const EventFlags::Value bitmask, Function function)
+{
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto firstTimePoint = TickClock::now() + longDuration;
+	const auto secondTimePoint = firstTimePoint + longDuration;
+
+	firstSoftwareTimer.start(firstTimePoint);
+	secondSoftwareTimer.start(secondTimePoint);
+
+	// flags are currently cleared, but wait should succeed at expected time
+	const auto ret = function(secondTimePoint + longDuration);
+	const auto wokenUpTimePoint = TickClock::now();
+	return ret == WaitResult{0, bitmask} && wokenUpTimePoint == secondTimePoint && eventFlags.get() == 0 &&
+			statistics::getContextSwitchCount() - contextSwitchCount == phase3SoftwareTimerContextSwitchCount;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether flags set from interrupt context properly unblock thread waiting in EventFlags::wait(),
+ * EventFlags::tryWaitFor() and EventFlags::tryWaitUntil().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr EventFlags::Value firstBitmask {0x00010000};
+	constexpr EventFlags::Value secondBitmask {0x80000000};
+	constexpr EventFlags::Value bitmask {firstBitmask | secondBitmask};
+
+	EventFlags eventFlags;
+	auto firstSoftwareTimer = makeStaticSoftwareTimer(
+			[&eventFlags]()
+			{
+				eventFlags.set(firstBitmask);
+			});
+	auto secondSoftwareTimer = makeStaticSoftwareTimer(
+			[&eventFlags]()
+			{
+				eventFlags.set(secondBitmask);
+			});
+
+	if (testSetFromInterrupt(eventFlags, firstSoftwareTimer, secondSoftwareTimer, bitmask,
+			[&eventFlags](TickClock::time_point)
+			{
+				return eventFlags.wait(bitmask, EventFlags::WaitMode::allClear);
+			}) != true)
+		return false;
+
+	if (testSetFromInterrupt(eventFlags, firstSoftwareTimer, secondSoftwareTimer, bitmask,
+			[&eventFlags](const TickClock::time_point timePoint)
+			{
+				return eventFlags.tryWaitFor(timePoint - TickClock::now(), bitmask, EventFlags::WaitMode::allClear);
+			}) != true)
+		return false;
+
+	if (testSetFromInterrupt(eventFlags, firstSoftwareTimer, secondSoftwareTimer, bitmask,
+			[&eventFlags](const TickClock::time_point timePoint)
+			{
+				return eventFlags.tryWaitUntil(timePoint, bitmask, EventFlags::WaitMode::allClear);
+			}) != true)
+		return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool EventFlagsOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		waitForNextTick();
+		if (function() != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,639 @@
+/**
+ * \file
+ * \brief ExecutorOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ExecutorOperationsTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/Executor.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for thread which runs the executor, bytes
+constexpr size_t executorStackSize {1024};
+
+/// priority of thread which runs the executor - lower than priority of test case, so tasks run only when test case
+/// sleeps
+constexpr uint8_t executorPriority {1};
+
+/// number of ticks by which sleep of task may end too late - on the host system ticks may be lost
+constexpr TickClock::duration lateTolerance {2};
+
+/// number of values forwarded by ForwardingTask
+constexpr size_t forwardedValues {3};
+
+/// number of elements popped by MessageTask from each queue
+constexpr size_t messageTaskElements {3};
+
+/// number of records saved by each YieldingTask
+constexpr size_t yieldingTaskRecords {3};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// task which locks the semaphore given number of times
+class SemaphoreTask : public ExecutorTask
+{
+public:
+
+	/**
+	 * \brief SemaphoreTask's constructor
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be locked
+	 * \param [in] count is the number of times the semaphore will be locked
+	 */
+
+	constexpr SemaphoreTask(Semaphore& semaphore, const size_t count) :
+			ExecutorTask{},
+			semaphore_{semaphore},
+			count_{count},
+			counter_{}
+	{
+
+	}
+
+	/**
+	 * \return number of times the semaphore was locked
+	 */
+
+	size_t getCounter() const
+	{
+		return counter_;
+	}
+
+protected:
+
+	/**
+	 * \brief Body of the task
+	 *
+	 * \return true if the task is finished, false if it was suspended
+	 */
+
+	bool run() override
+	{
+		EXECUTOR_TASK_BEGIN();
+
+		while (counter_ < count_)
+		{
+			EXECUTOR_TASK_AWAIT(wait(semaphore_));
+			++counter_;
+		}
+
+		EXECUTOR_TASK_END();
+	}
+
+private:
+
+	/// reference to semaphore which will be locked
+	Semaphore& semaphore_;
+
+	/// number of times the semaphore will be locked
+	size_t count_;
+
+	/// number of times the semaphore was locked
+	volatile size_t counter_;
+};
+
+/// task which forwards values from one FifoQueue to another
+class ForwardingTask : public ExecutorTask
+{
+public:
+
+	/**
+	 * \brief ForwardingTask's constructor
+	 *
+	 * \param [in] input is a reference to FifoQueue from which values will be popped
+	 * \param [in] output is a reference to FifoQueue to which values will be pushed
+	 */
+
+	constexpr ForwardingTask(FifoQueue<int>& input, FifoQueue<int>& output) :
+			ExecutorTask{},
+			input_{input},
+			output_{output},
+			counter_{},
+			value_{}
+	{
+
+	}
+
+protected:
+
+	/**
+	 * \brief Body of the task
+	 *
+	 * \return true if the task is finished, false if it was suspended
+	 */
+
+	bool run() override
+	{
+		EXECUTOR_TASK_BEGIN();
+
+		for (counter_ = 0; counter_ < forwardedValues; ++counter_)
+		{
+			EXECUTOR_TASK_AWAIT(pop(input_, value_));
+			EXECUTOR_TASK_AWAIT(push(output_, value_));
+		}
+
+		EXECUTOR_TASK_END();
+	}
+
+private:
+
+	/// reference to FifoQueue from which values will be popped
+	FifoQueue<int>& input_;
+
+	/// reference to FifoQueue to which values will be pushed
+	FifoQueue<int>& output_;
+
+	/// number of forwarded values
+	size_t counter_;
+
+	/// currently forwarded value
+	int value_;
+};
+
+/// task which pops elements from MessageQueue and RawFifoQueue
+class MessageTask : public ExecutorTask
+{
+public:
+
+	/**
+	 * \brief MessageTask's constructor
+	 *
+	 * \param [in] messageQueue is a reference to MessageQueue from which elements will be popped
+	 * \param [in] rawFifoQueue is a reference to RawFifoQueue from which elements will be popped
+	 */
+
+	constexpr MessageTask(MessageQueue<int>& messageQueue, RawFifoQueue& rawFifoQueue) :
+			ExecutorTask{},
+			messageQueue_{messageQueue},
+			rawFifoQueue_{rawFifoQueue},
+			priorities_{},
+			rawValues_{},
+			values_{},
+			counter_{},
+			ret_{}
+	{
+
+	}
+
+	/**
+	 * \return number of elements popped from each queue
+	 */
+
+	size_t getCounter() const
+	{
+		return counter_;
+	}
+
+	/**
+	 * \param [in] index is the index of popped element
+	 *
+	 * \return priority of element popped from MessageQueue
+	 */
+
+	uint8_t getPriority(const size_t index) const
+	{
+		return priorities_[index];
+	}
+
+	/**
+	 * \param [in] index is the index of popped element
+	 *
+	 * \return value of element popped from RawFifoQueue
+	 */
+
+	int getRawValue(const size_t index) const
+	{
+		return rawValues_[index];
+	}
+
+	/**
+	 * \param [in] index is the index of popped element
+	 *
+	 * \return value of element popped from MessageQueue
+	 */
+
+	int getValue(const size_t index) const
+	{
+		return values_[index];
+	}
+
+protected:
+
+	/**
+	 * \brief Body of the task
+	 *
+	 * \return true if the task is finished, false if it was suspended
+	 */
+
+	bool run() override
+	{
+		EXECUTOR_TASK_BEGIN();
+
+		for (counter_ = 0; counter_ < messageTaskElements; ++counter_)
+		{
+			EXECUTOR_TASK_AWAIT(pop(messageQueue_, priorities_[counter_], values_[counter_]));
+			EXECUTOR_TASK_AWAIT(pop(rawFifoQueue_, &rawValues_[counter_], sizeof(rawValues_[counter_]), ret_));
+			if (ret_ != 0)
+				EXECUTOR_TASK_END();
+		}
+
+		EXECUTOR_TASK_END();
+	}
+
+private:
+
+	/// reference to MessageQueue from which elements will be popped
+	MessageQueue<int>& messageQueue_;
+
+	/// reference to RawFifoQueue from which elements will be popped
+	RawFifoQueue& rawFifoQueue_;
+
+	/// priorities of elements popped from MessageQueue
+	uint8_t priorities_[messageTaskElements];
+
+	/// values of elements popped from RawFifoQueue
+	int rawValues_[messageTaskElements];
+
+	/// values of elements popped from MessageQueue
+	int values_[messageTaskElements];
+
+	/// number of elements popped from each queue
+	volatile size_t counter_;
+
+	/// return value of pop from RawFifoQueue
+	int ret_;
+};
+
+/// task which sleeps and waits for semaphore with a timeout
+class SleepingTask : public ExecutorTask
+{
+public:
+
+	/// number of time points saved by the task
+	constexpr static size_t timePoints {4};
+
+	/**
+	 * \brief SleepingTask's constructor
+	 *
+	 * \param [in] semaphore is a reference to semaphore which will be waited for
+	 * \param [in] duration is the duration of sleep and timeout
+	 */
+
+	constexpr SleepingTask(Semaphore& semaphore, const TickClock::duration duration) :
+			ExecutorTask{},
+			timePoints_{},
+			duration_{duration},
+			semaphore_{semaphore}
+	{
+
+	}
+
+	/**
+	 * \param [in] index is the index of time point
+	 *
+	 * \return time point saved by the task - when it started, after sleep for \a duration, after sleep until 3 *
+	 * \a duration from start and after wait for semaphore with \a duration timeout
+	 */
+
+	TickClock::time_point getTimePoint(const size_t index) const
+	{
+		return timePoints_[index];
+	}
+
+protected:
+
+	/**
+	 * \brief Body of the task
+	 *
+	 * \return true if the task is finished, false if it was suspended
+	 */
+
+	bool run() override
+	{
+		EXECUTOR_TASK_BEGIN();
+
+		timePoints_[0] = TickClock::now();
+		EXECUTOR_TASK_SLEEP_FOR(duration_);
+		timePoints_[1] = TickClock::now();
+		EXECUTOR_TASK_SLEEP_UNTIL(timePoints_[0] + duration_ * 3);
+		timePoints_[2] = TickClock::now();
+		setDeadlineAfter(duration_);
+		EXECUTOR_TASK_AWAIT(wait(semaphore_) || deadlineReached());
+		timePoints_[3] = TickClock::now();
+
+		EXECUTOR_TASK_END();
+	}
+
+private:
+
+	/// time points saved by the task
+	TickClock::time_point timePoints_[timePoints];
+
+	/// duration of sleep and timeout
+	TickClock::duration duration_;
+
+	/// reference to semaphore which will be waited for
+	Semaphore& semaphore_;
+};
+
+/// task which saves its identifier in shared array and yields
+class YieldingTask : public ExecutorTask
+{
+public:
+
+	/**
+	 * \brief YieldingTask's constructor
+	 *
+	 * \param [in] identifier is the identifier of the task
+	 * \param [out] records is a pointer to shared array for identifiers of tasks
+	 * \param [in,out] index is a reference to shared index of next record
+	 */
+
+	constexpr YieldingTask(const char identifier, char* const records, size_t& index) :
+			ExecutorTask{},
+			index_{index},
+			records_{records},
+			counter_{},
+			identifier_{identifier}
+	{
+
+	}
+
+protected:
+
+	/**
+	 * \brief Body of the task
+	 *
+	 * \return true if the task is finished, false if it was suspended
+	 */
+
+	bool run() override
+	{
+		EXECUTOR_TASK_BEGIN();
+
+		for (counter_ = 0; counter_ < yieldingTaskRecords; ++counter_)
+		{
+			records_[index_++] = identifier_;
+			EXECUTOR_TASK_YIELD();
+		}
+
+		EXECUTOR_TASK_END();
+	}
+
+private:
+
+	/// reference to shared index of next record
+	size_t& index_;
+
+	/// pointer to shared array for identifiers of tasks
+	char* records_;
+
+	/// number of saved records
+	size_t counter_;
+
+	/// identifier of the task
+	char identifier_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests tasks waiting for semaphore posted from thread and interrupt context.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testSemaphore()
+{
+	Executor executor;
+	Semaphore semaphore {0};
+	SemaphoreTask taskA {semaphore, 2};
+	SemaphoreTask taskB {semaphore, 2};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&semaphore]()
+			{
+				semaphore.post();
+			});
+
+	bool result {true};
+	if (taskA.isActive() != false || executor.add(taskA) != 0 || executor.add(taskB) != 0 ||
+			taskA.isActive() != true || executor.add(taskA) != EBUSY)
+		result = false;
+
+	auto thread = makeAndStartStaticThread<executorStackSize>(executorPriority, &Executor::run, &executor);
+
+	ThisThread::sleepFor(TickClock::duration{2});
+	// both tasks wait for the semaphore
+	if (taskA.getCounter() != 0 || taskB.getCounter() != 0)
+		result = false;
+
+	semaphore.post();
+	ThisThread::sleepFor(TickClock::duration{2});
+	if (taskA.getCounter() + taskB.getCounter() != 1 || semaphore.getValue() != 0)
+		result = false;
+
+	softwareTimer.start(TickClock::duration{1});
+	ThisThread::sleepFor(TickClock::duration{4});
+	if (taskA.getCounter() + taskB.getCounter() != 2 || semaphore.getValue() != 0)
+		result = false;
+
+	semaphore.post();
+	semaphore.post();
+	// executor returns when all tasks are finished
+	thread.join();
+
+	return result == true && taskA.getCounter() == 2 && taskB.getCounter() == 2 && taskA.isActive() == false &&
+			taskB.isActive() == false && semaphore.getValue() == 0;
+}
+
+/**
+ * \brief Tests tasks waiting for queues.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testQueues()
+{
+	Executor executor;
+	StaticFifoQueue<int, forwardedValues> input;
+	StaticFifoQueue<int, 1> output;
+	StaticMessageQueue<int, messageTaskElements> messageQueue;
+	StaticRawFifoQueue<sizeof(int), messageTaskElements> rawFifoQueue;
+	ForwardingTask forwardingTask {input, output};
+	MessageTask messageTask {messageQueue, rawFifoQueue};
+
+	bool result {executor.add(forwardingTask) == 0 && executor.add(messageTask) == 0};
+
+	// elements pushed before the executor is started are popped in the order of their priority
+	constexpr uint8_t priorities[messageTaskElements] {1, 3, 2};
+	for (size_t i {}; i < messageTaskElements; ++i)
+		if (messageQueue.tryPush(priorities[i], static_cast<int>(i)) != 0)
+			result = false;
+
+	auto thread = makeAndStartStaticThread<executorStackSize>(executorPriority, &Executor::run, &executor);
+
+	ThisThread::sleepFor(TickClock::duration{2});
+	// element with highest priority was popped from MessageQueue, task waits for RawFifoQueue
+	if (messageTask.getCounter() != 0 || messageTask.getPriority(0) != 3 || messageTask.getValue(0) != 1)
+		result = false;
+
+	for (size_t i {}; i < messageTaskElements; ++i)
+		if (rawFifoQueue.tryPush(static_cast<int>(i * 10)) != 0)
+			result = false;
+
+	for (size_t i {}; i < forwardedValues; ++i)
+		if (input.tryPush(static_cast<int>(i + 100)) != 0)
+			result = false;
+
+	ThisThread::sleepFor(TickClock::duration{2});
+	// output queue has only one slot, so forwarding task waits for free space
+	if (output.tryPush(0) != EAGAIN)
+		result = false;
+
+	for (size_t i {}; i < forwardedValues; ++i)
+	{
+		int value;
+		if (output.tryPopFor(TickClock::duration{4}, value) != 0 || value != static_cast<int>(i + 100))
+			result = false;
+	}
+
+	thread.join();
+
+	if (messageTask.getCounter() != messageTaskElements)
+		return false;
+
+	for (size_t i {}; i < messageTaskElements; ++i)
+		if (messageTask.getPriority(i) != messageTaskElements - i ||
+				messageTask.getRawValue(i) != static_cast<int>(i * 10))
+			return false;
+
+	return result == true && messageTask.getValue(0) == 1 && messageTask.getValue(1) == 2 &&
+			messageTask.getValue(2) == 0;
+}
+
+/**
+ * \brief Tests sleeps and timeouts of tasks.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testSleeps()
+{
+	constexpr auto duration = TickClock::duration{10};
+
+	Executor executor;
+	Semaphore semaphore {0};
+	SleepingTask task {semaphore, duration};
+
+	if (executor.add(task) != 0)
+		return false;
+
+	waitForNextTick();
+	auto thread = makeAndStartStaticThread<executorStackSize>(executorPriority, &Executor::run, &executor);
+	thread.join();
+
+	const auto start = task.getTimePoint(0);
+	const TickClock::time_point expectedTimePoints[SleepingTask::timePoints]
+	{
+			start,
+			start + duration + TickClock::duration{1},
+			start + duration * 3,
+			start + duration * 4 + TickClock::duration{1},
+	};
+	for (size_t i {1}; i < SleepingTask::timePoints; ++i)
+		if (task.getTimePoint(i) < expectedTimePoints[i] ||
+				task.getTimePoint(i) > expectedTimePoints[i] + lateTolerance)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests yielding of tasks.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testYield()
+{
+	Executor executor;
+	char records[yieldingTaskRecords * 2 + 1] {};
+	size_t index {};
+	YieldingTask taskA {'a', records, index};
+	YieldingTask taskB {'b', records, index};
+
+	if (executor.add(taskA) != 0 || executor.add(taskB) != 0)
+		return false;
+
+	auto thread = makeAndStartStaticThread<executorStackSize>(executorPriority, &Executor::run, &executor);
+	thread.join();
+
+	// tasks are resumed in round-robin order
+	return index == yieldingTaskRecords * 2 && records[0] == 'a' && records[1] == 'b' && records[2] == 'a' &&
+			records[3] == 'b' && records[4] == 'a' && records[5] == 'b';
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ExecutorOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	if (testSemaphore() == false)
+		return false;
+
+	if (testQueues() == false)
+		return false;
+
+	if (testSleeps() == false)
+		return false;
+
+	if (testYield() == false)
+		return false;
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ExecutorOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_EXECUTOR_EXECUTOROPERATIONSTESTCASE_HPP_
+#define TEST_EXECUTOR_EXECUTOROPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various Executor operations.
+ *
+ * Tests tasks waiting for semaphore posted from thread and interrupt context, tasks waiting for FifoQueue,
+ * MessageQueue and RawFifoQueue, sleeps and timeouts of tasks, yielding and completion of all tasks. Also verifies that
+ * none of these operations uses dynamic memory allocation.
+ */
+
+class ExecutorOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ExecutorOperationsTestCase's constructor
+	 */
+
+	constexpr ExecutorOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_EXECUTOR_EXECUTOROPERATIONSTESTCASE_HPP_
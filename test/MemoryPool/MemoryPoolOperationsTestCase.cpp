@@ -0,0 +1,391 @@
+/**
+ * \file
+ * \brief MemoryPoolOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MemoryPoolOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicMemoryPool.hpp"
+#include "distortos/StaticMemoryPool.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// size of single block of memory pools used in tests, bytes
+constexpr size_t blockSize {13};
+
+/// number of blocks in memory pools used in tests
+constexpr size_t blocks {4};
+
+/// expected number of context switches in block involving tryAllocateFor() or tryAllocateUntil() with empty pool
+/// (excluding waitForNextTick()): 1 - main thread blocks on memory pool (main -> idle), 2 - main thread wakes up
+/// (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) tryAllocateForUntilContextSwitchCount {2};
+
+/// expected number of context switches in block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on memory pool (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks usage statistics of memory pool.
+ *
+ * \param [in] memoryPool is a reference to memory pool which will be checked
+ * \param [in] usedBlocks is the expected number of allocated blocks
+ * \param [in] maxUsedBlocks is the expected maximal number of blocks allocated at the same time
+ * \param [in] failures is the expected number of failed allocations
+ *
+ * \return true if statistics match, false otherwise
+ */
+
+bool checkStatistics(const MemoryPool& memoryPool, const size_t usedBlocks, const size_t maxUsedBlocks,
+		const size_t failures)
+{
+	return memoryPool.getUsedBlocks() == usedBlocks && memoryPool.getMaxUsedBlocks() == maxUsedBlocks &&
+			memoryPool.getFailures() == failures;
+}
+
+/**
+ * \brief Tests allocation and deallocation of all blocks of memory pool.
+ *
+ * All blocks are allocated with tryAllocate(), which must succeed immediately, each block is filled with unique value.
+ * Allocation from empty pool must fail - immediately for tryAllocate() and at expected time for tryAllocateFor() and
+ * tryAllocateUntil(). Deallocation of invalid blocks must fail and deallocation of all allocated blocks must succeed.
+ *
+ * \param [in] memoryPool is a reference to tested memory pool, all of its blocks must be free
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testAllocateDeallocate(MemoryPool& memoryPool)
+{
+	if (memoryPool.getBlockSize() != blockSize || memoryPool.getBlocks() != blocks ||
+			checkStatistics(memoryPool, 0, 0, 0) != true)
+		return false;
+
+	void* allocatedBlocks[blocks] {};
+
+	for (size_t i {}; i < blocks; ++i)
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0 || start != TickClock::now() || ret.second == nullptr ||
+				reinterpret_cast<uintptr_t>(ret.second) % alignof(max_align_t) != 0 ||
+				checkStatistics(memoryPool, i + 1, i + 1, 0) != true)
+			return false;
+
+		allocatedBlocks[i] = ret.second;
+		memset(allocatedBlocks[i], static_cast<int>(i), blockSize);
+	}
+
+	{
+		// pool is empty, so tryAllocate() should fail immediately
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != EAGAIN || start != TickClock::now() || ret.second != nullptr ||
+				checkStatistics(memoryPool, blocks, blocks, 1) != true)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// pool is empty, so tryAllocateFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.tryAllocateFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				ret.second != nullptr || checkStatistics(memoryPool, blocks, blocks, 2) != true ||
+				statistics::getContextSwitchCount() - contextSwitchCount != tryAllocateForUntilContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// pool is empty, so tryAllocateUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = memoryPool.tryAllocateUntil(requestedTimePoint);
+		if (ret.first != ETIMEDOUT || requestedTimePoint != TickClock::now() || ret.second != nullptr ||
+				checkStatistics(memoryPool, blocks, blocks, 3) != true ||
+				statistics::getContextSwitchCount() - contextSwitchCount != tryAllocateForUntilContextSwitchCount)
+			return false;
+	}
+
+	// blocks must not overlap
+	for (size_t i {}; i < blocks; ++i)
+		for (size_t j {}; j < blockSize; ++j)
+			if (static_cast<uint8_t*>(allocatedBlocks[i])[j] != i)
+				return false;
+
+	{
+		int object;
+		// invalid blocks must be rejected
+		if (memoryPool.deallocate(nullptr) != EINVAL || memoryPool.deallocate(&object) != EINVAL ||
+				memoryPool.deallocate(static_cast<uint8_t*>(allocatedBlocks[0]) + 1) != EINVAL ||
+				checkStatistics(memoryPool, blocks, blocks, 3) != true)
+			return false;
+	}
+
+	for (size_t i {}; i < blocks; ++i)
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		const auto ret = memoryPool.deallocate(allocatedBlocks[i]);
+		if (ret != 0 || start != TickClock::now() || checkStatistics(memoryPool, blocks - i - 1, blocks, 3) != true)
+			return false;
+	}
+
+	// all blocks are free, so deallocation of any block must be rejected
+	if (memoryPool.deallocate(allocatedBlocks[0]) != EINVAL || checkStatistics(memoryPool, 0, blocks, 3) != true)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests interrupt-thread scenario.
+ *
+ * Main (current) thread waits for a block of empty memory pool. Software timer is used to deallocate a block at
+ * specified time point from interrupt context, main thread is expected to allocate the same block (with allocate(),
+ * tryAllocateFor() and tryAllocateUntil()) in the same moment.
+ *
+ * \param [in] memoryPool is a reference to tested memory pool, all of its blocks must be free
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testDeallocateFromInterrupt(MemoryPool& memoryPool)
+{
+	void* allocatedBlocks[blocks] {};
+
+	for (auto& allocatedBlock : allocatedBlocks)
+	{
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0)
+			return false;
+
+		allocatedBlock = ret.second;
+	}
+
+	void* block {allocatedBlocks[0]};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&memoryPool, &block]()
+			{
+				memoryPool.deallocate(block);
+			});
+
+	for (size_t i {}; i < 3; ++i)
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+
+		softwareTimer.start(wakeUpTimePoint);
+
+		// pool is empty, but allocation should succeed at expected time
+		const auto ret = i == 0 ? memoryPool.allocate() : i == 1 ?
+				memoryPool.tryAllocateFor(wakeUpTimePoint - TickClock::now() + longDuration) :
+				memoryPool.tryAllocateUntil(wakeUpTimePoint + longDuration);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret.first != 0 || ret.second != block || wakeUpTimePoint != wokenUpTimePoint ||
+				checkStatistics(memoryPool, blocks, blocks, 0) != true ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerContextSwitchCount)
+			return false;
+	}
+
+	for (const auto allocatedBlock : allocatedBlocks)
+		if (memoryPool.deallocate(allocatedBlock) != 0)
+			return false;
+
+	return checkStatistics(memoryPool, 0, blocks, 0);
+}
+
+/**
+ * \brief Tests deallocation of block which is not allocated.
+ *
+ * All blocks are allocated and one of them is deallocated twice, while other blocks are still allocated. Second
+ * deallocation must fail without changing the statistics and without corrupting the list of free blocks - exactly one
+ * block (the deallocated one) can be allocated again.
+ *
+ * \param [in] memoryPool is a reference to tested memory pool, all of its blocks must be free
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testDoubleDeallocation(MemoryPool& memoryPool)
+{
+	void* allocatedBlocks[blocks] {};
+
+	for (auto& allocatedBlock : allocatedBlocks)
+	{
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0)
+			return false;
+
+		allocatedBlock = ret.second;
+	}
+
+	if (memoryPool.deallocate(allocatedBlocks[1]) != 0 || checkStatistics(memoryPool, blocks - 1, blocks, 0) != true)
+		return false;
+
+	// block is already free, so its deallocation must be rejected
+	if (memoryPool.deallocate(allocatedBlocks[1]) != EINVAL ||
+			checkStatistics(memoryPool, blocks - 1, blocks, 0) != true)
+		return false;
+
+	{
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != 0 || ret.second != allocatedBlocks[1] || checkStatistics(memoryPool, blocks, blocks, 0) != true)
+			return false;
+	}
+
+	{
+		// pool is empty, so tryAllocate() should fail
+		const auto ret = memoryPool.tryAllocate();
+		if (ret.first != EAGAIN || ret.second != nullptr || checkStatistics(memoryPool, blocks, blocks, 1) != true)
+			return false;
+	}
+
+	for (const auto allocatedBlock : allocatedBlocks)
+		if (memoryPool.deallocate(allocatedBlock) != 0)
+			return false;
+
+	return checkStatistics(memoryPool, 0, blocks, 1);
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests allocation and deallocation of all blocks of StaticMemoryPool and DynamicMemoryPool.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	{
+		StaticMemoryPool<blockSize, blocks> memoryPool;
+		if (testAllocateDeallocate(memoryPool) != true)
+			return false;
+	}
+
+	{
+		DynamicMemoryPool memoryPool {blockSize, blocks};
+		if (testAllocateDeallocate(memoryPool) != true)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests interrupt-thread scenario with StaticMemoryPool and DynamicMemoryPool.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	{
+		StaticMemoryPool<blockSize, blocks> memoryPool;
+		if (testDeallocateFromInterrupt(memoryPool) != true)
+			return false;
+	}
+
+	{
+		DynamicMemoryPool memoryPool {blockSize, blocks};
+		if (testDeallocateFromInterrupt(memoryPool) != true)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests deallocation of block which is not allocated with StaticMemoryPool and DynamicMemoryPool.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	{
+		StaticMemoryPool<blockSize, blocks> memoryPool;
+		if (testDoubleDeallocation(memoryPool) != true)
+			return false;
+	}
+
+	{
+		DynamicMemoryPool memoryPool {blockSize, blocks};
+		if (testDoubleDeallocation(memoryPool) != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MemoryPoolOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		waitForNextTick();
+		if (function() != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
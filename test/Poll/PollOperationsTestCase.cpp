@@ -0,0 +1,410 @@
+/**
+ * \file
+ * \brief PollOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "PollOperationsTestCase.hpp"
+
+#include "Signals/abortSignalHandler.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/distortosConfiguration.h"
+#include "distortos/poll.hpp"
+#include "distortos/SignalAction.hpp"
+#include "distortos/SignalSet.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThisThread-Signals.hpp"
+#include "distortos/Thread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// result of poll
+using PollResult = std::pair<int, size_t>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in block involving tryPollFor(), tryPollUntil() or software timer (excluding
+/// waitForNextTick()): 1 - main thread blocks in poll (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) waitContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether readiness of entries matches expected pattern.
+ *
+ * \param [in] pollEntriesRange is the range of checked entries
+ * \param [in] readyMask is the bitmask with expected readiness of entries, bit 0 - first entry
+ *
+ * \return true if readiness of entries matches \a readyMask, false otherwise
+ */
+
+bool checkReady(const PollEntriesRange pollEntriesRange, const uint32_t readyMask)
+{
+	for (size_t i {}; i < pollEntriesRange.size(); ++i)
+		if (pollEntriesRange[i].isReady() != ((readyMask & (1u << i)) != 0))
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests tryPoll() with objects in various states - readiness of entries must be reported without consuming anything
+ * from the objects. Then tests whether tryPollFor() and tryPollUntil() time-out at expected time when no object is
+ * ready.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Semaphore semaphore {0};
+	StaticFifoQueue<uint8_t, 1> fifoQueue;
+	EventFlags eventFlags;
+
+	PollEntry pollEntries[]
+	{
+			PollEntry{semaphore},
+			PollEntry{fifoQueue, PollEntry::QueueOperation::pop},
+			PollEntry{eventFlags, 0b11, EventFlags::WaitMode::allClear},
+	};
+	const PollEntriesRange pollEntriesRange {pollEntries};
+
+	if (tryPoll(PollEntriesRange{}) != PollResult{EINVAL, 0})
+		return false;
+
+	{
+		PollEntry invalidPollEntries[] {PollEntry{semaphore}, PollEntry{eventFlags, 0, EventFlags::WaitMode::any}};
+		if (tryPoll(PollEntriesRange{invalidPollEntries}) != PollResult{EINVAL, 0})
+			return false;
+	}
+
+	if (tryPoll(pollEntriesRange) != PollResult{EAGAIN, 0} || checkReady(pollEntriesRange, 0b000) != true)
+		return false;
+
+	// only some of flags are set, so wait for all flags is not satisfied
+	if (semaphore.post() != 0 || eventFlags.set(0b01) != 0)
+		return false;
+
+	if (tryPoll(pollEntriesRange) != PollResult{0, 1} || checkReady(pollEntriesRange, 0b001) != true)
+		return false;
+
+	if (fifoQueue.tryPush(0x5a) != 0 || eventFlags.set(0b10) != 0b01)
+		return false;
+
+	// poll consumes nothing - the same state is reported again
+	for (size_t i {}; i < 2; ++i)
+		if (tryPoll(pollEntriesRange) != PollResult{0, 3} || checkReady(pollEntriesRange, 0b111) != true ||
+				semaphore.getValue() != 1 || eventFlags.get() != 0b11)
+			return false;
+
+	{
+		PollEntry pushPollEntries[] {PollEntry{fifoQueue, PollEntry::QueueOperation::push}};
+		if (tryPoll(PollEntriesRange{pushPollEntries}) != PollResult{EAGAIN, 0})
+			return false;
+	}
+
+	uint8_t value {};
+	if (semaphore.tryWait() != 0 || fifoQueue.tryPop(value) != 0 || value != 0x5a || eventFlags.clear(0b01) != 0b11)
+		return false;
+
+	if (tryPoll(pollEntriesRange) != PollResult{EAGAIN, 0} || checkReady(pollEntriesRange, 0b000) != true)
+		return false;
+
+	{
+		PollEntry pushPollEntries[] {PollEntry{fifoQueue, PollEntry::QueueOperation::push}};
+		if (tryPoll(PollEntriesRange{pushPollEntries}) != PollResult{0, 1} ||
+				checkReady(PollEntriesRange{pushPollEntries}, 0b1) != true)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// no object is ready, so tryPollFor() should time-out at expected time
+		const auto start = TickClock::now();
+		const auto ret = tryPollFor(pollEntriesRange, singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != PollResult{ETIMEDOUT, 0} || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != waitContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+		// no object is ready, so tryPollUntil() should time-out at exact expected time
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = tryPollUntil(pollEntriesRange, requestedTimePoint);
+		if (ret != PollResult{ETIMEDOUT, 0} || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != waitContextSwitchCount)
+			return false;
+	}
+
+	// entries must be detached after timeout - objects made ready now must not try to unblock main thread
+	if (semaphore.post() != 0 || eventFlags.set(0b10) != 0b10 || semaphore.getValue() != 1)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Tests interrupt-thread signaling scenario.
+ *
+ * Main (current) thread waits for entries which are not ready. Software timer makes one of objects ready from interrupt
+ * context, main thread is expected to be unblocked at that time point with only this entry reported as ready.
+ *
+ * \tparam Function is the type of function used to wait for entries
+ *
+ * \param [in] pollEntriesRange is the range of entries which will be waited for
+ * \param [in] softwareTimer is a reference to software timer which makes the object ready
+ * \param [in] readyMask is the bitmask with expected readiness of entries, bit 0 - first entry
+ * \param [in] function is the function used to wait for entries, it is called with time point at which the wait should
+ * be terminated without success
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Function>
+bool testReadyFromInterrupt(const PollEntriesRange pollEntriesRange, SoftwareTimer& softwareTimer,
+		const uint32_t readyMask, Function function)
+{
+	waitForNextTick();
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+	const auto timePoint = TickClock::now() + longDuration;
+
+	softwareTimer.start(timePoint);
+
+	// no object is currently ready, but wait should succeed at expected time
+	const auto ret = function(timePoint + longDuration);
+	const auto wokenUpTimePoint = TickClock::now();
+	return ret == PollResult{0, 1} && wokenUpTimePoint == timePoint &&
+			checkReady(pollEntriesRange, readyMask) == true &&
+			statistics::getContextSwitchCount() - contextSwitchCount == waitContextSwitchCount;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether objects made ready from interrupt context properly unblock thread waiting in poll(), tryPollFor() and
+ * tryPollUntil().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore {0};
+	StaticFifoQueue<uint8_t, 1> emptyFifoQueue;
+	StaticFifoQueue<uint8_t, 1> fullFifoQueue;
+	EventFlags eventFlags;
+
+	if (fullFifoQueue.tryPush(0xa5) != 0)
+		return false;
+
+	PollEntry pollEntries[]
+	{
+			PollEntry{semaphore},
+			PollEntry{emptyFifoQueue, PollEntry::QueueOperation::pop},
+			PollEntry{fullFifoQueue, PollEntry::QueueOperation::push},
+			PollEntry{eventFlags, 0b1000, EventFlags::WaitMode::any},
+	};
+	const PollEntriesRange pollEntriesRange {pollEntries};
+
+	auto semaphoreSoftwareTimer = makeStaticSoftwareTimer(
+			[&semaphore]()
+			{
+				semaphore.post();
+			});
+	auto pushSoftwareTimer = makeStaticSoftwareTimer(
+			[&emptyFifoQueue]()
+			{
+				emptyFifoQueue.tryPush(0x5a);
+			});
+	auto popSoftwareTimer = makeStaticSoftwareTimer(
+			[&fullFifoQueue]()
+			{
+				uint8_t value;
+				fullFifoQueue.tryPop(value);
+			});
+	auto eventFlagsSoftwareTimer = makeStaticSoftwareTimer(
+			[&eventFlags]()
+			{
+				eventFlags.set(0b1000);
+			});
+
+	if (testReadyFromInterrupt(pollEntriesRange, semaphoreSoftwareTimer, 0b0001,
+			[pollEntriesRange](TickClock::time_point)
+			{
+				return poll(pollEntriesRange);
+			}) != true || semaphore.tryWait() != 0)
+		return false;
+
+	if (testReadyFromInterrupt(pollEntriesRange, pushSoftwareTimer, 0b0010,
+			[pollEntriesRange](const TickClock::time_point timePoint)
+			{
+				return tryPollFor(pollEntriesRange, timePoint - TickClock::now());
+			}) != true)
+		return false;
+
+	uint8_t value {};
+	if (emptyFifoQueue.tryPop(value) != 0 || value != 0x5a)
+		return false;
+
+	if (testReadyFromInterrupt(pollEntriesRange, popSoftwareTimer, 0b0100,
+			[pollEntriesRange](const TickClock::time_point timePoint)
+			{
+				return tryPollUntil(pollEntriesRange, timePoint);
+			}) != true || fullFifoQueue.tryPush(0xa5) != 0)
+		return false;
+
+	if (testReadyFromInterrupt(pollEntriesRange, eventFlagsSoftwareTimer, 0b1000,
+			[pollEntriesRange](const TickClock::time_point timePoint)
+			{
+				return tryPollUntil(pollEntriesRange, timePoint);
+			}) != true || eventFlags.get() != 0b1000)
+		return false;
+
+	return true;
+}
+
+#if CONFIG_SIGNALS_ENABLE == 1 && CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS == 1
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether signal generated for main thread from interrupt context properly unblocks it when it waits in poll()
+ * for a set of signals and a semaphore.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr uint8_t signalNumber {13};
+
+	Semaphore semaphore {0};
+	const SignalSet signalSet {1u << signalNumber};
+
+	PollEntry pollEntries[]
+	{
+			PollEntry{semaphore},
+			PollEntry{signalSet},
+	};
+	const PollEntriesRange pollEntriesRange {pollEntries};
+
+	if (tryPoll(pollEntriesRange) != PollResult{EAGAIN, 0})
+		return false;
+
+#if defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS > 0
+
+	// signal with default action would be ignored - set a handler and mask the signal, so it stays pending
+	const auto setSignalActionResult = ThisThread::Signals::setSignalAction(signalNumber,
+			SignalAction{abortSignalHandler, SignalSet{SignalSet::empty}});
+	if (setSignalActionResult.first != 0)
+		return false;
+
+	const auto signalMask = ThisThread::Signals::getSignalMask();
+	if (ThisThread::Signals::setSignalMask(SignalSet{signalMask.getBitset() | signalSet.getBitset()}) != 0)
+		return false;
+
+#endif	// defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS > 0
+
+	auto& mainThread = ThisThread::get();
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&mainThread]()
+			{
+				mainThread.generateSignal(signalNumber);
+			});
+
+	bool result {true};
+
+	if (testReadyFromInterrupt(pollEntriesRange, softwareTimer, 0b10,
+			[pollEntriesRange](const TickClock::time_point timePoint)
+			{
+				return tryPollUntil(pollEntriesRange, timePoint);
+			}) != true)
+		result = false;
+
+	// signal is not accepted by poll(), so it must be still pending
+	const auto ret = ThisThread::Signals::tryWait(signalSet);
+	if (ret.first != 0 || ret.second.getSignalNumber() != signalNumber)
+		result = false;
+
+#if defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS > 0
+
+	if (ThisThread::Signals::setSignalMask(signalMask) != 0 ||
+			ThisThread::Signals::setSignalAction(signalNumber, setSignalActionResult.second).first != 0)
+		return false;
+
+#endif	// defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS > 0
+
+	return result == true && tryPoll(pollEntriesRange) == PollResult{EAGAIN, 0};
+}
+
+#endif	// CONFIG_SIGNALS_ENABLE == 1 && CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS == 1
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool PollOperationsTestCase::run_() const
+{
+#if CONFIG_SIGNALS_ENABLE == 1 && CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS == 1
+	for (const auto& function : {phase1, phase2, phase3})
+#else	// CONFIG_SIGNALS_ENABLE != 1 || CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS != 1
+	for (const auto& function : {phase1, phase2})
+#endif	// CONFIG_SIGNALS_ENABLE != 1 || CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS != 1
+	{
+		waitForNextTick();
+		if (function() != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
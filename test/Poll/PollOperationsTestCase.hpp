@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief PollOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_POLL_POLLOPERATIONSTESTCASE_HPP_
+#define TEST_POLL_POLLOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests poll() operations.
+ *
+ * Tests checking of readiness of semaphores, queues, event flags and signals with tryPoll(), timeouts of tryPollFor()
+ * and tryPollUntil(), and unblocking of thread waiting in poll(), tryPollFor() and tryPollUntil() by objects made ready
+ * from interrupt context.
+ */
+
+class PollOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_POLL_POLLOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief pollTestCases object definition
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "pollTestCases.hpp"
+
+#include "PollOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// PollOperationsTestCase instance
+const PollOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to poll()
+const TestCaseGroup::Range::value_type pollTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup pollTestCases {TestCaseGroup::Range{pollTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
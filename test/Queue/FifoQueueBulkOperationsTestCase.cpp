@@ -0,0 +1,297 @@
+/**
+ * \file
+ * \brief FifoQueueBulkOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "FifoQueueBulkOperationsTestCase.hpp"
+
+#include "OperationCountingType.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// capacity of tested queues
+constexpr size_t queueSize {8};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread - higher than priority of test case
+constexpr uint8_t testThreadPriority {UINT8_MAX};
+
+/// number of elements pushed at once to the queue for which test thread waits
+constexpr size_t wakeUpElements {5};
+
+/// expected number of context switches in phase 3: main -> test thread -> main (test thread blocks on empty queue),
+/// main -> test thread -> main (test thread pops all pushed elements at once and terminates)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ContextSwitchCount {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements in tested raw queue
+using RawElement = uint32_t;
+
+/// raw queue used in tests
+using TestRawFifoQueue = StaticRawFifoQueue<sizeof(RawElement), queueSize>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether elements have consecutive values.
+ *
+ * \param [in] elements is a pointer to array with elements
+ * \param [in] count is the number of elements in \a elements array
+ * \param [in] first is the expected value of first element
+ *
+ * \return true if elements have consecutive values starting from \a first, false otherwise
+ */
+
+bool checkValues(const RawElement* const elements, const size_t count, const RawElement first)
+{
+	for (size_t i {}; i < count; ++i)
+		if (elements[i] != first + i)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests pushing and popping of many elements to/from RawFifoQueue without blocking - number of transferred elements,
+ * their order (also across the wrap point of storage) and returned error codes.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestRawFifoQueue queue;
+	RawElement input[queueSize * 2];
+	for (size_t i {}; i < sizeof(input) / sizeof(*input); ++i)
+		input[i] = i + 1;
+	RawElement output[queueSize * 2] {};
+
+	{
+		const auto ret = queue.tryPopMany(output, sizeof(output));
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushMany(input, sizeof(*input) + 1);
+		if (ret.first != EMSGSIZE || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopMany(output, sizeof(*output) - 1);
+		if (ret.first != EMSGSIZE || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.pushMany(input, sizeof(input));	// only first queueSize elements fit
+		if (ret.first != 0 || ret.second != queueSize)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushMany(input, sizeof(input));
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushManyFor(singleDuration, input, sizeof(input));
+		if (ret.first != ETIMEDOUT || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.popMany(output, sizeof(*output) * 3);
+		if (ret.first != 0 || ret.second != 3 || checkValues(output, 3, 1) != true)
+			return false;
+	}
+	{
+		// 3 free slots at the beginning of storage, write position is already wrapped
+		const auto ret = queue.tryPushManyUntil(TickClock::now() + singleDuration, input + queueSize,
+				sizeof(input) - sizeof(*input) * queueSize);
+		if (ret.first != 0 || ret.second != 3)
+			return false;
+	}
+	{
+		// elements from the end and from the beginning of storage are popped in one call
+		const auto ret = queue.tryPopManyFor(singleDuration, output, sizeof(output));
+		if (ret.first != 0 || ret.second != queueSize || checkValues(output, queueSize, 4) != true)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopManyUntil(TickClock::now() + singleDuration, output, sizeof(output));
+		if (ret.first != ETIMEDOUT || ret.second != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests pushing and popping of many elements to/from FifoQueue - number of transferred elements, their order (also
+ * across the wrap point of storage) and actions executed on transferred objects.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	constexpr size_t smallQueueSize {4};
+	StaticFifoQueue<OperationCountingType, smallQueueSize> queue;
+	const OperationCountingType input[]
+	{
+			OperationCountingType{1}, OperationCountingType{2}, OperationCountingType{3}, OperationCountingType{4},
+			OperationCountingType{5}, OperationCountingType{6},
+	};
+	constexpr size_t inputSize {sizeof(input) / sizeof(*input)};
+	OperationCountingType output[3];
+	constexpr size_t outputSize {sizeof(output) / sizeof(*output)};
+
+	{
+		OperationCountingType::resetCounters();
+		const auto ret = queue.pushMany(input, inputSize);
+		if (ret.first != 0 || ret.second != smallQueueSize ||
+				OperationCountingType::checkCounters(0, smallQueueSize, 0, 0, 0, 0, 0) != true)
+			return false;
+	}
+	{
+		OperationCountingType::resetCounters();
+		const auto ret = queue.tryPushMany(input, inputSize);
+		if (ret.first != EAGAIN || ret.second != 0 || OperationCountingType::checkCounters(0, 0, 0, 0, 0, 0, 0) != true)
+			return false;
+	}
+	{
+		OperationCountingType::resetCounters();
+		const auto ret = queue.popMany(output, outputSize);
+		if (ret.first != 0 || ret.second != outputSize ||
+				OperationCountingType::checkCounters(0, 0, 0, outputSize, 0, 0, outputSize) != true)
+			return false;
+		for (size_t i {}; i < outputSize; ++i)
+			if (output[i].getValue() != i + 1)
+				return false;
+	}
+	{
+		OperationCountingType::resetCounters();
+		const auto ret = queue.tryPushMany(input + smallQueueSize, inputSize - smallQueueSize);
+		if (ret.first != 0 || ret.second != inputSize - smallQueueSize ||
+				OperationCountingType::checkCounters(0, inputSize - smallQueueSize, 0, 0, 0, 0, 0) != true)
+			return false;
+	}
+	{
+		// elements from the end and from the beginning of storage are popped in one call
+		OperationCountingType::resetCounters();
+		const auto ret = queue.tryPopMany(output, outputSize);
+		if (ret.first != 0 || ret.second != outputSize ||
+				OperationCountingType::checkCounters(0, 0, 0, outputSize, 0, 0, outputSize) != true)
+			return false;
+		for (size_t i {}; i < outputSize; ++i)
+			if (output[i].getValue() != outputSize + i + 1)
+				return false;
+	}
+	{
+		OperationCountingType::resetCounters();
+		const auto ret = queue.tryPopManyFor(singleDuration, output, outputSize);
+		if (ret.first != ETIMEDOUT || ret.second != 0 ||
+				OperationCountingType::checkCounters(0, 0, 0, 0, 0, 0, 0) != true)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether thread waiting in RawFifoQueue::popMany() is woken only once when many elements are pushed with
+ * RawFifoQueue::pushMany() and whether it receives all of them in one call.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestRawFifoQueue queue;
+	RawElement output[queueSize] {};
+	std::pair<int, size_t> popRet {-1, {}};
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	auto thread = makeAndStartStaticThread<testThreadStackSize>(testThreadPriority,
+			[&queue, &output, &popRet]()
+			{
+				popRet = queue.popMany(output, sizeof(output));
+			});
+
+	RawElement input[wakeUpElements];
+	for (size_t i {}; i < wakeUpElements; ++i)
+		input[i] = i + 1;
+
+	const auto pushRet = queue.pushMany(input, sizeof(input));
+	thread.join();
+
+	if (pushRet.first != 0 || pushRet.second != wakeUpElements)
+		return false;
+	if (popRet.first != 0 || popRet.second != wakeUpElements || checkValues(output, wakeUpElements, 1) != true)
+		return false;
+	if (statistics::getContextSwitchCount() - contextSwitchCount != phase3ContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool FifoQueueBulkOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		waitForNextTick();
+		if (function() != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
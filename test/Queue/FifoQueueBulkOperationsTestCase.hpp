@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief FifoQueueBulkOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_FIFOQUEUEBULKOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_FIFOQUEUEBULKOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests bulk operations of [Raw]FifoQueue.
+ *
+ * Tests pushing (pushMany(), tryPushMany(), tryPushManyFor() and tryPushManyUntil()) and popping (popMany(),
+ * tryPopMany(), tryPopManyFor() and tryPopManyUntil()) of many elements to/from [Raw]FifoQueue - these operations must
+ * transfer expected number of elements in expected order (also across the wrap point of storage), execute expected
+ * actions on transferred objects, return expected error codes and wake the thread waiting for the queue only once per
+ * operation.
+ */
+
+class FifoQueueBulkOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief FifoQueueBulkOperationsTestCase's constructor
+	 */
+
+	constexpr FifoQueueBulkOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_FIFOQUEUEBULKOPERATIONSTESTCASE_HPP_
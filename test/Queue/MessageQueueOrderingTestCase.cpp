@@ -0,0 +1,170 @@
+/**
+ * \file
+ * \brief MessageQueueOrderingTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MessageQueueOrderingTestCase.hpp"
+
+#include "distortos/StaticRawMessageQueue.hpp"
+
+#include <utility>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// capacity of tested queue
+constexpr size_t queueSize {64};
+
+/// priorities of pushed elements, including both sides of boundaries of words used by priority bitmap
+constexpr uint8_t priorities[] {0, 1, 31, 32, 33, 63, 64, 100, 127, 128, 200, 223, 224, 254, 255};
+
+/// priorities of elements pushed to empty queue before other steps of test - each element is placed in an empty bucket,
+/// while the closest non-empty bucket with higher priority is in the same word of priority bitmap, in another word or
+/// doesn't exist
+constexpr uint8_t emptyBucketPriorities[] {100, 0, 255, 31, 32, 224, 223, 1, 254, 63, 64};
+
+/// number of elements pushed in each step of test, 0 for pop of all elements
+constexpr size_t steps[] {queueSize - 16, queueSize / 2, 0, queueSize / 4, queueSize + queueSize / 2, 0};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// element of queue - sequence number
+using Element = uint16_t;
+
+/// pair with priority and element
+using Item = std::pair<uint8_t, Element>;
+
+/// tested queue
+using TestQueue = StaticRawMessageQueue<sizeof(Element), queueSize>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Inserts item to reference model of message queue.
+ *
+ * Item is placed after all items with equal or higher priority.
+ *
+ * \param [in,out] items is an array with reference model of message queue
+ * \param [in] size is the number of items in \a items array
+ * \param [in] item is the item that will be inserted
+ */
+
+void insert(Item* const items, const size_t size, const Item item)
+{
+	size_t i {size};
+	for (; i > 0 && items[i - 1].first < item.first; --i)
+		items[i] = items[i - 1];
+	items[i] = item;
+}
+
+/**
+ * \brief Pops elements from the queue and compares them with reference model.
+ *
+ * \param [in] queue is a reference to tested queue
+ * \param [in,out] items is an array with reference model of message queue
+ * \param [in,out] size is a reference to the number of items in \a items array
+ * \param [in] count is the number of elements that will be popped
+ *
+ * \return true if popped elements have expected priorities and values, false otherwise
+ */
+
+bool pop(TestQueue& queue, Item* const items, size_t& size, const size_t count)
+{
+	for (size_t i {}; i < count; ++i)
+	{
+		uint8_t priority {};
+		Element element {};
+		if (queue.tryPop(priority, element) != 0 || priority != items[i].first || element != items[i].second)
+			return false;
+	}
+
+	for (size_t i {count}; i < size; ++i)
+		items[i - count] = items[i];
+	size -= count;
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MessageQueueOrderingTestCase::run_() const
+{
+	TestQueue queue;
+	Item items[queueSize] {};
+	size_t size {};
+	Element sequenceNumber {};
+
+	for (const auto priority : emptyBucketPriorities)
+	{
+		if (queue.tryPush(priority, sequenceNumber) != 0)
+			return false;
+		insert(items, size, {priority, sequenceNumber});
+		++size;
+		++sequenceNumber;
+	}
+
+	if (pop(queue, items, size, size) != true)
+		return false;
+
+	for (const auto step : steps)
+	{
+		if (step == 0)
+		{
+			if (pop(queue, items, size, size) != true)
+				return false;
+
+			uint8_t priority {};
+			Element element {};
+			if (queue.tryPop(priority, element) != EAGAIN)
+				return false;
+
+			continue;
+		}
+
+		// when the queue is full, each push is preceded by a pop
+		for (size_t i {}; i < step; ++i)
+		{
+			if (size == queueSize && pop(queue, items, size, 1) != true)
+				return false;
+
+			// scrambled order of priorities, each one is repeated many times
+			const auto priority = priorities[(sequenceNumber * 7u) % (sizeof(priorities) / sizeof(*priorities))];
+			if (queue.tryPush(priority, sequenceNumber) != 0)
+				return false;
+			insert(items, size, {priority, sequenceNumber});
+			++size;
+			++sequenceNumber;
+		}
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
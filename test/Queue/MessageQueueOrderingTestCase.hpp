@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief MessageQueueOrderingTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_MESSAGEQUEUEORDERINGTESTCASE_HPP_
+#define TEST_QUEUE_MESSAGEQUEUEORDERINGTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests order of elements in RawMessageQueue.
+ *
+ * Elements with priorities from the whole range (also on both sides of boundaries of words used by priority bitmap) are
+ * pushed in scrambled order, interleaved with pops. First elements are pushed to empty buckets, so that the closest
+ * non-empty bucket with higher priority is found in the same word of priority bitmap, in another word or not at all.
+ * Popped elements must have the order of a reference model - highest priority first, FIFO order for elements with
+ * equal priority.
+ */
+
+class MessageQueueOrderingTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief MessageQueueOrderingTestCase's constructor
+	 */
+
+	constexpr MessageQueueOrderingTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_MESSAGEQUEUEORDERINGTESTCASE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueuePriorityTestCase class implementation
  *
- * \author Copyright (C) 2016-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2016-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
@@ -20,8 +21,6 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -102,7 +101,7 @@ bool popFinalCheck(const QueueWrapper& queueWrapper)
 void popPrepare(const QueueWrapper& queueWrapper)
 {
 	for (size_t i = 0; i < totalThreads; ++i)
-		queueWrapper.tryPush(i, OperationCountingType{i});
+		queueWrapper.tryPush(i, OperationCountingType{static_cast<OperationCountingType::Value>(i)});
 }
 
 /**
@@ -177,7 +176,8 @@ void pushThread(SequenceAsserter& sequenceAsserter, const SequencePoints sequenc
 
 bool pushTrigger(const QueueWrapper& queueWrapper, size_t, const ThreadParameters& threadParameters)
 {
-	queueWrapper.push(threadParameters.first, OperationCountingType{totalThreads + threadParameters.second});
+	queueWrapper.push(threadParameters.first,
+			OperationCountingType{static_cast<OperationCountingType::Value>(totalThreads + threadParameters.second)});
 	return true;
 }
 
@@ -221,7 +221,7 @@ const std::array<Stage, 2> stages
 
 bool MessageQueuePriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 	std::remove_const<decltype(contextSwitchCount)>::type expectedContextSwitchCount {};
 	constexpr size_t messageQueueTypes {4};
@@ -305,7 +305,7 @@ bool MessageQueuePriorityTestCase::run_() const
 					}
 
 					// dynamic memory must be deallocated after each test phase
-					if (mallinfo().uordblks != allocatedMemory)
+					if (getAllocatedMemory() != allocatedMemory)
 						return false;
 				}
 
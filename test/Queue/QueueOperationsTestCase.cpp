@@ -2,7 +2,7 @@
  * \file
  * \brief QueueOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,13 +13,12 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/statistics.hpp"
 
-#include <malloc.h>
-
 #include <cerrno>
 
 namespace distortos
@@ -1185,7 +1184,7 @@ bool QueueOperationsTestCase::run_() const
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
 			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
 	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6})
@@ -1194,7 +1193,7 @@ bool QueueOperationsTestCase::run_() const
 		if (ret != true)
 			return ret;
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -0,0 +1,314 @@
+/**
+ * \file
+ * \brief RawQueueZeroCopyOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RawQueueZeroCopyOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// capacity of tested queues
+constexpr size_t queueSize {4};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread - higher than priority of test case
+constexpr uint8_t testThreadPriority {UINT8_MAX};
+
+/// expected number of context switches in phase 3: main -> test thread -> main (test thread blocks on empty queue),
+/// main -> test thread -> main (test thread is woken by commit() and terminates)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ContextSwitchCount {4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements in tested queues
+using Element = uint32_t;
+
+/// raw FIFO queue used in tests
+using TestRawFifoQueue = StaticRawFifoQueue<sizeof(Element), queueSize>;
+
+/// raw message queue used in tests
+using TestRawMessageQueue = StaticRawMessageQueue<sizeof(Element), queueSize>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests zero-copy operations of RawFifoQueue - reserved slots must become available only when all of them are
+ * committed, order of elements pushed with push() and reserve() must be preserved, peeked slots must become free only
+ * when all of them are released.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestRawFifoQueue queue;
+
+	if (queue.commit() != EPERM || queue.release() != EPERM)
+		return false;
+
+	{
+		const void* storage {};
+		if (queue.tryPeek(storage) != EAGAIN)
+			return false;
+	}
+	{
+		void* storage {};
+		if (queue.reserve(storage) != 0 || storage == nullptr)
+			return false;
+		*static_cast<Element*>(storage) = 1;
+
+		// element pushed after reservation must not be available before reserved slot is committed
+		Element element {2};
+		const void* peekedStorage {};
+		if (queue.tryPush(element) != 0 || queue.tryPeek(peekedStorage) != EAGAIN || queue.tryPop(element) != EAGAIN)
+			return false;
+
+		if (queue.commit() != 0)
+			return false;
+
+		// peeked element is accessed directly in the storage of the queue
+		if (queue.tryPeek(peekedStorage) != 0 || peekedStorage != storage ||
+				*static_cast<const Element*>(peekedStorage) != 1 || queue.release() != 0)
+			return false;
+		if (queue.tryPop(element) != 0 || element != 2)
+			return false;
+	}
+	{
+		void* storages[queueSize] {};
+		for (auto& storage : storages)
+			if (queue.tryReserve(storage) != 0)
+				return false;
+
+		{
+			void* storage {};
+			if (queue.tryReserve(storage) != EAGAIN)
+				return false;
+		}
+
+		// slots may be filled in any order, elements become available when the last reserved slot is committed
+		for (size_t i {queueSize}; i > 0; --i)
+		{
+			const void* storage {};
+			if (queue.tryPeek(storage) != EAGAIN)
+				return false;
+			*static_cast<Element*>(storages[i - 1]) = i + 2;
+			if (queue.commit() != 0)
+				return false;
+		}
+
+		const void* peekedStorages[queueSize] {};
+		for (size_t i {}; i < queueSize; ++i)
+			if (queue.tryPeek(peekedStorages[i]) != 0 || peekedStorages[i] != storages[i] ||
+					*static_cast<const Element*>(peekedStorages[i]) != i + 3)
+				return false;
+
+		// slot becomes free only when all peeked slots are released
+		if (queue.release() != 0)
+			return false;
+		{
+			void* storage {};
+			if (queue.tryReserve(storage) != EAGAIN)
+				return false;
+		}
+		for (size_t i {1}; i < queueSize; ++i)
+			if (queue.release() != 0)
+				return false;
+
+		Element element {};
+		for (size_t i {}; i < queueSize; ++i)
+			if (queue.tryPush(element) != 0)
+				return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests zero-copy operations of RawMessageQueue - committed elements must be peeked in the order of priority, pointers
+ * which don't point to slots of the queue must be rejected, committing slots which are not reserved and releasing slots
+ * which are not peeked must be rejected, slots must become free when they are released.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	TestRawMessageQueue queue;
+
+	{
+		Element element {};
+		if (queue.commit(0, &element) != EINVAL || queue.release(&element) != EINVAL)
+			return false;
+	}
+	{
+		uint8_t priority {};
+		const void* storage {};
+		if (queue.tryPeek(priority, storage) != EAGAIN)
+			return false;
+	}
+
+	constexpr uint8_t priorities[] {2, 3, 1};
+	constexpr size_t elements {sizeof(priorities) / sizeof(*priorities)};
+	void* storages[elements] {};
+	for (size_t i {}; i < elements; ++i)
+	{
+		if (queue.tryReserve(storages[i]) != 0)
+			return false;
+		*static_cast<Element*>(storages[i]) = priorities[i];
+	}
+
+	{
+		// element in reserved slot is not available before it is committed
+		uint8_t priority {};
+		const void* storage {};
+		if (queue.tryPeek(priority, storage) != EAGAIN)
+			return false;
+	}
+
+	// slots may be committed in any order
+	for (size_t i {elements}; i > 0; --i)
+		if (queue.commit(priorities[i - 1], storages[i - 1]) != 0)
+			return false;
+
+	// committed slot is no longer reserved and it was not peeked
+	if (queue.commit(0, storages[0]) != EPERM || queue.release(storages[0]) != EPERM)
+		return false;
+
+	const void* peekedStorages[elements - 1] {};
+	for (size_t i {}; i < elements - 1; ++i)
+	{
+		uint8_t priority {};
+		if (queue.tryPeek(priority, peekedStorages[i]) != 0 || priority != elements - i ||
+				*static_cast<const Element*>(peekedStorages[i]) != priority)
+			return false;
+	}
+	if (peekedStorages[0] != storages[1] || peekedStorages[1] != storages[0])
+		return false;
+
+	// peeked slot is not reserved
+	if (queue.commit(0, storages[1]) != EPERM)
+		return false;
+
+	{
+		uint8_t priority {};
+		Element element {};
+		if (queue.tryPop(priority, element) != 0 || priority != 1 || element != 1)
+			return false;
+	}
+
+	// slot of popped element is free - it is neither reserved nor peeked
+	if (queue.commit(0, storages[2]) != EPERM || queue.release(storages[2]) != EPERM)
+		return false;
+
+	// queue has free slots for all elements that were not peeked
+	void* storage {};
+	for (size_t i {}; i < queueSize - (elements - 1); ++i)
+		if (queue.tryReserve(storage) != 0)
+			return false;
+	if (queue.tryReserve(storage) != EAGAIN)
+		return false;
+
+	for (const auto peekedStorage : peekedStorages)
+		if (queue.release(peekedStorage) != 0 || queue.release(peekedStorage) != EPERM ||
+				queue.tryReserve(storage) != 0)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether thread waiting in RawFifoQueue::pop() is woken by RawFifoQueue::commit() and not by
+ * RawFifoQueue::reserve().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestRawFifoQueue queue;
+	Element element {};
+	int popRet {-1};
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	auto thread = makeAndStartStaticThread<testThreadStackSize>(testThreadPriority,
+			[&queue, &element, &popRet]()
+			{
+				popRet = queue.pop(element);
+			});
+
+	void* storage {};
+	const auto reserveRet = queue.reserve(storage);
+	*static_cast<Element*>(storage) = 0x12345678;
+	const auto popRetAfterReserve = popRet;
+
+	const auto commitRet = queue.commit();
+	thread.join();
+
+	if (reserveRet != 0 || popRetAfterReserve != -1 || commitRet != 0 || popRet != 0 || element != 0x12345678)
+		return false;
+	if (statistics::getContextSwitchCount() - contextSwitchCount != phase3ContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RawQueueZeroCopyOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		waitForNextTick();
+		if (function() != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
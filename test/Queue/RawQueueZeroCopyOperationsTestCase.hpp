@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief RawQueueZeroCopyOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_RAWQUEUEZEROCOPYOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_RAWQUEUEZEROCOPYOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests zero-copy operations of RawFifoQueue and RawMessageQueue.
+ *
+ * Tests reserving and committing of slots (reserve() and commit()) and peeking and releasing of elements (peek() and
+ * release()) - elements must be accessed directly in the storage of the queue, must become available only after they
+ * are committed, must be popped in expected order (also when mixed with regular push and pop operations) and slots
+ * must become free only after they are released. Tests whether thread waiting for the queue is woken by commit() and
+ * not by reserve().
+ */
+
+class RawQueueZeroCopyOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief RawQueueZeroCopyOperationsTestCase's constructor
+	 */
+
+	constexpr RawQueueZeroCopyOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_RAWQUEUEZEROCOPYOPERATIONSTESTCASE_HPP_
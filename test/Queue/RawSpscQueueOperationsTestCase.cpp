@@ -0,0 +1,276 @@
+/**
+ * \file
+ * \brief RawSpscQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RawSpscQueueOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticRawSpscQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 3;
+
+/// capacity of tested queues
+constexpr size_t queueSize {8};
+
+/// wake threshold of queue used in phase 3
+constexpr size_t phase3WakeThreshold {4};
+
+/// expected number of context switches in phase 3: main thread blocks on empty queue (main -> idle), main thread is
+/// woken when wake threshold is reached (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3ContextSwitchCount {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements in tested queue
+using Element = uint32_t;
+
+/// tested queue
+using TestQueue = StaticRawSpscQueue<sizeof(Element), queueSize>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether elements have consecutive values.
+ *
+ * \param [in] elements is a pointer to array with elements
+ * \param [in] count is the number of elements in \a elements array
+ * \param [in] first is the expected value of first element
+ *
+ * \return true if elements have consecutive values starting from \a first, false otherwise
+ */
+
+bool checkValues(const Element* const elements, const size_t count, const Element first)
+{
+	for (size_t i {}; i < count; ++i)
+		if (elements[i] != first + i)
+			return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests pushing and popping of single and many elements to/from RawSpscQueue without blocking - number of transferred
+ * elements, their order (also across the wrap point of storage) and returned error codes.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	TestQueue queue;
+	Element input[queueSize * 2];
+	for (size_t i {}; i < sizeof(input) / sizeof(*input); ++i)
+		input[i] = i + 1;
+	Element output[queueSize * 2] {};
+
+	{
+		Element element {};
+		if (queue.tryPop(element) != EAGAIN)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopMany(output, sizeof(output));
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+	{
+		if (queue.tryPush(input, sizeof(*input) + 1) != EMSGSIZE)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushMany(input, sizeof(*input) + 1);
+		if (ret.first != EMSGSIZE || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPopMany(output, sizeof(*output) - 1);
+		if (ret.first != EMSGSIZE || ret.second != 0)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushMany(input, sizeof(input));	// only first queueSize elements fit
+		if (ret.first != 0 || ret.second != queueSize)
+			return false;
+	}
+	{
+		if (queue.tryPush(input[0]) != EAGAIN)
+			return false;
+	}
+	{
+		const auto ret = queue.tryPushMany(input, sizeof(input));
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+	{
+		// queue is not empty, so pop() doesn't block
+		Element element {};
+		if (queue.pop(element) != 0 || element != 1)
+			return false;
+	}
+	{
+		const auto ret = queue.popMany(output, sizeof(*output) * 2);
+		if (ret.first != 0 || ret.second != 2 || checkValues(output, 2, 2) != true)
+			return false;
+	}
+	{
+		// elements are stored at the end and at the beginning of storage, only 3 free slots are available
+		const auto ret = queue.tryPushMany(input + queueSize, sizeof(*input) * 4);
+		if (ret.first != 0 || ret.second != 3)
+			return false;
+	}
+	{
+		// elements from the end and from the beginning of storage are popped in one call
+		const auto ret = queue.tryPopMany(output, sizeof(output));
+		if (ret.first != 0 || ret.second != queueSize || checkValues(output, queueSize, 4) != true)
+			return false;
+	}
+	{
+		Element element {};
+		if (queue.tryPop(element) != EAGAIN)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests timeouts of pop operations - on empty queue they must time-out at expected time, while element pushed below
+ * wake threshold must not wake the consumer but must be popped when the timeout expires.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	{
+		TestQueue queue;
+		Element element {};
+		const auto start = TickClock::now();
+		const auto ret = queue.tryPopFor(singleDuration, element);
+		if (ret != ETIMEDOUT || TickClock::now() - start != singleDuration + decltype(singleDuration){1})
+			return false;
+	}
+	{
+		waitForNextTick();
+
+		TestQueue queue;
+		Element output[queueSize] {};
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = queue.tryPopManyUntil(requestedTimePoint, output, sizeof(output));
+		if (ret.first != ETIMEDOUT || ret.second != 0 || requestedTimePoint != TickClock::now())
+			return false;
+	}
+	{
+		waitForNextTick();
+
+		TestQueue queue {queueSize};
+		constexpr Element value {0x1234};
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&queue, value]()
+				{
+					queue.tryPush(value);
+				});
+		softwareTimer.start(singleDuration);
+
+		Element output[queueSize] {};
+		const auto requestedTimePoint = TickClock::now() + longDuration;
+		const auto ret = queue.tryPopManyUntil(requestedTimePoint, output, sizeof(output));
+		if (ret.first != 0 || ret.second != 1 || output[0] != value || requestedTimePoint != TickClock::now())
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether thread waiting in RawSpscQueue::popMany() for elements pushed one by one from interrupt context is
+ * woken only once, when wake threshold is reached, and whether it receives all of these elements in one call.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	TestQueue queue {phase3WakeThreshold};
+	Element value {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&queue, &value]()
+			{
+				queue.tryPush(++value);
+			});
+
+	const auto contextSwitchCount = statistics::getContextSwitchCount();
+
+	softwareTimer.start(singleDuration, singleDuration);
+	Element output[queueSize] {};
+	const auto ret = queue.popMany(output, sizeof(output));
+	softwareTimer.stop();
+
+	if (ret.first != 0 || ret.second != phase3WakeThreshold || checkValues(output, phase3WakeThreshold, 1) != true)
+		return false;
+	if (statistics::getContextSwitchCount() - contextSwitchCount != phase3ContextSwitchCount)
+		return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RawSpscQueueOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		waitForNextTick();
+		if (function() != true)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief RawSpscQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_RAWSPSCQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_RAWSPSCQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various RawSpscQueue operations.
+ *
+ * Tests pushing and popping of single and many elements to/from RawSpscQueue - these operations must transfer expected
+ * number of elements in expected order (also across the wrap point of storage) and return expected error codes. Tests
+ * timeouts of pop operations, including popping of elements available when the timeout expires. Tests whether consumer
+ * waiting for elements pushed from interrupt context is woken only once, when wake threshold is reached.
+ */
+
+class RawSpscQueueOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief RawSpscQueueOperationsTestCase's constructor
+	 */
+
+	constexpr RawSpscQueueOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_RAWSPSCQUEUEOPERATIONSTESTCASE_HPP_
@@ -8,8 +8,12 @@
 #
 
 target_sources(distortosTest PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/FifoQueueBulkOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/FifoQueuePriorityTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/MessageQueueOrderingTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/MessageQueuePriorityTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/QueueOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/queueTestCases.cpp
-		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp)
+		${CMAKE_CURRENT_LIST_DIR}/QueueWrappers.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RawQueueZeroCopyOperationsTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/RawSpscQueueOperationsTestCase.cpp)
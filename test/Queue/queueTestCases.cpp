@@ -2,7 +2,7 @@
  * \file
  * \brief queueTestCases object definition
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,8 +12,12 @@
 #include "queueTestCases.hpp"
 
 #include "QueueOperationsTestCase.hpp"
+#include "FifoQueueBulkOperationsTestCase.hpp"
 #include "FifoQueuePriorityTestCase.hpp"
+#include "MessageQueueOrderingTestCase.hpp"
 #include "MessageQueuePriorityTestCase.hpp"
+#include "RawQueueZeroCopyOperationsTestCase.hpp"
+#include "RawSpscQueueOperationsTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -39,12 +43,28 @@ const FifoQueuePriorityTestCase fifoQueuePriorityTestCase;
 /// MessageQueuePriorityTestCase instance
 const MessageQueuePriorityTestCase messageQueuePriorityTestCase;
 
+/// FifoQueueBulkOperationsTestCase instance
+const FifoQueueBulkOperationsTestCase fifoQueueBulkOperationsTestCase;
+
+/// RawSpscQueueOperationsTestCase instance
+const RawSpscQueueOperationsTestCase rawSpscQueueOperationsTestCase;
+
+/// RawQueueZeroCopyOperationsTestCase instance
+const RawQueueZeroCopyOperationsTestCase rawQueueZeroCopyOperationsTestCase;
+
+/// MessageQueueOrderingTestCase instance
+const MessageQueueOrderingTestCase messageQueueOrderingTestCase;
+
 /// array with references to TestCase objects related to queue
 const TestCaseGroup::Range::value_type queueTestCases_[]
 {
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{fifoQueuePriorityTestCase},
 		TestCaseGroup::Range::value_type{messageQueuePriorityTestCase},
+		TestCaseGroup::Range::value_type{fifoQueueBulkOperationsTestCase},
+		TestCaseGroup::Range::value_type{rawSpscQueueOperationsTestCase},
+		TestCaseGroup::Range::value_type{rawQueueZeroCopyOperationsTestCase},
+		TestCaseGroup::Range::value_type{messageQueueOrderingTestCase},
 };
 
 }	// namespace
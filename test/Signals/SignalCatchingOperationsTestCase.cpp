@@ -2,7 +2,7 @@
  * \file
  * \brief SignalCatchingOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -95,7 +95,7 @@ bool phase1()
 		{
 			// last iteration? clip the value so that it is identical to the one from previous iteration
 			const auto realMask = mask <= mainThreadSignalActions ? mask : mainThreadSignalActions;
-			const SignalSet signalMask {((realMask + signalNumber) % mainThreadSignalActions)};
+			const SignalSet signalMask {static_cast<uint32_t>((realMask + signalNumber) % mainThreadSignalActions)};
 			const auto setSignalActionResult = ThisThread::Signals::setSignalAction(signalNumber,
 					{abortSignalHandler, signalMask});
 			if (setSignalActionResult.first != 0)
@@ -107,7 +107,8 @@ bool phase1()
 			}
 			else	// compare returned signal action with the expected one
 			{
-				const SignalSet previousSignalMask {((mask - 1 + signalNumber) % mainThreadSignalActions)};
+				const SignalSet previousSignalMask {
+						static_cast<uint32_t>((mask - 1 + signalNumber) % mainThreadSignalActions)};
 				if (setSignalActionResult.second.getHandler() != abortSignalHandler ||
 						setSignalActionResult.second.getSignalMask().getBitset() != previousSignalMask.getBitset())
 					return false;
@@ -250,6 +251,7 @@ bool phase3()
 		testThread.join();
 		stackSize = testThread.getStackHighWaterMark();
 	}
+#ifndef CONFIG_ARCHITECTURE_POSIX
 	{
 		auto testThread = makeAndStartDynamicThread({stackSize, true, 1, 1, UINT8_MAX}, testThreadLambda);
 		const auto ret1 = testThread.generateSignal(testSignalNumber);
@@ -260,6 +262,11 @@ bool phase3()
 		if (testThread.getPendingSignalSet().getBitset().none() == false)	// no signals may be pending
 			return false;
 	}
+#else	// def CONFIG_ARCHITECTURE_POSIX
+	// CONFIG_ARCHITECTURE_STACK_OVERHEAD is added to each requested stack size, so a stack with size equal to the high
+	// water mark always has enough free space to request signal delivery
+	(void)stackSize;
+#endif	// def CONFIG_ARCHITECTURE_POSIX
 
 	return true;
 }
@@ -278,7 +285,11 @@ bool SignalCatchingOperationsTestCase::run_() const
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
+#ifndef CONFIG_ARCHITECTURE_POSIX
 	constexpr auto phase3ExpectedContextSwitchCount = 2 * phase3ThreadContextSwitchCount;
+#else	// def CONFIG_ARCHITECTURE_POSIX
+	constexpr auto phase3ExpectedContextSwitchCount = phase3ThreadContextSwitchCount;
+#endif	// def CONFIG_ARCHITECTURE_POSIX
 
 #if SIGNAL_CATCHING_OPERATIONS_TEST_CASE_PHASE_1_2_ENABLED == 1
 	constexpr auto phase2ExpectedContextSwitchCount = 2 * phase2ThreadContextSwitchCount;
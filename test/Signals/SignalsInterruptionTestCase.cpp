@@ -190,7 +190,9 @@ private:
 	void signalingThreadFunction(SequenceAsserter& sequenceAsserter, Thread& thread) const
 	{
 		sequenceAsserter.sequencePoint(signalingThreadSequencePoint1_);
-		thread.queueSignal(signalHandlerSequencePoint_, sigval{reinterpret_cast<int>(&sequenceAsserter)});
+		sigval value {};
+		value.sival_ptr = &sequenceAsserter;
+		thread.queueSignal(signalHandlerSequencePoint_, value);
 		sequenceAsserter.sequencePoint(signalingThreadSequencePoint2_);
 	}
 
@@ -0,0 +1,148 @@
+/**
+ * \file
+ * \brief SoftwareTimerExpirationTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerExpirationTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "SequenceAsserter.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// pair with duration of software timer (ticks) and its expected sequence point
+using Parameters = std::pair<TickClock::rep, unsigned int>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// parameters of software timers, in the order in which they are started
+const Parameters parameters[]
+{
+		{1025, 7},
+		{32, 3},
+		{1, 0},
+		{1100, 9},
+		{1023, 5},
+		{33, 4},
+		{1025, 8},
+		{2, 1},
+		{1024, 6},
+		{31, 2},
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by software timers during the test case.
+ *
+ * Marks the sequence point in SequenceAsserter and checks whether the function is executed at expected time point.
+ *
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] sequencePoint is the sequence point of this instance
+ * \param [in] timePoint is the time point at which this function is expected to be executed
+ * \param [out] timePointsMatched is a reference to variable which will be set to false if this function is not executed
+ * at \a timePoint
+ */
+
+void softwareTimerFunction(SequenceAsserter& sequenceAsserter, const unsigned int sequencePoint,
+		const TickClock::time_point timePoint, bool& timePointsMatched)
+{
+	sequenceAsserter.sequencePoint(sequencePoint);
+	if (TickClock::now() != timePoint)
+		timePointsMatched = false;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerExpirationTestCase::run_() const
+{
+	constexpr auto totalSoftwareTimers = sizeof(parameters) / sizeof(*parameters);
+
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		SequenceAsserter sequenceAsserter;
+		bool timePointsMatched {true};
+
+		waitForNextTick();
+		const auto start = TickClock::now();
+
+		std::array<DynamicSoftwareTimer, totalSoftwareTimers> softwareTimers
+		{{
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[0].second,
+						start + TickClock::duration{parameters[0].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[1].second,
+						start + TickClock::duration{parameters[1].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[2].second,
+						start + TickClock::duration{parameters[2].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[3].second,
+						start + TickClock::duration{parameters[3].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[4].second,
+						start + TickClock::duration{parameters[4].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[5].second,
+						start + TickClock::duration{parameters[5].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[6].second,
+						start + TickClock::duration{parameters[6].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[7].second,
+						start + TickClock::duration{parameters[7].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[8].second,
+						start + TickClock::duration{parameters[8].first}, std::ref(timePointsMatched)},
+				{softwareTimerFunction, std::ref(sequenceAsserter), parameters[9].second,
+						start + TickClock::duration{parameters[9].first}, std::ref(timePointsMatched)},
+		}};
+
+		for (size_t i {}; i < softwareTimers.size(); ++i)
+			softwareTimers[i].start(start + TickClock::duration{parameters[i].first});
+
+		if (sequenceAsserter.assertSequence(0) == false)
+			return false;
+
+		for (const auto& softwareTimer : softwareTimers)
+			while (softwareTimer.isRunning() == true)
+				ThisThread::sleepFor(TickClock::duration{1});
+
+		if (sequenceAsserter.assertSequence(totalSoftwareTimers) == false)
+			return false;
+
+		if (timePointsMatched == false)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after test
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
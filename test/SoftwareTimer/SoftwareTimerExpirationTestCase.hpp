@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief SoftwareTimerExpirationTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMEREXPIRATIONTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMEREXPIRATIONTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests expiration of software timers with a wide range of durations.
+ *
+ * Starts 10 software timers in random order, with durations from 1 to 1100 ticks - crossing boundaries between
+ * "levels" of timing wheel, with two timers that expire at the same time point. Asserts that all timers execute in
+ * expected sequence (timers with equal time point in the order in which they were started) and exactly at their time
+ * points.
+ */
+
+class SoftwareTimerExpirationTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMEREXPIRATIONTESTCASE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerFunctionTypesTestCase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,9 +11,9 @@
 
 #include "SoftwareTimerFunctionTypesTestCase.hpp"
 
-#include "distortos/DynamicSoftwareTimer.hpp"
+#include "getAllocatedMemory.hpp"
 
-#include <malloc.h>
+#include "distortos/DynamicSoftwareTimer.hpp"
 
 namespace distortos
 {
@@ -114,7 +114,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 {
 	constexpr auto singleDuration = TickClock::duration{1};
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	// software timer with regular function
 	{
@@ -133,7 +133,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// software timer with state-less functor
@@ -152,7 +152,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// software timer with member function of object with state
@@ -171,7 +171,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// software timer with capturing lambda
@@ -194,7 +194,7 @@ bool SoftwareTimerFunctionTypesTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
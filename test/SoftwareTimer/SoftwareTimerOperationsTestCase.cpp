@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerOperationsTestCase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,13 +11,12 @@
 
 #include "SoftwareTimerOperationsTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicSoftwareTimer.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -147,7 +146,7 @@ private:
 
 bool SoftwareTimerOperationsTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	{
 		volatile uint32_t value {};
@@ -463,7 +462,7 @@ bool SoftwareTimerOperationsTestCase::run_() const
 		}
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after test
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after test
 		return false;
 
 	return true;
@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerOrderingTestCase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,14 +11,13 @@
 
 #include "SoftwareTimerOrderingTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/DynamicSoftwareTimer.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -33,7 +32,7 @@ bool SoftwareTimerOrderingTestCase::run_() const
 {
 	constexpr auto totalSoftwareTimers = totalThreads;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -69,7 +68,7 @@ bool SoftwareTimerOrderingTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
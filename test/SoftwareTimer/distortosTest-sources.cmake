@@ -8,6 +8,7 @@
 #
 
 target_sources(distortosTest PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerExpirationTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerFunctionTypesTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/SoftwareTimerOrderingTestCase.cpp
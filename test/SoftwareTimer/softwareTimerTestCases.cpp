@@ -2,7 +2,7 @@
  * \file
  * \brief softwareTimerTestCases object definition
  *
- * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -15,6 +15,7 @@
 #include "SoftwareTimerOperationsTestCase.hpp"
 #include "SoftwareTimerFunctionTypesTestCase.hpp"
 #include "SoftwareTimerPeriodicTestCase.hpp"
+#include "SoftwareTimerExpirationTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -43,6 +44,9 @@ const SoftwareTimerFunctionTypesTestCase functionTypesTestCase;
 /// SoftwareTimerPeriodicTestCase instance
 const SoftwareTimerPeriodicTestCase periodicTestCase;
 
+/// SoftwareTimerExpirationTestCase instance
+const SoftwareTimerExpirationTestCase expirationTestCase;
+
 /// array with references to TestCase objects related to software timers
 const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 {
@@ -50,6 +54,7 @@ const TestCaseGroup::Range::value_type softwareTimerTestCases_[]
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
 		TestCaseGroup::Range::value_type{periodicTestCase},
+		TestCaseGroup::Range::value_type{expirationTestCase},
 };
 
 }	// namespace
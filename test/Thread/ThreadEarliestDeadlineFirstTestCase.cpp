@@ -0,0 +1,234 @@
+/**
+ * \file
+ * \brief ThreadEarliestDeadlineFirstTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadEarliestDeadlineFirstTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "SequenceAsserter.hpp"
+#include "wasteTime.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of test thread
+constexpr uint8_t testThreadPriority {1};
+
+/// number of test threads
+constexpr size_t totalThreads {8};
+
+/// duration of single test thread - significantly longer than single round-robin quantum
+constexpr auto testThreadDuration = internal::RoundRobinQuantum::getInitial() * 2;
+
+/// delay between the start of test phase and the release of test threads
+constexpr auto releaseDelay = TickClock::duration{10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread for ordering phase
+ *
+ * Sets the deadline, sleeps until release time point, marks the first sequence point in SequenceAsserter, wastes some
+ * time and marks the second sequence point in SequenceAsserter.
+ *
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] releaseTimePoint is the time point at which all test threads are released
+ * \param [in] deadline is the deadline of this instance
+ * \param [in] sequencePoint is the first sequence point of this instance
+ */
+
+void orderingThread(SequenceAsserter& sequenceAsserter, const TickClock::time_point releaseTimePoint,
+		const TickClock::time_point deadline, const unsigned int sequencePoint)
+{
+	ThisThread::setDeadline(deadline);
+	ThisThread::sleepUntil(releaseTimePoint);
+	sequenceAsserter.sequencePoint(sequencePoint);
+	wasteTime(testThreadDuration);
+	sequenceAsserter.sequencePoint(sequencePoint + 1);
+	ThisThread::setDeadline(TickClock::time_point::max());
+}
+
+/**
+ * \brief Test thread for preemption phase
+ *
+ * Sets the deadline, sleeps until release time point and marks the first sequence point in SequenceAsserter. Then
+ * optionally postpones its deadline and marks the second sequence point in SequenceAsserter.
+ *
+ * \param [in] sequenceAsserter is a reference to SequenceAsserter shared object
+ * \param [in] releaseTimePoint is the time point at which all test threads are released
+ * \param [in] deadline is the deadline of this instance
+ * \param [in] postponedDeadline is the deadline which will be set after the first sequence point,
+ * TickClock::time_point::max() to leave the deadline unchanged
+ * \param [in] sequencePoints is a pair of sequence points for this instance
+ */
+
+void preemptionThread(SequenceAsserter& sequenceAsserter, const TickClock::time_point releaseTimePoint,
+		const TickClock::time_point deadline, const TickClock::time_point postponedDeadline,
+		const std::pair<unsigned int, unsigned int> sequencePoints)
+{
+	ThisThread::setDeadline(deadline);
+	ThisThread::sleepUntil(releaseTimePoint);
+	sequenceAsserter.sequencePoint(sequencePoints.first);
+	if (postponedDeadline != TickClock::time_point::max())
+		ThisThread::setDeadline(postponedDeadline);
+	sequenceAsserter.sequencePoint(sequencePoints.second);
+}
+
+/**
+ * \brief Test thread for deadline miss phase
+ *
+ * Executes two jobs - first one misses its deadline, second one finishes before its deadline. Number of deadline
+ * misses is read after each job.
+ *
+ * \param [out] missCounts is a reference to array in which number of deadline misses after each job will be written
+ */
+
+void missThread(std::array<uint32_t, 2>& missCounts)
+{
+	ThisThread::setDeadline(TickClock::now() + TickClock::duration{2});
+	wasteTime(TickClock::duration{5});
+	ThisThread::setDeadline(TickClock::now() + TickClock::duration{100});
+	missCounts[0] = ThisThread::getDeadlineMissCount();
+	ThisThread::setDeadline(TickClock::time_point::max());
+	missCounts[1] = ThisThread::getDeadlineMissCount();
+}
+
+/**
+ * \brief Tests ordering of threads according to their deadlines.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testOrdering()
+{
+	// rank of deadline of each thread - threads are created in "shuffled" order
+	static const unsigned int ranks[totalThreads] {5, 2, 7, 0, 3, 6, 1, 4};
+
+	SequenceAsserter sequenceAsserter;
+	const auto releaseTimePoint = TickClock::now() + releaseDelay;
+	const auto makeTestThread = [&sequenceAsserter, releaseTimePoint](const unsigned int rank)
+			{
+				return makeDynamicThread({testThreadStackSize, testThreadPriority,
+						SchedulingPolicy::earliestDeadlineFirst}, orderingThread, std::ref(sequenceAsserter),
+						releaseTimePoint, releaseTimePoint + TickClock::duration{100 + rank * 10}, rank * 2);
+			};
+
+	std::array<DynamicThread, totalThreads> threads
+	{{
+			makeTestThread(ranks[0]),
+			makeTestThread(ranks[1]),
+			makeTestThread(ranks[2]),
+			makeTestThread(ranks[3]),
+			makeTestThread(ranks[4]),
+			makeTestThread(ranks[5]),
+			makeTestThread(ranks[6]),
+			makeTestThread(ranks[7]),
+	}};
+
+	for (auto& thread : threads)
+		thread.start();
+
+	for (auto& thread : threads)
+		thread.join();
+
+	// no round-robin between threads with equal priority - each thread executes its job without interruption
+	return sequenceAsserter.assertSequence(totalThreads * 2);
+}
+
+/**
+ * \brief Tests preemption of thread which postpones its deadline.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testPreemption()
+{
+	SequenceAsserter sequenceAsserter;
+	const auto releaseTimePoint = TickClock::now() + releaseDelay;
+	const auto max = TickClock::time_point::max();
+
+	auto postponingThread = makeDynamicThread({testThreadStackSize, testThreadPriority,
+			SchedulingPolicy::earliestDeadlineFirst}, preemptionThread, std::ref(sequenceAsserter), releaseTimePoint,
+			releaseTimePoint + TickClock::duration{100}, releaseTimePoint + TickClock::duration{300},
+			std::make_pair(0u, 3u));
+	auto otherThread = makeDynamicThread({testThreadStackSize, testThreadPriority,
+			SchedulingPolicy::earliestDeadlineFirst}, preemptionThread, std::ref(sequenceAsserter), releaseTimePoint,
+			releaseTimePoint + TickClock::duration{200}, max, std::make_pair(1u, 2u));
+
+	otherThread.start();
+	postponingThread.start();
+
+	otherThread.join();
+	postponingThread.join();
+
+	return sequenceAsserter.assertSequence(4);
+}
+
+/**
+ * \brief Tests counting of deadline misses.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testMisses()
+{
+	std::array<uint32_t, 2> missCounts {};
+	auto thread = makeDynamicThread({testThreadStackSize, testThreadPriority, SchedulingPolicy::earliestDeadlineFirst},
+			missThread, std::ref(missCounts));
+
+	thread.start();
+	thread.join();
+
+	return missCounts[0] == 1 && missCounts[1] == 1;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadEarliestDeadlineFirstTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	for (const auto function : {testOrdering, testPreemption, testMisses})
+	{
+		if (function() == false)
+			return false;
+
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadEarliestDeadlineFirstTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADEARLIESTDEADLINEFIRSTTESTCASE_HPP_
+#define TEST_THREAD_THREADEARLIESTDEADLINEFIRSTTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests earliest-deadline-first scheduling of threads.
+ *
+ * Starts 8 small threads with same priority and different deadlines, all released in the same tick, making sure that
+ * they are executed in the order of their deadlines. Then tests preemption of a thread which postpones its deadline
+ * and counting of deadline misses.
+ */
+
+class ThreadEarliestDeadlineFirstTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADEARLIESTDEADLINEFIRSTTESTCASE_HPP_
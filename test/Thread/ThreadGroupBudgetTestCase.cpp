@@ -0,0 +1,181 @@
+/**
+ * \file
+ * \brief ThreadGroupBudgetTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadGroupBudgetTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "wasteTime.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThreadGroup.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// priority of busy test thread, which belongs to the group with budget
+constexpr uint8_t busyThreadPriority {2};
+
+/// priority of low priority test thread
+constexpr uint8_t lowPriorityThreadPriority {1};
+
+/// budget of the group
+constexpr TickClock::duration budget {5};
+
+/// replenishment period of the group
+constexpr TickClock::duration period {20};
+
+/// duration of busy test thread
+constexpr TickClock::duration busyDuration {period + budget * 2};
+
+/// tolerance of measured time, ticks
+constexpr TickClock::duration tolerance {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Busy test thread
+ *
+ * Moves itself to the group with budget and wastes time until given time point.
+ *
+ * \param [in] threadGroup is a reference to ThreadGroup with budget
+ * \param [in] endTimePoint is the time point until which the thread wastes time
+ */
+
+void busyThread(ThreadGroup& threadGroup, const TickClock::time_point endTimePoint)
+{
+	ThisThread::setThreadGroup(threadGroup);
+	wasteTime(endTimePoint);
+}
+
+/**
+ * \brief Low priority test thread
+ *
+ * Saves the time point at which it started to run and wastes some time.
+ *
+ * \param [out] startTimePoint is a reference to variable in which the time point of start will be written
+ */
+
+void lowPriorityThread(TickClock::time_point& startTimePoint)
+{
+	startTimePoint = TickClock::now();
+	wasteTime(budget);
+}
+
+/**
+ * \brief Tests validation of parameters of ThreadGroup::setBudget().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testParameters()
+{
+	ThreadGroup threadGroup;
+
+	if (threadGroup.getRemainingBudget() != TickClock::duration{})
+		return false;
+
+	if (threadGroup.setBudget(TickClock::duration{-1}, period) != EINVAL)
+		return false;
+
+	if (threadGroup.setBudget(budget, TickClock::duration{}) != EINVAL)
+		return false;
+
+	if (threadGroup.setBudget(period + TickClock::duration{1}, period) != EINVAL)
+		return false;
+
+	if (threadGroup.setBudget(budget, period) != 0 || threadGroup.getRemainingBudget() != budget)
+		return false;
+
+	if (threadGroup.setBudget({}, {}) != 0 || threadGroup.getRemainingBudget() != TickClock::duration{})
+		return false;
+
+	return threadGroup.getExhaustionCount() == 0;
+}
+
+/**
+ * \brief Tests isolation of thread groups.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testIsolation()
+{
+	ThreadGroup threadGroup;
+	if (threadGroup.setBudget(budget, period) != 0)
+		return false;
+
+	TickClock::time_point lowPriorityStartTimePoint {};
+	const auto start = TickClock::now();
+
+	auto busy = makeDynamicThread({testThreadStackSize, busyThreadPriority}, busyThread, std::ref(threadGroup),
+			start + busyDuration);
+	auto lowPriority = makeDynamicThread({testThreadStackSize, lowPriorityThreadPriority}, lowPriorityThread,
+			std::ref(lowPriorityStartTimePoint));
+
+	busy.start();
+	lowPriority.start();
+	busy.join();
+	lowPriority.join();
+
+	// without the budget low priority thread would start only after busy thread is done
+	if (lowPriorityStartTimePoint - start > budget + tolerance)
+		return false;
+
+	// budget was exhausted in first period and again after replenishment
+	if (threadGroup.getExhaustionCount() != 2)
+		return false;
+
+	return threadGroup.setBudget({}, {}) == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadGroupBudgetTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	for (const auto function : {testParameters, testIsolation})
+	{
+		if (function() == false)
+			return false;
+
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief ThreadGroupBudgetTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADGROUPBUDGETTESTCASE_HPP_
+#define TEST_THREAD_THREADGROUPBUDGETTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests budgets of thread groups.
+ *
+ * Tests validation of parameters of ThreadGroup::setBudget(). Then starts a busy thread with high priority in a group
+ * with limited budget and a thread with lower priority in another group, making sure that the lower priority thread is
+ * not starved - it starts running as soon as the budget of the group is exhausted.
+ */
+
+class ThreadGroupBudgetTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADGROUPBUDGETTESTCASE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadOperationsTestCase class implementation
  *
- * \author Copyright (C) 2015-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "ThreadOperationsTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 #include "waitForNextTick.hpp"
 
@@ -21,8 +22,6 @@
 #include "distortos/ThisThread.hpp"
 #include "distortos/ThreadIdentifier.hpp"
 
-#include <malloc.h>
-
 #include <cerrno>
 
 namespace distortos
@@ -152,7 +151,7 @@ bool phase3()
 {
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto lambda =
 			[](int& sharedRet)
 			{
@@ -192,7 +191,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// detaching dynamic thread that is started, but not yet terminated, must succeed
@@ -215,7 +214,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// self-detach of dynamic thread must succeed
@@ -238,7 +237,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// detaching dynamic thread that is already terminated must succeed, the thread is just deleted
@@ -256,7 +255,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
@@ -274,7 +273,7 @@ bool phase3()
 
 bool phase4()
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	{
 		SequenceAsserter sequenceAsserter;
@@ -292,7 +291,7 @@ bool phase4()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #ifdef CONFIG_THREAD_DETACH_ENABLE
@@ -315,7 +314,7 @@ bool phase4()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
@@ -333,7 +332,7 @@ bool phase4()
 
 bool phase5()
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	const auto lambda =
 			[](ThreadIdentifier& innerIdentifier, bool& sharedResult)
@@ -381,7 +380,7 @@ bool phase5()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// test whether identifiers for different thread instances are not equal
@@ -414,7 +413,7 @@ bool phase5()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
@@ -441,7 +440,7 @@ bool ThreadOperationsTestCase::run_() const
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
 			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
 	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
@@ -450,7 +449,7 @@ bool ThreadOperationsTestCase::run_() const
 		if (ret != true)
 			return ret;
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadPriorityTestCase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,14 +11,13 @@
 
 #include "ThreadPriorityTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/InterruptMaskingLock.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -76,7 +75,7 @@ DynamicThread makeTestThread(const ThreadParameters& threadParameters, SequenceA
 
 bool ThreadPriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -109,7 +108,7 @@ bool ThreadPriorityTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
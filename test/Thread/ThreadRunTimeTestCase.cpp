@@ -0,0 +1,125 @@
+/**
+ * \file
+ * \brief ThreadRunTimeTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadRunTimeTestCase.hpp"
+
+#include "wasteTime.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// duration used by test threads
+constexpr TickClock::duration testDuration {10};
+
+/// tolerance of measured time, ticks
+constexpr TickClock::duration tolerance {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests run time of a thread which wastes CPU time and of a thread which sleeps.
+ *
+ * \param [in] priority is the priority of test threads
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testThreads(const uint8_t priority)
+{
+	// current thread does not run until both test threads are done, so it doesn't affect measured run time
+	auto busyThread = makeDynamicThread({testThreadStackSize, priority},
+			static_cast<void(&)(TickClock::duration)>(wasteTime), testDuration);
+	auto sleepingThread = makeDynamicThread({testThreadStackSize, priority},
+			static_cast<int(&)(TickClock::duration)>(ThisThread::sleepFor), testDuration);
+
+	if (busyThread.getRunTime() != std::chrono::nanoseconds{} ||
+			sleepingThread.getRunTime() != std::chrono::nanoseconds{})
+		return false;
+
+	const auto interruptTime = statistics::getInterruptTime();
+	sleepingThread.start();
+	busyThread.start();
+	busyThread.join();
+	sleepingThread.join();
+
+	// time spent in interrupts is not accounted to threads; ticks may be lost when the process is delayed by the host,
+	// so the time actually wasted by busy thread has no upper limit
+	const auto busyRunTime = busyThread.getRunTime() + (statistics::getInterruptTime() - interruptTime);
+	if (busyRunTime < testDuration - tolerance)
+		return false;
+
+	if (sleepingThread.getRunTime() > tolerance)
+		return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadRunTimeTestCase::run_() const
+{
+	if (testThreads(testCasePriority_) == false)
+		return false;
+
+	{
+		const auto runTime = ThisThread::getRunTime();
+		const auto interruptTime = statistics::getInterruptTime();
+		wasteTime(testDuration);
+		const auto interruptTimeDifference = statistics::getInterruptTime() - interruptTime;
+		if (ThisThread::getRunTime() - runTime + interruptTimeDifference < testDuration - tolerance)
+			return false;
+	}
+
+	{
+		const auto idleTime = statistics::getIdleTime();
+		const auto interruptTime = statistics::getInterruptTime();
+		const auto ret = ThisThread::sleepFor(testDuration);
+		if (ret != 0)
+			return false;
+
+		const auto idleTimeDifference = statistics::getIdleTime() - idleTime;
+		const auto interruptTimeDifference = statistics::getInterruptTime() - interruptTime;
+		if (idleTimeDifference + interruptTimeDifference < testDuration - tolerance)
+			return false;
+	}
+
+	if (statistics::getCpuLoad() > 10000)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ThreadRunTimeTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADRUNTIMETESTCASE_HPP_
+#define TEST_THREAD_THREADRUNTIMETESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests run time statistics of threads.
+ *
+ * Starts a thread which wastes CPU time and a thread which sleeps, asserting that their run time matches the amount of
+ * time they actually used the CPU. Also asserts that run time of current thread and idle time of the system increase
+ * as expected.
+ */
+
+class ThreadRunTimeTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadRunTimeTestCase's constructor
+	 */
+
+	constexpr ThreadRunTimeTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADRUNTIMETESTCASE_HPP_
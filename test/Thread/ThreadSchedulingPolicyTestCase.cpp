@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadSchedulingPolicyTestCase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "ThreadSchedulingPolicyTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 #include "wasteTime.hpp"
 
@@ -18,8 +19,6 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -98,7 +97,7 @@ DynamicThread makeTestThread(const SchedulingPolicy schedulingPolicy, SequenceAs
 
 bool ThreadSchedulingPolicyTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	// scheduling policy, sequence point multiplier, sequence point step
 	using Parameters = std::tuple<SchedulingPolicy, unsigned int, unsigned int>;
@@ -156,7 +155,7 @@ bool ThreadSchedulingPolicyTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadSleepForTestCase class implementation
  *
- * \author Copyright (C) 2014-2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "ThreadSleepForTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 #include "wasteTime.hpp"
@@ -19,8 +20,6 @@
 #include "distortos/InterruptMaskingLock.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -101,7 +100,7 @@ DynamicThread makeTestThread(const uint8_t priority, const ThreadParameters& thr
 
 bool ThreadSleepForTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -166,7 +165,7 @@ bool ThreadSleepForTestCase::run_() const
 					return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
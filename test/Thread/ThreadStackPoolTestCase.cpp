@@ -0,0 +1,184 @@
+/**
+ * \file
+ * \brief ThreadStackPoolTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadStackPoolTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicStackPool.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticStackPool.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of test threads, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// number of blocks in tested stack pools
+constexpr size_t testBlocks {2};
+
+#ifdef CONFIG_THREAD_DETACH_ENABLE
+
+/// error code returned by DynamicThread::start() when stack pool has no free blocks
+constexpr int noFreeBlocksError {EINVAL};
+
+#else	// !def CONFIG_THREAD_DETACH_ENABLE
+
+/// error code returned by DynamicThread::start() when stack pool has no free blocks
+constexpr int noFreeBlocksError {ENOSPC};
+
+#endif	// !def CONFIG_THREAD_DETACH_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by test threads.
+ *
+ * \param [out] executed is a reference to variable which is set to true
+ */
+
+void setExecuted(bool& executed)
+{
+	executed = true;
+}
+
+/**
+ * \brief Tests allocation of threads from stack pool and return of blocks to the pool.
+ *
+ * \param [in] stackPool is a reference to tested stack pool, which must have testBlocks free blocks
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testAllocation(StackPool& stackPool)
+{
+	if (stackPool.getStackSize() != testThreadStackSize || stackPool.getFreeBlocks() != testBlocks)
+		return false;
+
+	{
+		bool executed1 {};
+		bool executed2 {};
+		bool executed3 {};
+		auto thread1 = makeDynamicThread({stackPool, 1}, setExecuted, std::ref(executed1));
+		auto thread2 = makeDynamicThread({stackPool, 1}, setExecuted, std::ref(executed2));
+		if (stackPool.getFreeBlocks() != 0)
+			return false;
+
+		{
+			// pool has no free blocks
+			auto thread3 = makeDynamicThread({stackPool, 1}, setExecuted, std::ref(executed3));
+			if (thread3.start() != noFreeBlocksError)
+				return false;
+		}
+
+		if (thread1.getStackSize() < testThreadStackSize || thread2.getStackSize() < testThreadStackSize)
+			return false;
+		if (thread1.start() != 0 || thread2.start() != 0)
+			return false;
+		if (thread1.join() != 0 || thread2.join() != 0)
+			return false;
+		if (executed1 != true || executed2 != true || executed3 != false)
+			return false;
+		// blocks are owned by threads until they are destroyed
+		if (stackPool.getFreeBlocks() != 0)
+			return false;
+	}
+
+	if (stackPool.getFreeBlocks() != testBlocks)
+		return false;
+
+	{
+		// blocks of the pool are too small for requested stack
+		DynamicThreadParameters parameters {stackPool, 1};
+		parameters.stackSize = testThreadStackSize * 2;
+		bool executed {};
+		auto thread = makeDynamicThread(parameters, setExecuted, std::ref(executed));
+		if (thread.start() != ENOSPC || executed != false)
+			return false;
+	}
+
+	if (stackPool.getFreeBlocks() != testBlocks)
+		return false;
+
+#ifdef CONFIG_THREAD_DETACH_ENABLE
+
+	{
+		// block of detached thread is returned to the pool after its deferred deletion
+		bool executed {};
+		auto thread = makeDynamicThread({stackPool, 1}, setExecuted, std::ref(executed));
+		if (thread.start() != 0 || thread.detach() != 0)
+			return false;
+		if (stackPool.getFreeBlocks() != testBlocks - 1)
+			return false;
+
+		// test thread and then idle thread - which performs deferred deletion - are executed during sleep
+		ThisThread::sleepFor(TickClock::duration{2});
+
+		if (executed != true || stackPool.getFreeBlocks() != testBlocks)
+			return false;
+	}
+
+#endif	// def CONFIG_THREAD_DETACH_ENABLE
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadStackPoolTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		StaticStackPool<testThreadStackSize, testBlocks> stackPool;
+		if (testAllocation(stackPool) == false)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	{
+		DynamicStackPool stackPool {testThreadStackSize, testBlocks};
+		if (testAllocation(stackPool) == false)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ThreadStackPoolTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADSTACKPOOLTESTCASE_HPP_
+#define TEST_THREAD_THREADSTACKPOOLTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests dynamic threads with storage allocated from StaticStackPool and DynamicStackPool.
+ *
+ * Asserts that blocks of stack pool are taken by created threads and returned to the pool when the threads are
+ * destroyed - also when the threads are detached - that threads using the pool can be started when the pool has free
+ * blocks which are large enough and that no dynamic memory is leaked.
+ */
+
+class ThreadStackPoolTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadStackPoolTestCase's constructor
+	 */
+
+	constexpr ThreadStackPoolTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADSTACKPOOLTESTCASE_HPP_
@@ -0,0 +1,126 @@
+/**
+ * \file
+ * \brief ThreadTimeoutTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadTimeoutTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// delay after which semaphore is posted in waits which end before their timeouts
+constexpr TickClock::duration postDelay {2};
+
+/// timeout of waits which end before their timeouts
+constexpr TickClock::duration postedWaitTimeout {20};
+
+/// number of ticks by which wait may time out too late - on the host system ticks may be lost
+constexpr TickClock::duration lateTolerance {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Performs timed wait on semaphore which is posted before the timeout.
+ *
+ * \param [in] semaphore is a reference to semaphore on which the wait will be performed
+ * \param [in] postingTimer is a reference to software timer which posts \a semaphore
+ *
+ * \return true if the wait ended successfully before its timeout, false otherwise
+ */
+
+bool waitPosted(Semaphore& semaphore, SoftwareTimer& postingTimer)
+{
+	if (postingTimer.start(postDelay) != 0)
+		return false;
+
+	return semaphore.tryWaitFor(postedWaitTimeout) == 0;
+}
+
+/**
+ * \brief Performs timed wait on semaphore which is not posted.
+ *
+ * \param [in] semaphore is a reference to semaphore on which the wait will be performed
+ * \param [in] duration is the timeout of the wait
+ *
+ * \return true if the wait timed out at expected time point, false otherwise
+ */
+
+bool waitTimedOut(Semaphore& semaphore, const TickClock::duration duration)
+{
+	const auto start = TickClock::now();
+	if (semaphore.tryWaitFor(duration) != ETIMEDOUT)
+		return false;
+
+	const auto realDuration = TickClock::now() - start;
+	return realDuration >= duration + TickClock::duration{1} &&
+			realDuration <= duration + TickClock::duration{1} + lateTolerance;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadTimeoutTestCase::run_() const
+{
+	Semaphore semaphore {0};
+	auto postingTimer = makeStaticSoftwareTimer(
+			[&semaphore]()
+			{
+				semaphore.post();
+			});
+
+	// timeout earlier than the timeout of previous wait
+	waitForNextTick();
+	if (waitPosted(semaphore, postingTimer) == false)
+		return false;
+	if (waitTimedOut(semaphore, postedWaitTimeout / 4) == false)
+		return false;
+
+	// timeout later than the timeout of previous wait
+	waitForNextTick();
+	if (waitPosted(semaphore, postingTimer) == false)
+		return false;
+	if (waitTimedOut(semaphore, postedWaitTimeout + postedWaitTimeout / 2) == false)
+		return false;
+
+	// several waits which end before their timeouts
+	waitForNextTick();
+	for (size_t i {}; i < 4; ++i)
+		if (waitPosted(semaphore, postingTimer) == false)
+			return false;
+	if (waitTimedOut(semaphore, postedWaitTimeout) == false)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief ThreadTimeoutTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADTIMEOUTTESTCASE_HPP_
+#define TEST_THREAD_THREADTIMEOUTTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests timeouts of blocking operations of threads.
+ *
+ * Performs sequences of timed waits on a semaphore, where some waits end before their timeouts, asserting that each
+ * wait which times out does so at requested time point - no matter whether the timeout is earlier or later than the
+ * timeout of the previous wait which ended before its timeout.
+ */
+
+class ThreadTimeoutTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadTimeoutTestCase's constructor
+	 */
+
+	constexpr ThreadTimeoutTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADTIMEOUTTESTCASE_HPP_
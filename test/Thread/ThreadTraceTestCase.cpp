@@ -0,0 +1,135 @@
+/**
+ * \file
+ * \brief ThreadTraceTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ThreadTraceTestCase.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/trace.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// max number of records checked by the test
+constexpr size_t maxRecords {256};
+
+/// value of internal::UnblockReason::timeout
+constexpr uint16_t timeoutUnblockReason {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread
+ *
+ * Sleeps for one tick.
+ */
+
+void thread()
+{
+	ThisThread::sleepFor(TickClock::duration{1});
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ThreadTraceTestCase::run_() const
+{
+	std::array<trace::Record, maxRecords> records;
+	trace::DumpHeader header;
+
+	{
+		auto testThread = makeDynamicThread({testThreadStackSize, testCasePriority_}, thread);
+
+		std::array<uint8_t, sizeof(header) + sizeof(records)> buffer;
+		trace::clear();
+		testThread.start();
+		testThread.join();
+		const auto size = trace::dump(buffer.begin(), buffer.size());
+
+		if (size < sizeof(header))
+			return false;
+
+		memcpy(&header, buffer.begin(), sizeof(header));
+		if (header.magic != trace::dumpMagic || header.version != trace::dumpVersion ||
+				header.recordSize != sizeof(trace::Record) || header.recordCount > records.size() ||
+				size != sizeof(header) + header.recordCount * sizeof(trace::Record) || header.frequency == 0)
+			return false;
+
+		memcpy(records.begin(), buffer.begin() + sizeof(header), header.recordCount * sizeof(trace::Record));
+	}
+
+	// test thread is identified by the first context switch - the thread is started with the priority of current thread,
+	// so it is executed when current thread blocks in join()
+	const auto begin = records.begin();
+	const auto end = begin + header.recordCount;
+	const auto contextSwitch = std::find_if(begin, end,
+			[](const trace::Record& record)
+			{
+				return record.type == trace::EventType::contextSwitch;
+			});
+	if (contextSwitch == end || contextSwitch->argument != testCasePriority_)
+		return false;
+
+	const auto object = contextSwitch->object;
+
+	// test thread must be blocked when it starts sleeping, unblocked by timeout, switched to again and then terminated
+	const std::array<std::pair<trace::EventType, uint16_t>, 4> expectedRecords
+	{{
+			{trace::EventType::block, static_cast<uint16_t>(ThreadState::sleeping)},
+			{trace::EventType::unblock, timeoutUnblockReason},
+			{trace::EventType::contextSwitch, testCasePriority_},
+			{trace::EventType::block, static_cast<uint16_t>(ThreadState::terminated)},
+	}};
+	auto iterator = contextSwitch;
+	for (const auto& expectedRecord : expectedRecords)
+	{
+		iterator = std::find_if(iterator + 1, end,
+				[object](const trace::Record& record)
+				{
+					return record.object == object;
+				});
+		if (iterator == end || iterator->type != expectedRecord.first || iterator->argument != expectedRecord.second)
+			return false;
+	}
+
+	for (auto record = begin + 1; record < end; ++record)
+		if (record->timestamp < (record - 1)->timestamp)
+			return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \brief ThreadTraceTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_THREAD_THREADTRACETESTCASE_HPP_
+#define TEST_THREAD_THREADTRACETESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests scheduler event trace.
+ *
+ * Starts a thread which sleeps for one tick, asserting that the dump of trace contains valid header and records of
+ * context switches, blocking and unblocking of this thread in expected order.
+ */
+
+class ThreadTraceTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief ThreadTraceTestCase's constructor
+	 */
+
+	constexpr ThreadTraceTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_THREAD_THREADTRACETESTCASE_HPP_
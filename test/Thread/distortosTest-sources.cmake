@@ -8,6 +8,7 @@
 #
 
 target_sources(distortosTest PRIVATE
+		${CMAKE_CURRENT_LIST_DIR}/ThreadEarliestDeadlineFirstTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadFunctionTypesTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadOperationsTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadPriorityChangeTestCase.cpp
@@ -15,4 +16,27 @@ target_sources(distortosTest PRIVATE
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSchedulingPolicyTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepForTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/ThreadSleepUntilTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadStackPoolTestCase.cpp
+		${CMAKE_CURRENT_LIST_DIR}/ThreadTimeoutTestCase.cpp
 		${CMAKE_CURRENT_LIST_DIR}/threadTestCases.cpp)
+
+if(distortos_Scheduler_11_Run_time_statistics)
+
+	target_sources(distortosTest PRIVATE
+			${CMAKE_CURRENT_LIST_DIR}/ThreadRunTimeTestCase.cpp)
+
+endif()
+
+if(distortos_Scheduler_13_Trace)
+
+	target_sources(distortosTest PRIVATE
+			${CMAKE_CURRENT_LIST_DIR}/ThreadTraceTestCase.cpp)
+
+endif()
+
+if(distortos_Scheduler_15_Budgets_of_thread_groups)
+
+	target_sources(distortosTest PRIVATE
+			${CMAKE_CURRENT_LIST_DIR}/ThreadGroupBudgetTestCase.cpp)
+
+endif()
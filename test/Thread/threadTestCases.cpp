@@ -2,7 +2,7 @@
  * \file
  * \brief threadTestCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,11 +16,19 @@
 #include "ThreadFunctionTypesTestCase.hpp"
 #include "ThreadSleepForTestCase.hpp"
 #include "ThreadSleepUntilTestCase.hpp"
+#include "ThreadTimeoutTestCase.hpp"
 #include "ThreadSchedulingPolicyTestCase.hpp"
+#include "ThreadEarliestDeadlineFirstTestCase.hpp"
 #include "ThreadPriorityChangeTestCase.hpp"
+#include "ThreadRunTimeTestCase.hpp"
+#include "ThreadTraceTestCase.hpp"
+#include "ThreadGroupBudgetTestCase.hpp"
+#include "ThreadStackPoolTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 namespace distortos
 {
 
@@ -49,12 +57,42 @@ const ThreadSleepForTestCase sleepForTestCase;
 /// ThreadSleepUntilTestCase instance
 const ThreadSleepUntilTestCase sleepUntilTestCase;
 
+/// ThreadTimeoutTestCase instance
+const ThreadTimeoutTestCase timeoutTestCase;
+
 /// ThreadSchedulingPolicyTestCase instance
 const ThreadSchedulingPolicyTestCase schedulingPolicyTestCase;
 
+/// ThreadEarliestDeadlineFirstTestCase instance
+const ThreadEarliestDeadlineFirstTestCase earliestDeadlineFirstTestCase;
+
 /// ThreadPriorityChangeTestCase instance
 const ThreadPriorityChangeTestCase priorityChangeTestCase;
 
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+/// ThreadRunTimeTestCase instance
+const ThreadRunTimeTestCase runTimeTestCase;
+
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+
+#ifdef CONFIG_TRACE_ENABLE
+
+/// ThreadTraceTestCase instance
+const ThreadTraceTestCase traceTestCase;
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+/// ThreadGroupBudgetTestCase instance
+const ThreadGroupBudgetTestCase groupBudgetTestCase;
+
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+
+/// ThreadStackPoolTestCase instance
+const ThreadStackPoolTestCase stackPoolTestCase;
+
 /// array with references to TestCase objects related to threads
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
@@ -63,8 +101,20 @@ const TestCaseGroup::Range::value_type threadTestCases_[]
 		TestCaseGroup::Range::value_type{functionTypesTestCase},
 		TestCaseGroup::Range::value_type{sleepForTestCase},
 		TestCaseGroup::Range::value_type{sleepUntilTestCase},
+		TestCaseGroup::Range::value_type{timeoutTestCase},
 		TestCaseGroup::Range::value_type{schedulingPolicyTestCase},
+		TestCaseGroup::Range::value_type{earliestDeadlineFirstTestCase},
 		TestCaseGroup::Range::value_type{priorityChangeTestCase},
+#ifdef CONFIG_RUN_TIME_STATISTICS_ENABLE
+		TestCaseGroup::Range::value_type{runTimeTestCase},
+#endif	// def CONFIG_RUN_TIME_STATISTICS_ENABLE
+#ifdef CONFIG_TRACE_ENABLE
+		TestCaseGroup::Range::value_type{traceTestCase},
+#endif	// def CONFIG_TRACE_ENABLE
+#ifdef CONFIG_THREAD_GROUP_BUDGET_ENABLE
+		TestCaseGroup::Range::value_type{groupBudgetTestCase},
+#endif	// def CONFIG_THREAD_GROUP_BUDGET_ENABLE
+		TestCaseGroup::Range::value_type{stackPoolTestCase},
 };
 
 }	// namespace
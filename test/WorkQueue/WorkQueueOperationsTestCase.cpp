@@ -0,0 +1,338 @@
+/**
+ * \file
+ * \brief WorkQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "WorkQueueOperationsTestCase.hpp"
+
+#include "getAllocatedMemory.hpp"
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticWorkItem.hpp"
+#include "distortos/StaticWorkQueue.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for worker threads, bytes
+constexpr size_t workerStackSize {512};
+
+/// priority of worker threads - lower than priority of test case, so worker threads run only when test case sleeps
+constexpr uint8_t workerPriority {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// work queue used by test case
+using TestWorkQueue = StaticWorkQueue<workerStackSize, 2>;
+
+/// record of executions of work item
+struct Record
+{
+	/// number of executions
+	volatile uint32_t counter;
+
+	/// time point of last execution
+	volatile TickClock::rep timePoint;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Function executed by work items.
+ *
+ * Increments counter of the record and saves time point of execution.
+ *
+ * \param [in,out] record is a reference to Record object
+ */
+
+void recordExecution(Record& record)
+{
+	++record.counter;
+	record.timePoint = TickClock::now().time_since_epoch().count();
+}
+
+/**
+ * \brief Function executed by work item which sleeps before saving time point of its execution.
+ *
+ * \param [in,out] record is a reference to Record object
+ * \param [in] duration is the duration of sleep
+ */
+
+void sleepAndRecordExecution(Record& record, const TickClock::duration duration)
+{
+	ThisThread::sleepFor(duration);
+	recordExecution(record);
+}
+
+/**
+ * \brief Tests submission and cancellation of work items from thread context.
+ *
+ * \param [in] workQueue is a reference to tested work queue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testSubmission(TestWorkQueue& workQueue)
+{
+	Record recordA {};
+	Record recordB {};
+	auto workItemA = makeStaticWorkItem(recordExecution, std::ref(recordA));
+	auto workItemB = makeStaticWorkItem(recordExecution, std::ref(recordB));
+
+	if (workItemA.isPending() != false || workItemA.cancel() != EALREADY)
+		return false;
+
+	if (workQueue.submit(workItemA) != 0 || workQueue.submit(workItemB) != 0)
+		return false;
+	// second submission of pending work item does nothing
+	if (workQueue.submit(workItemA) != 0 || workItemA.isPending() != true || workItemB.isPending() != true)
+		return false;
+	if (workItemB.cancel() != 0 || workItemB.isPending() != false || workItemB.cancel() != EALREADY)
+		return false;
+	// worker threads have lower priority, so nothing was executed yet
+	if (recordA.counter != 0 || recordB.counter != 0)
+		return false;
+
+	ThisThread::sleepFor(TickClock::duration{2});
+
+	if (recordA.counter != 1 || recordB.counter != 0 || workItemA.isPending() != false)
+		return false;
+
+	// resubmission of executed work item
+	if (workQueue.submit(workItemA) != 0)
+		return false;
+
+	ThisThread::sleepFor(TickClock::duration{2});
+
+	return recordA.counter == 2 && recordB.counter == 0;
+}
+
+/**
+ * \brief Tests delayed submission of work items.
+ *
+ * \param [in] workQueue is a reference to tested work queue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testDelayedSubmission(TestWorkQueue& workQueue)
+{
+	constexpr auto duration = TickClock::duration{10};
+
+	Record record {};
+	auto workItem = makeStaticWorkItem(recordExecution, std::ref(record));
+
+	{
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (workQueue.submitAfter(workItem, duration) != 0 || workItem.isPending() != true)
+			return false;
+
+		ThisThread::sleepUntil(start + duration / 2);
+		if (record.counter != 0 || workItem.isPending() != true)
+			return false;
+
+		ThisThread::sleepUntil(start + duration * 2);
+		// submitted by software timer - no earlier than requested
+		if (record.counter != 1 || workItem.isPending() != false ||
+				record.timePoint < (start + duration + TickClock::duration{1}).time_since_epoch().count())
+			return false;
+	}
+	{
+		// cancelled delayed submission
+		if (workQueue.submitAfter(workItem, duration) != 0 || workItem.cancel() != 0 || workItem.isPending() != false)
+			return false;
+
+		ThisThread::sleepFor(duration * 2);
+		if (record.counter != 1)
+			return false;
+	}
+	{
+		// rescheduled delayed submission
+		waitForNextTick();
+		const auto start = TickClock::now();
+		if (workQueue.submitAt(workItem, start + duration) != 0 ||
+				workQueue.submitAt(workItem, start + duration * 2) != 0)
+			return false;
+
+		ThisThread::sleepUntil(start + duration + duration / 2);
+		if (record.counter != 1 || workItem.isPending() != true)
+			return false;
+
+		ThisThread::sleepUntil(start + duration * 3);
+		if (record.counter != 2 || record.timePoint < (start + duration * 2).time_since_epoch().count())
+			return false;
+	}
+	{
+		// immediate submission of work item with delayed submission in progress
+		if (workQueue.submitAfter(workItem, duration) != 0 || workQueue.submit(workItem) != 0)
+			return false;
+
+		ThisThread::sleepFor(duration * 2);
+		if (record.counter != 3 || workItem.isPending() != false)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Tests submission of work items from interrupt context.
+ *
+ * \param [in] workQueue is a reference to tested work queue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testInterruptSubmission(TestWorkQueue& workQueue)
+{
+	Record record {};
+	auto workItem = makeStaticWorkItem(recordExecution, std::ref(record));
+	int ret {-1};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&workQueue, &workItem, &ret]()
+			{
+				ret = workQueue.submit(workItem);
+			});
+
+	if (softwareTimer.start(TickClock::duration{1}) != 0)
+		return false;
+
+	ThisThread::sleepFor(TickClock::duration{4});
+
+	return ret == 0 && record.counter == 1 && workItem.isPending() == false;
+}
+
+/**
+ * \brief Tests rejection of work item pending in another queue.
+ *
+ * \param [in] workQueue is a reference to tested work queue
+ * \param [in] otherWorkQueue is a reference to another work queue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testOtherQueue(TestWorkQueue& workQueue, TestWorkQueue& otherWorkQueue)
+{
+	Record record {};
+	auto workItem = makeStaticWorkItem(recordExecution, std::ref(record));
+
+	if (workQueue.submit(workItem) != 0)
+		return false;
+	if (otherWorkQueue.submit(workItem) != EBUSY ||
+			otherWorkQueue.submitAfter(workItem, TickClock::duration{1}) != EBUSY)
+		return false;
+	if (workItem.cancel() != 0)
+		return false;
+
+	if (workQueue.submitAfter(workItem, TickClock::duration{1}) != 0)
+		return false;
+	if (otherWorkQueue.submit(workItem) != EBUSY)
+		return false;
+	if (workItem.cancel() != 0)
+		return false;
+
+	// work item which is neither pending nor delayed may be submitted to any queue
+	if (otherWorkQueue.submit(workItem) != 0)
+		return false;
+
+	ThisThread::sleepFor(TickClock::duration{2});
+
+	return record.counter == 1;
+}
+
+/**
+ * \brief Tests concurrent execution of work items by multiple worker threads.
+ *
+ * \param [in] workQueue is a reference to tested work queue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testMultipleWorkers(TestWorkQueue& workQueue)
+{
+	constexpr auto duration = TickClock::duration{10};
+
+	Record sleepingRecord {};
+	Record record {};
+	auto sleepingWorkItem = makeStaticWorkItem(sleepAndRecordExecution, std::ref(sleepingRecord), duration);
+	auto workItem = makeStaticWorkItem(recordExecution, std::ref(record));
+
+	if (workQueue.submit(sleepingWorkItem) != 0 || workQueue.submit(workItem) != 0)
+		return false;
+
+	ThisThread::sleepFor(duration / 2);
+	// second work item was executed by second worker thread while the first one is still sleeping
+	if (record.counter != 1 || sleepingRecord.counter != 0)
+		return false;
+
+	ThisThread::sleepFor(duration);
+
+	return sleepingRecord.counter == 1;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool WorkQueueOperationsTestCase::run_() const
+{
+	const auto allocatedMemory = getAllocatedMemory();
+
+	{
+		TestWorkQueue workQueue {workerPriority};
+		TestWorkQueue otherWorkQueue {workerPriority};
+		if (workQueue.start() != 0 || otherWorkQueue.start() != 0)
+			return false;
+
+		if (testSubmission(workQueue) == false)
+			return false;
+
+		if (testDelayedSubmission(workQueue) == false)
+			return false;
+
+		if (testInterruptSubmission(workQueue) == false)
+			return false;
+
+		if (testOtherQueue(workQueue, otherWorkQueue) == false)
+			return false;
+
+		if (testMultipleWorkers(workQueue) == false)
+			return false;
+	}
+
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
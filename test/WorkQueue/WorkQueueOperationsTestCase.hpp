@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief WorkQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_WORKQUEUE_WORKQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_WORKQUEUE_WORKQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various WorkQueue operations.
+ *
+ * Tests submission of work items from thread and interrupt context, delayed submission, cancellation, resubmission,
+ * rejection of work item pending in another queue and concurrent execution of work items by multiple worker threads.
+ * Also verifies that none of these operations uses dynamic memory allocation.
+ */
+
+class WorkQueueOperationsTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief WorkQueueOperationsTestCase's constructor
+	 */
+
+	constexpr WorkQueueOperationsTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_WORKQUEUE_WORKQUEUEOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,103 @@
+/**
+ * \file
+ * \brief TicklessIdleTestCase class implementation for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-TicklessIdleTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <ctime>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// duration after which software timer expires
+constexpr TickClock::duration timerDuration {CONFIG_TICK_FREQUENCY / 10};
+
+/// duration of sleep
+constexpr TickClock::duration sleepDuration {CONFIG_TICK_FREQUENCY / 4};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return CPU time used by the process
+ */
+
+std::chrono::nanoseconds getProcessCpuTime()
+{
+	timespec cpuTime;
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime);
+	return std::chrono::seconds{cpuTime.tv_sec} + std::chrono::nanoseconds{cpuTime.tv_nsec};
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TicklessIdleTestCase::run_() const
+{
+	TickClock::time_point timerTimePoint {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&timerTimePoint]()
+			{
+				timerTimePoint = TickClock::now();
+			});
+
+	waitForNextTick();
+
+	const auto start = TickClock::now();
+	const auto hostStart = std::chrono::steady_clock::now();
+	const auto cpuStart = getProcessCpuTime();
+
+	if (softwareTimer.start(start + timerDuration) != 0)
+		return false;
+
+	// sleepUntil() is used to get exact wakeup time point, sleepFor() would add one tick
+	if (ThisThread::sleepUntil(start + sleepDuration) != 0)
+		return false;
+
+	const auto end = TickClock::now();
+	const auto hostDuration = std::chrono::steady_clock::now() - hostStart;
+	const auto cpuDuration = getProcessCpuTime() - cpuStart;
+
+	if (timerTimePoint != start + timerDuration || end != start + sleepDuration)
+		return false;
+
+	// tick clock must not run faster than host's monotonic clock
+	if (hostDuration < sleepDuration - TickClock::duration{1})
+		return false;
+
+	// process should sleep while only idle thread is runnable, so it should use just a fraction of CPU time
+	if (cpuDuration * 4 > hostDuration)
+		return false;
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief TicklessIdleTestCase class header for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_ARCHITECTURE_POSIX_POSIX_TICKLESSIDLETESTCASE_HPP_
+#define TEST_ARCHITECTURE_POSIX_POSIX_TICKLESSIDLETESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests tickless idle mode.
+ *
+ * Main thread sleeps while a software timer is running, so the idle thread enters tickless idle mode twice - first
+ * until expiration of the software timer, then until the end of sleep. Test asserts that the software timer and the
+ * sleep end at exactly the right tick, that tick clock doesn't run faster than host's monotonic clock and that the
+ * process doesn't use CPU time while it is idle.
+ */
+
+class TicklessIdleTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX};
+
+public:
+
+	/**
+	 * \brief TicklessIdleTestCase's constructor
+	 */
+
+	constexpr TicklessIdleTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_ARCHITECTURE_POSIX_POSIX_TICKLESSIDLETESTCASE_HPP_
@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief architectureTestCases object definition for POSIX
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "architecture/architectureTestCases.hpp"
+
+#include "TestCaseGroup.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "POSIX-TicklessIdleTestCase.hpp"
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TicklessIdleTestCase instance
+const TicklessIdleTestCase ticklessIdleTestCase;
+
+/// array with references to architecture-specific test cases
+const TestCaseGroup::Range::value_type architectureTestCases_[]
+{
+		TestCaseGroup::Range::value_type{ticklessIdleTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup architectureTestCases {TestCaseGroup::Range{architectureTestCases_}};
+
+#else	// !def CONFIG_TICKLESS_IDLE_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup architectureTestCases {TestCaseGroup::Range{}};
+
+#endif	// !def CONFIG_TICKLESS_IDLE_ENABLE
+
+}	// namespace test
+
+}	// namespace distortos
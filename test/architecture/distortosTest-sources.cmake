@@ -8,3 +8,4 @@
 #
 
 include(${CMAKE_CURRENT_LIST_DIR}/ARM/distortosTest-sources.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/POSIX/distortosTest-sources.cmake)
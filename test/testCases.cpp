@@ -2,7 +2,7 @@
  * \file
  * \brief testCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,9 +16,14 @@
 #include "Semaphore/semaphoreTestCases.hpp"
 #include "Mutex/mutexTestCases.hpp"
 #include "ConditionVariable/conditionVariableTestCases.hpp"
+#include "EventFlags/eventFlagsTestCases.hpp"
+#include "Poll/pollTestCases.hpp"
 #include "Queue/queueTestCases.hpp"
+#include "MemoryPool/memoryPoolTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
 #include "CallOnce/callOnceTestCases.hpp"
+#include "WorkQueue/workQueueTestCases.hpp"
+#include "Executor/executorTestCases.hpp"
 #include "architecture/architectureTestCases.hpp"
 
 #include "TestCaseGroup.hpp"
@@ -44,9 +49,14 @@ const TestCaseGroup::Range::value_type testCases_[]
 		TestCaseGroup::Range::value_type{semaphoreTestCases},
 		TestCaseGroup::Range::value_type{mutexTestCases},
 		TestCaseGroup::Range::value_type{conditionVariableTestCases},
+		TestCaseGroup::Range::value_type{eventFlagsTestCases},
+		TestCaseGroup::Range::value_type{pollTestCases},
 		TestCaseGroup::Range::value_type{queueTestCases},
+		TestCaseGroup::Range::value_type{memoryPoolTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
 		TestCaseGroup::Range::value_type{callOnceTestCases},
+		TestCaseGroup::Range::value_type{workQueueTestCases},
+		TestCaseGroup::Range::value_type{executorTestCases},
 		TestCaseGroup::Range::value_type{architectureTestCases},
 };
 
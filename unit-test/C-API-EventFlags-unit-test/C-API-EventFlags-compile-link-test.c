@@ -0,0 +1,45 @@
+/**
+ * \file
+ * \brief EventFlags C-API compile/link test
+ *
+ * The only purpose of this test is to ensure event flags C-API can be used from C code and that whole application can
+ * be linked correctly. It just uses all types, macros and functions from the tested header.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/C-API/EventFlags.h"
+
+#include <stddef.h>
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void compileLinkTest()
+{
+	{
+		struct distortos_EventFlags eventFlags = DISTORTOS_EVENTFLAGS_INITIALIZER(eventFlags, 0);
+	}
+	{
+		DISTORTOS_EVENTFLAGS_CONSTRUCT_1(eventFlags, 0);
+	}
+	{
+		DISTORTOS_EVENTFLAGS_CONSTRUCT(eventFlags);
+	}
+
+	distortos_EventFlags_construct_1(NULL, 0);
+	distortos_EventFlags_construct(NULL);
+	distortos_EventFlags_destruct(NULL);
+	distortos_EventFlags_clear(NULL, 0, NULL);
+	distortos_EventFlags_get(NULL, NULL);
+	distortos_EventFlags_set(NULL, 0, NULL);
+	distortos_EventFlags_tryWait(NULL, 0, distortos_EventFlags_WaitMode_any, NULL);
+	distortos_EventFlags_tryWaitFor(NULL, 0, 0, distortos_EventFlags_WaitMode_all, NULL);
+	distortos_EventFlags_tryWaitUntil(NULL, 0, 0, distortos_EventFlags_WaitMode_anyClear, NULL);
+	distortos_EventFlags_wait(NULL, 0, distortos_EventFlags_WaitMode_allClear, NULL);
+}
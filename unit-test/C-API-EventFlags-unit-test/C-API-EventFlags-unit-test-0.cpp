@@ -0,0 +1,255 @@
+/**
+ * \file
+ * \brief EventFlags C-API test cases
+ *
+ * This test checks whether event flags C-API functions properly call appropriate functions from distortos::EventFlags
+ * class.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/fromCApi.hpp"
+#include "distortos/EventFlags.hpp"
+#include "distortos/C-API/EventFlags.h"
+
+using trompeloeil::_;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing DISTORTOS_EVENTFLAGS_INITIALIZER()", "[initializer]")
+{
+	constexpr uint32_t randomValue {0x4a1c9e37};
+
+	const distortos_EventFlags eventFlags = DISTORTOS_EVENTFLAGS_INITIALIZER(eventFlags, randomValue);
+	REQUIRE(eventFlags.value == randomValue);
+}
+
+TEST_CASE("Testing DISTORTOS_EVENTFLAGS_CONSTRUCT_1()", "[construct]")
+{
+	constexpr uint32_t randomValue {0x93b0e1d6};
+
+	DISTORTOS_EVENTFLAGS_CONSTRUCT_1(eventFlags, randomValue);
+	REQUIRE(eventFlags.value == randomValue);
+}
+
+TEST_CASE("Testing DISTORTOS_EVENTFLAGS_CONSTRUCT()", "[construct]")
+{
+	DISTORTOS_EVENTFLAGS_CONSTRUCT(eventFlags);
+	REQUIRE(eventFlags.value == 0);
+}
+
+TEST_CASE("Testing distortos_EventFlags_construct_1()", "[construct]")
+{
+	constexpr uint32_t randomValue {0x0e7d2a54};
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	std::aligned_storage<sizeof(distortos::EventFlags), alignof(distortos::EventFlags)>::type storage;
+
+	REQUIRE(distortos_EventFlags_construct_1(nullptr, randomValue) == EINVAL);
+
+	distortos::EventFlags::getProxyInstance() = &eventFlagsMock;
+	REQUIRE_CALL(eventFlagsMock, construct(randomValue));
+	REQUIRE(distortos_EventFlags_construct_1(reinterpret_cast<distortos_EventFlags*>(&storage), randomValue) == 0);
+	distortos::EventFlags::getProxyInstance() = {};
+
+	reinterpret_cast<distortos::EventFlags*>(&storage)->~EventFlags();
+}
+
+TEST_CASE("Testing distortos_EventFlags_construct()", "[construct]")
+{
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	std::aligned_storage<sizeof(distortos::EventFlags), alignof(distortos::EventFlags)>::type storage;
+
+	REQUIRE(distortos_EventFlags_construct(nullptr) == EINVAL);
+
+	distortos::EventFlags::getProxyInstance() = &eventFlagsMock;
+	REQUIRE_CALL(eventFlagsMock, construct(0u));
+	REQUIRE(distortos_EventFlags_construct(reinterpret_cast<distortos_EventFlags*>(&storage)) == 0);
+	distortos::EventFlags::getProxyInstance() = {};
+
+	reinterpret_cast<distortos::EventFlags*>(&storage)->~EventFlags();
+}
+
+TEST_CASE("Testing distortos_EventFlags_destruct()", "[destruct]")
+{
+	distortos::FromCApiMock fromCApiMock;
+	trompeloeil::deathwatched<distortos::EventFlags> eventFlagsMock;
+	distortos_EventFlags eventFlags;
+
+	REQUIRE(distortos_EventFlags_destruct(nullptr) == EINVAL);
+
+	{
+		REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+		REQUIRE_DESTRUCTION(eventFlagsMock);
+		REQUIRE(distortos_EventFlags_destruct(&eventFlags) == 0);
+	}
+}
+
+TEST_CASE("Testing distortos_EventFlags_clear()", "[clear]")
+{
+	constexpr uint32_t randomBitmask {0x5f2b81c3};
+	constexpr uint32_t randomValue {0xd4a06e19};
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	distortos_EventFlags eventFlags;
+
+	REQUIRE(distortos_EventFlags_clear(nullptr, randomBitmask, nullptr) == EINVAL);
+
+	{
+		REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+		REQUIRE_CALL(eventFlagsMock, clear(randomBitmask)).RETURN(randomValue);
+		REQUIRE(distortos_EventFlags_clear(&eventFlags, randomBitmask, nullptr) == 0);
+	}
+	{
+		uint32_t previousValue {};
+		REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+		REQUIRE_CALL(eventFlagsMock, clear(randomBitmask)).RETURN(randomValue);
+		REQUIRE(distortos_EventFlags_clear(&eventFlags, randomBitmask, &previousValue) == 0);
+		REQUIRE(previousValue == randomValue);
+	}
+}
+
+TEST_CASE("Testing distortos_EventFlags_get()", "[get]")
+{
+	constexpr uint32_t randomValue {0x1b6fd852};
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	const distortos_EventFlags eventFlags {};
+	uint32_t value;
+
+	REQUIRE(distortos_EventFlags_get(nullptr, nullptr) == EINVAL);
+	REQUIRE(distortos_EventFlags_get(nullptr, &value) == EINVAL);
+	REQUIRE(distortos_EventFlags_get(&eventFlags, nullptr) == EINVAL);
+
+	REQUIRE_CALL(fromCApiMock, getConstEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+	REQUIRE_CALL(eventFlagsMock, get()).RETURN(randomValue);
+	REQUIRE(distortos_EventFlags_get(&eventFlags, &value) == 0);
+	REQUIRE(value == randomValue);
+}
+
+TEST_CASE("Testing distortos_EventFlags_set()", "[set]")
+{
+	constexpr uint32_t randomBitmask {0x8c35f0a7};
+	constexpr uint32_t randomValue {0x26e94b1d};
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	distortos_EventFlags eventFlags;
+
+	REQUIRE(distortos_EventFlags_set(nullptr, randomBitmask, nullptr) == EINVAL);
+
+	{
+		REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+		REQUIRE_CALL(eventFlagsMock, set(randomBitmask)).RETURN(randomValue);
+		REQUIRE(distortos_EventFlags_set(&eventFlags, randomBitmask, nullptr) == 0);
+	}
+	{
+		uint32_t previousValue {};
+		REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+		REQUIRE_CALL(eventFlagsMock, set(randomBitmask)).RETURN(randomValue);
+		REQUIRE(distortos_EventFlags_set(&eventFlags, randomBitmask, &previousValue) == 0);
+		REQUIRE(previousValue == randomValue);
+	}
+}
+
+TEST_CASE("Testing distortos_EventFlags_tryWait()", "[tryWait]")
+{
+	constexpr uint32_t randomBitmask {0x7e01c4b9};
+	constexpr uint32_t randomValue {0xa35d2f60};
+	constexpr auto waitMode = distortos::EventFlags::WaitMode::anyClear;
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	distortos_EventFlags eventFlags;
+	uint32_t value {};
+
+	REQUIRE(distortos_EventFlags_tryWait(nullptr, randomBitmask, distortos_EventFlags_WaitMode_anyClear, &value) ==
+			EINVAL);
+	REQUIRE(distortos_EventFlags_tryWait(&eventFlags, randomBitmask, UINT8_MAX, &value) == EINVAL);
+
+	REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+	REQUIRE_CALL(eventFlagsMock, tryWait(randomBitmask, waitMode)).RETURN(std::make_pair(EAGAIN, randomValue));
+	REQUIRE(distortos_EventFlags_tryWait(&eventFlags, randomBitmask, distortos_EventFlags_WaitMode_anyClear, &value) ==
+			EAGAIN);
+	REQUIRE(value == randomValue);
+}
+
+TEST_CASE("Testing distortos_EventFlags_tryWaitFor()", "[tryWaitFor]")
+{
+	constexpr int64_t randomDuration {0x2d74a9f03b6e1c58};
+	constexpr uint32_t randomBitmask {0x63f8a21e};
+	constexpr uint32_t randomValue {0x0bd7c593};
+	constexpr auto waitMode = distortos::EventFlags::WaitMode::all;
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	distortos_EventFlags eventFlags;
+	uint32_t value {};
+
+	REQUIRE(distortos_EventFlags_tryWaitFor(nullptr, randomDuration, randomBitmask, distortos_EventFlags_WaitMode_all,
+			&value) == EINVAL);
+	REQUIRE(distortos_EventFlags_tryWaitFor(&eventFlags, randomDuration, randomBitmask, UINT8_MAX, &value) == EINVAL);
+
+	REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+	const auto duration = distortos::TickClock::duration{randomDuration};
+	REQUIRE_CALL(eventFlagsMock, tryWaitFor(duration, randomBitmask, waitMode)).RETURN(std::make_pair(ETIMEDOUT,
+			randomValue));
+	REQUIRE(distortos_EventFlags_tryWaitFor(&eventFlags, randomDuration, randomBitmask,
+			distortos_EventFlags_WaitMode_all, &value) == ETIMEDOUT);
+	REQUIRE(value == randomValue);
+}
+
+TEST_CASE("Testing distortos_EventFlags_tryWaitUntil()", "[tryWaitUntil]")
+{
+	constexpr int64_t randomTimePoint {0x59c1e8a7260fd34b};
+	constexpr uint32_t randomBitmask {0xf0925b6d};
+	constexpr uint32_t randomValue {0x4e3a17c8};
+	constexpr auto waitMode = distortos::EventFlags::WaitMode::allClear;
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	distortos_EventFlags eventFlags;
+	uint32_t value {};
+
+	REQUIRE(distortos_EventFlags_tryWaitUntil(nullptr, randomTimePoint, randomBitmask,
+			distortos_EventFlags_WaitMode_allClear, &value) == EINVAL);
+	REQUIRE(distortos_EventFlags_tryWaitUntil(&eventFlags, randomTimePoint, randomBitmask, UINT8_MAX, &value) ==
+			EINVAL);
+
+	REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+	const auto timePoint = distortos::TickClock::time_point{distortos::TickClock::duration{randomTimePoint}};
+	REQUIRE_CALL(eventFlagsMock, tryWaitUntil(timePoint, randomBitmask, waitMode)).RETURN(std::make_pair(ETIMEDOUT,
+			randomValue));
+	REQUIRE(distortos_EventFlags_tryWaitUntil(&eventFlags, randomTimePoint, randomBitmask,
+			distortos_EventFlags_WaitMode_allClear, &value) == ETIMEDOUT);
+	REQUIRE(value == randomValue);
+}
+
+TEST_CASE("Testing distortos_EventFlags_wait()", "[wait]")
+{
+	constexpr uint32_t randomBitmask {0x3a6c0ef5};
+	constexpr uint32_t randomValue {0xc1784d2b};
+	constexpr auto waitMode = distortos::EventFlags::WaitMode::any;
+
+	distortos::FromCApiMock fromCApiMock;
+	distortos::EventFlags eventFlagsMock;
+	distortos_EventFlags eventFlags;
+
+	REQUIRE(distortos_EventFlags_wait(nullptr, randomBitmask, distortos_EventFlags_WaitMode_any, nullptr) == EINVAL);
+	REQUIRE(distortos_EventFlags_wait(&eventFlags, randomBitmask, UINT8_MAX, nullptr) == EINVAL);
+
+	REQUIRE_CALL(fromCApiMock, getEventFlags(_)).LR_WITH(&_1 == &eventFlags).LR_RETURN(std::ref(eventFlagsMock));
+	REQUIRE_CALL(eventFlagsMock, wait(randomBitmask, waitMode)).RETURN(std::make_pair(EINTR, randomValue));
+	REQUIRE(distortos_EventFlags_wait(&eventFlags, randomBitmask, distortos_EventFlags_WaitMode_any, nullptr) ==
+			EINTR);
+}
@@ -0,0 +1,85 @@
+/**
+ * \file
+ * \brief EventFlags C-API test cases
+ *
+ * This test checks whether event flags objects instantiated with C-API macros and functions are binary identical to
+ * constructed distortos::EventFlags objects.
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/EventFlags.hpp"
+#include "distortos/C-API/EventFlags.h"
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void testCommon(distortos_EventFlags& eventFlags, const uint32_t value = {})
+{
+	REQUIRE(eventFlags.value == value);
+	distortos_EventFlags constructed;
+	memcpy(&constructed, &eventFlags, sizeof(eventFlags));
+	REQUIRE(distortos_EventFlags_destruct(&eventFlags) == 0);
+	struct distortos_EventFlags destructed;
+	memcpy(&destructed, &eventFlags, sizeof(eventFlags));
+
+	memset(&eventFlags, 0, sizeof(eventFlags));
+
+	const auto realEventFlags = new (&eventFlags) distortos::EventFlags {value};
+	REQUIRE(realEventFlags->get() == value);
+	REQUIRE(memcmp(&constructed, &eventFlags, sizeof(eventFlags)) == 0);
+	realEventFlags->~EventFlags();
+	REQUIRE(memcmp(&destructed, &eventFlags, sizeof(eventFlags)) == 0);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global test cases
++---------------------------------------------------------------------------------------------------------------------*/
+
+TEST_CASE("Testing DISTORTOS_EVENTFLAGS_INITIALIZER()", "[initializer]")
+{
+	constexpr uint32_t randomValue {0x6d2e95a1};
+
+	distortos_EventFlags eventFlags = DISTORTOS_EVENTFLAGS_INITIALIZER(eventFlags, randomValue);
+	testCommon(eventFlags, randomValue);
+}
+
+TEST_CASE("Testing DISTORTOS_EVENTFLAGS_CONSTRUCT_1()", "[construct]")
+{
+	constexpr uint32_t randomValue {0xb7430c5e};
+
+	DISTORTOS_EVENTFLAGS_CONSTRUCT_1(eventFlags, randomValue);
+	testCommon(eventFlags, randomValue);
+}
+
+TEST_CASE("Testing DISTORTOS_EVENTFLAGS_CONSTRUCT()", "[construct]")
+{
+	DISTORTOS_EVENTFLAGS_CONSTRUCT(eventFlags);
+	testCommon(eventFlags);
+}
+
+TEST_CASE("Testing distortos_EventFlags_construct_1()", "[construct]")
+{
+	constexpr uint32_t randomValue {0x19f8d7b2};
+
+	distortos_EventFlags eventFlags {};
+	REQUIRE(distortos_EventFlags_construct_1(&eventFlags, randomValue) == 0);
+	testCommon(eventFlags, randomValue);
+}
+
+TEST_CASE("Testing distortos_EventFlags_construct()", "[construct]")
+{
+	distortos_EventFlags eventFlags {};
+	REQUIRE(distortos_EventFlags_construct(&eventFlags) == 0);
+	testCommon(eventFlags);
+}
@@ -0,0 +1,69 @@
+/**
+ * \file
+ * \brief Mock of EventFlags class
+ *
+ * \author Copyright (C) 2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef UNIT_TEST_INCLUDE_MOCKS_EVENTFLAGS_HPP_DISTORTOS_EVENTFLAGS_HPP_
+#define UNIT_TEST_INCLUDE_MOCKS_EVENTFLAGS_HPP_DISTORTOS_EVENTFLAGS_HPP_
+
+#include "unit-test-common.hpp"
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+class EventFlags
+{
+public:
+
+	using Value = uint32_t;
+
+	enum class WaitMode : uint8_t
+	{
+		any,
+		all,
+		anyClear,
+		allClear,
+	};
+
+	using WaitResult = std::pair<int, Value>;
+
+	EventFlags() = default;
+
+	explicit EventFlags(const Value value)
+	{
+		REQUIRE(getProxyInstance() != nullptr);
+		getProxyInstance()->construct(value);
+	}
+
+	virtual ~EventFlags()
+	{
+
+	}
+
+	MAKE_MOCK1(construct, void(Value));
+	MAKE_MOCK1(clear, Value(Value));
+	MAKE_CONST_MOCK0(get, Value());
+	MAKE_MOCK1(set, Value(Value));
+	MAKE_MOCK2(tryWait, WaitResult(Value, WaitMode));
+	MAKE_MOCK3(tryWaitFor, WaitResult(TickClock::duration, Value, WaitMode));
+	MAKE_MOCK3(tryWaitUntil, WaitResult(TickClock::time_point, Value, WaitMode));
+	MAKE_MOCK2(wait, WaitResult(Value, WaitMode));
+
+	static EventFlags*& getProxyInstance()
+	{
+		static EventFlags* proxyInstance;
+		return proxyInstance;
+	}
+};
+
+}	// namespace distortos
+
+#endif	// UNIT_TEST_INCLUDE_MOCKS_EVENTFLAGS_HPP_DISTORTOS_EVENTFLAGS_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of Mutex class
  *
- * \author Copyright (C) 2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2017-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,8 @@
 
 #include "unit-test-common.hpp"
 
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
 #include "distortos/MutexProtocol.hpp"
 #include "distortos/MutexType.hpp"
 #include "distortos/TickClock.hpp"
@@ -62,6 +64,8 @@ public:
 	virtual ~Mutex() = default;
 
 	MAKE_MOCK3(construct, void(Type, Protocol, uint8_t));
+	MAKE_MOCK1(doTakeOverWaiter, bool(internal::ThreadControlBlock&));
+	MAKE_CONST_MOCK0(getOwner, internal::ThreadControlBlock*());
 	MAKE_MOCK0(lock, int());
 	MAKE_MOCK0(tryLock, int());
 	MAKE_MOCK1(tryLockFor, int(TickClock::duration));
@@ -2,7 +2,7 @@
  * \file
  * \brief Mock of Scheduler class
  *
- * \author Copyright (C) 2017 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2017-2018 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -34,6 +34,7 @@ public:
 	MAKE_MOCK3(blockUntil, int(ThreadList&, ThreadState, TickClock::time_point));
 	MAKE_MOCK4(blockUntil, int(ThreadList&, ThreadState, TickClock::time_point, const UnblockFunctor*));
 	MAKE_CONST_MOCK0(getCurrentThreadControlBlock, ThreadControlBlock&());
+	MAKE_MOCK3(requeue, void(ThreadList&, ThreadList::iterator, ThreadState));
 	MAKE_MOCK1(unblock, void(ThreadList::iterator));
 	MAKE_MOCK2(unblock, void(ThreadList::iterator, UnblockReason));
 };